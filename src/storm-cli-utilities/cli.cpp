@@ -8,6 +8,8 @@
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/utility/MemoryBudget.h"
+#include "storm/utility/Metrics.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
@@ -51,6 +53,16 @@ void setResourceLimits() {
         storm::utility::resources::setTimeoutAlarm(resources.getTimeoutInSeconds());
     }
 
+    // If we were given a memory limit, the large allocations are checked against it from now on.
+    if (resources.isMemoryLimitSet()) {
+        storm::utility::resources::MemoryBudget::instance().setLimit(resources.getMemoryLimitInMegabytes() * 1024 * 1024);
+    }
+
+    // If metrics shall be exported, we record them from now on.
+    if (resources.isExportMetricsSet()) {
+        storm::utility::metrics::MetricsRecorder::instance().setEnabled(true);
+    }
+
     // register signal handler to handle aborts
     storm::utility::resources::installSignalHandler(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getSignalWaitingTimeInSeconds());
 }
@@ -99,12 +111,22 @@ int process(std::string const& name, std::string const& executableName, std::fun
     storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 
     // Process options and start computations
-    processOptionsFunc();
+    {
+        storm::utility::metrics::ScopedTimer totalPhase("total");
+        processOptionsFunc();
+    }
 
     totalTimer.stop();
-    if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
+    storm::settings::modules::ResourceSettings const& resources = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resources.isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
     }
+    if (resources.isExportMetricsSet()) {
+        std::ofstream stream;
+        storm::io::openFile(resources.getExportMetricsFilename(), stream);
+        storm::utility::metrics::MetricsRecorder::instance().exportMetrics(stream, resources.getExportMetricsFormat());
+        storm::io::closeFile(stream);
+    }
 
     // All operations have been performed, so we clean up everything and terminate.
     storm::utility::cleanUp();
@@ -7,6 +7,9 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm-parsers/parser/ExpressionParser.h"
 
+#include "storm-version-info/storm-version.h"
+
+#include "storm/io/BinaryEncoding.h"
 #include "storm/io/file.h"
 #include "storm/utility/AutomaticSettings.h"
 #include "storm/utility/Engine.h"
@@ -14,9 +17,13 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 
+#include "storm/utility/Metrics.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 
+#include <cstdio>
+#include <iomanip>
+#include <random>
 #include <type_traits>
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -30,6 +37,7 @@
 
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/hints/WarmStartHintCache.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -69,6 +77,7 @@ struct SymbolicInput {
 inline void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input) {
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
     if (ioSettings.isPrismOrJaniInputSet()) {
+        storm::utility::metrics::ScopedTimer parsingPhase("model parsing");
         storm::utility::Stopwatch modelParsingWatch(true);
         if (ioSettings.isPrismInputSet()) {
             input.model =
@@ -114,6 +123,7 @@ inline SymbolicInput parseSymbolicInputQvbs(storm::settings::modules::IOSettings
     SymbolicInput input;
     storm::storage::QvbsBenchmark benchmark(ioSettings.getQvbsModelName());
     STORM_PRINT_AND_LOG(benchmark.getInfo(ioSettings.getQvbsInstanceIndex(), ioSettings.getQvbsPropertyFilter()));
+    storm::utility::metrics::ScopedTimer parsingPhase("model parsing");
     storm::utility::Stopwatch modelParsingWatch(true);
     auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(ioSettings.getQvbsInstanceIndex()), ioSettings.getQvbsPropertyFilter());
     input.model = std::move(janiInput.first);
@@ -440,8 +450,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& inpu
                                                              !buildSettings.isApplyNoMaximumProgressAssumptionSet());
 }
 
-template<typename ValueType>
-std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
+inline storm::builder::BuilderOptions createSparseBuilderOptions(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
     storm::builder::BuilderOptions options(createFormulasToRespect(input.properties), input.model.get());
     options.setBuildChoiceLabels(options.isBuildChoiceLabelsSet() || buildSettings.isBuildChoiceLabelsSet());
     options.setBuildStateValuations(options.isBuildStateValuationsSet() || buildSettings.isBuildStateValuationsSet());
@@ -466,6 +475,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
+    options.setCacheSynchronizations(buildSettings.isCacheSynchronizationsSet());
     if (buildSettings.isBuildFullModelSet()) {
         options.clearTerminalStates();
         options.setApplyMaximalProgressAssumption(false);
@@ -477,9 +487,104 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
         options.setAddOverlappingGuardsLabel(true);
     }
 
+    return options;
+}
+
+/*!
+ * Retrieves the name of the file in which the sparse model for the given input and builder options is cached. The name is a hash of the preprocessed
+ * symbolic model (which includes the constant definitions), the builder options and build settings that affect the built model (including the
+ * numbering of its states), the value type and the version of Storm.
+ */
+template<typename ValueType>
+std::string getModelCacheFilename(SymbolicInput const& input, storm::builder::BuilderOptions const& options,
+                                  storm::settings::modules::BuildSettings const& buildSettings) {
+    std::stringstream keyStream;
+    keyStream << storm::StormVersion::longVersionString() << '\n' << typeid(ValueType).name() << '\n';
+    keyStream << options.isApplyMaximalProgressAssumptionSet() << options.isBuildChoiceLabelsSet() << options.isBuildObservationValuationsSet()
+              << options.isInferObservationsFromActionsSet() << options.isScaleAndLiftTransitionRewardsSet() << options.isAddOutOfBoundsStateSet()
+              << options.isAddOverlappingGuardLabelSet() << ' ' << options.getReservedBitsForUnboundedVariables() << '\n';
+    keyStream << buildSettings.getExplorationOrder() << ' ' << buildSettings.isDontFixDeadlocksSet() << buildSettings.isPrismCompatibilityEnabled() << '\n';
+    for (auto const& expressionLabel : options.getExpressionLabels()) {
+        keyStream << expressionLabel.first << '\n';
+    }
+    keyStream << input.model.get();
+    std::string key = keyStream.str();
+
+    // Combine two independent 64-bit hashes (std::hash and FNV-1a) to make collisions practically impossible.
+    uint64_t fnvHash = 14695981039346656037ull;
+    for (char character : key) {
+        fnvHash = (fnvHash ^ static_cast<unsigned char>(character)) * 1099511628211ull;
+    }
+    std::stringstream filename;
+    filename << buildSettings.getModelCacheDirectory() << "/" << std::hex << std::setfill('0') << std::setw(16) << std::hash<std::string>()(key)
+             << std::setw(16) << fnvHash << ".stormbin";
+    return filename.str();
+}
+
+/*!
+ * Loads the sparse model from the model cache or builds it and adds it to the cache. Cached models are built with all labels and reward models and
+ * without terminal states such that they can be reused for other properties.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildModelSparseCached(SymbolicInput const& input, storm::builder::BuilderOptions options,
+                                                                                storm::settings::modules::BuildSettings const& buildSettings) {
+    options.clearTerminalStates();
+    options.setBuildAllLabels(true);
+    options.setBuildAllRewardModels(true);
+    std::string filename = getModelCacheFilename<ValueType>(input, options, buildSettings);
+
+    if (storm::utility::fileExistsAndIsReadable(filename)) {
+        std::ifstream stream(filename, std::ios::binary);
+        try {
+            auto model = storm::exporter::binaryImportSparseModel<ValueType>(stream);
+            STORM_PRINT_AND_LOG("Loaded model from cache file " << filename << ".\n");
+            return model;
+        } catch (storm::exceptions::BaseException const& e) {
+            STORM_LOG_WARN("Unable to load the cached model from " << filename << ": " << e.what() << " The model is rebuilt.");
+        }
+    }
+
+    auto model = storm::api::buildSparseModel<ValueType>(input.model.get(), options);
+
+    // Write to a temporary file first such that concurrent runs never load a partially written model.
+    std::string temporaryFilename = filename + ".tmp" + std::to_string(std::random_device()());
+    std::ofstream stream(temporaryFilename, std::ios::binary);
+    try {
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << temporaryFilename << ".");
+        storm::exporter::binaryExportSparseModel(stream, model);
+        stream.close();
+        STORM_LOG_THROW(std::rename(temporaryFilename.c_str(), filename.c_str()) == 0, storm::exceptions::FileIoException,
+                        "Could not move " << temporaryFilename << " to " << filename << ".");
+        STORM_PRINT_AND_LOG("Stored model in cache file " << filename << ".\n");
+    } catch (storm::exceptions::BaseException const& e) {
+        stream.close();
+        std::remove(temporaryFilename.c_str());
+        STORM_LOG_WARN("Unable to store the model in the model cache: " << e.what());
+    }
+    return model;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
+    storm::builder::BuilderOptions options = createSparseBuilderOptions(input, buildSettings);
+    if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value) {
+        // State valuations and choice origins can not be stored in the model cache.
+        if (buildSettings.isModelCacheSet() && !options.isBuildStateValuationsSet() && !options.isBuildChoiceOriginsSet()) {
+            return buildModelSparseCached<ValueType>(input, options, buildSettings);
+        }
+    }
     return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
 }
 
+template<typename ValueType>
+void exportModelSparseWhileBuilding(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings,
+                                    storm::settings::modules::BuildSettings const& buildSettings) {
+    STORM_LOG_THROW(input.properties.empty(), storm::exceptions::InvalidSettingsException,
+                    "The model is not built when it is exported during the exploration, so no properties can be checked.");
+    storm::api::exportSparseModelAsDrnWhileBuilding<ValueType>(input.model.get(), createSparseBuilderOptions(input, buildSettings),
+                                                               ioSettings.getExportBuildFilename(), input.model.get().getParameterNames());
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::modules::IOSettings const& ioSettings,
                                                              storm::settings::modules::BuildSettings const& buildSettings) {
@@ -504,6 +609,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
 template<storm::dd::DdType DdType, typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings,
                                                      ModelProcessingInformation const& mpi) {
+    storm::utility::metrics::ScopedTimer buildingPhase("model construction");
     storm::utility::Stopwatch modelBuildingWatch(true);
 
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
@@ -512,6 +618,8 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
         auto builderType = storm::utility::getBuilderType(mpi.engine);
         if (builderType == storm::builder::BuilderType::Dd) {
             result = buildModelDd<DdType, ValueType>(input);
+        } else if (builderType == storm::builder::BuilderType::Explicit && ioSettings.isExportBuildStreamingSet()) {
+            exportModelSparseWhileBuilding<ValueType>(input, ioSettings, buildSettings);
         } else if (builderType == storm::builder::BuilderType::Explicit) {
             result = buildModelSparse<ValueType>(input, buildSettings);
         }
@@ -524,6 +632,8 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
     modelBuildingWatch.stop();
     if (result) {
         STORM_PRINT("Time for model construction: " << modelBuildingWatch << ".\n\n");
+    } else if (ioSettings.isExportBuildStreamingSet()) {
+        STORM_PRINT("Time for model construction and export: " << modelBuildingWatch << ".\n\n");
     }
 
     return result;
@@ -765,6 +875,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
 template<storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
 std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input,
                                                                            ModelProcessingInformation const& mpi) {
+    storm::utility::metrics::ScopedTimer preprocessingPhase("model preprocessing");
     storm::utility::Stopwatch preprocessingWatch(true);
 
     std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -964,6 +1075,7 @@ void verifyProperties(
     for (auto const& property : properties) {
         printModelCheckingProperty(property);
         bool ignored = false;
+        storm::utility::metrics::ScopedTimer propertyPhase("model checking " + property.getName());
         storm::utility::Stopwatch watch(true);
         std::unique_ptr<storm::modelchecker::CheckResult> result;
         try {
@@ -1098,14 +1210,49 @@ template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+
+    // The results of previous properties may serve as starting points for related properties.
+    storm::modelchecker::WarmStartHintCache<ValueType> warmStartHints;
+    bool useWarmStart = false;
+    if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value) {
+        useWarmStart = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isWarmStartSet() &&
+                       (sparseModel->isOfType(storm::models::ModelType::Dtmc) || sparseModel->isOfType(storm::models::ModelType::Mdp));
+        if (useWarmStart) {
+            // Results (and schedulers) only need to be kept if a subsequent property is related.
+            for (auto const& property : input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties) {
+                warmStartHints.announceFormula(*property.getRawFormula());
+            }
+        }
+    }
+
+    auto verificationCallback = [&sparseModel, &ioSettings, &mpi, &warmStartHints, useWarmStart](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                                                 std::shared_ptr<storm::logic::Formula const> const& states) {
         bool filterForInitialStates = states->isInitialFormula();
         auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
         if (ioSettings.isExportSchedulerSet()) {
             task.setProduceSchedulers(true);
         }
+        if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value) {
+            if (useWarmStart && warmStartHints.isSupported(*formula)) {
+                warmStartHints.withdrawFormula(*formula);
+                // Starting from previous values would compromise the guarantees of sound and exact methods.
+                bool useValueHints = !mpi.env.solver().isForceSoundness() && !mpi.env.solver().isForceExact();
+                if (auto hint = warmStartHints.getHint(*formula, useValueHints)) {
+                    STORM_LOG_INFO("Using the result of a related property as a hint.");
+                    task.setHint(hint);
+                }
+                // The schedulers for unbounded properties on MDPs serve as hints for subsequent related properties.
+                if (sparseModel->isNondeterministicModel() && !warmStartHints.isStepBounded(*formula) && warmStartHints.isRelatedToAnnouncedFormula(*formula)) {
+                    task.setProduceSchedulers(true);
+                }
+            }
+        }
         std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value) {
+            if (useWarmStart && result && warmStartHints.isRelatedToAnnouncedFormula(*formula)) {
+                warmStartHints.storeResult(*formula, *result);
+            }
+        }
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
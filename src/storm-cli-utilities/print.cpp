@@ -1,6 +1,7 @@
 #include "print.h"
 
 #include "storm-version-info/storm-version.h"
+#include "storm/storage/sparse/AnalysisCache.h"
 #include "storm/utility/cli.h"
 #include "storm/utility/macros.h"
 
@@ -160,6 +161,11 @@ void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds) {
         std::cout << "  * wallclock time: " << (wallclockMilliseconds / 1000) << "." << std::setw(3) << (wallclockMilliseconds % 1000) << "s\n";
     }
     std::cout.fill(oldFillChar);
+    auto const& analysisCache = storm::storage::sparse::AnalysisCache::instance();
+    if (analysisCache.getNumberOfHits() + analysisCache.getNumberOfMisses() > 0) {
+        std::cout << "  * analysis cache: " << analysisCache.getNumberOfHits() << " hits, " << analysisCache.getNumberOfMisses() << " misses, "
+                  << analysisCache.getNumberOfEvictions() << " evictions\n";
+    }
 }
 
 }  // namespace cli
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <queue>
 
@@ -7,6 +8,7 @@
 #include "storm-counterexamples/counterexamples/HighLevelCounterexample.h"
 #include "storm-counterexamples/settings/modules/CounterexampleGeneratorSettings.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -22,6 +24,7 @@
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 #include "storm/utility/cli.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 
@@ -1848,126 +1851,215 @@ class SMTMinimalLabelSetGenerator {
         uint_fast64_t iterations = 0;
         uint_fast64_t currentBound = 0;
         uint64_t firstCounterexampleFound = 0;  // The value is not queried before being set.
-        std::vector<double> maximalPropertyValue;
         uint_fast64_t zeroProbabilityCount = 0;
         size_t smallestCounterexampleSize = model.getNumberOfChoices();  // Definitive upper bound
         uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
-        do {
-            ++iterations;
 
-            if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
-                break;
-            }
-            if (result.size() == 0) {
-                STORM_LOG_DEBUG("Sanity check to see whether constraint system is still satisfiable.");
-                STORM_LOG_ASSERT(solver->check() == storm::solver::SmtSolver::CheckResult::Sat, "Constraint system is not satisfiable anymore.");
+        // The candidate label sets are retrieved from the solver in batches. The candidates of a batch are checked concurrently.
+        // To obtain more than one candidate, each candidate is excluded from the search space right after it was found. If several threads are used, the
+        // next batch is already retrieved from the solver while the current batch is being checked. The candidates are processed in the order in which they
+        // were found and the solver is only strengthened by constraints that are valid for all counterexamples. Hence, the first counterexample is still
+        // guaranteed to be minimal. With a single thread, each candidate is checked before the next one is retrieved.
+        uint64_t const batchSize = storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfThreads());
+        bool const retrieveConcurrently = batchSize > 1;
+        bool const computeReachableStates = !rewardName || options.useDynamicConstraints;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> candidates;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> nextCandidates;
+        std::vector<std::pair<std::shared_ptr<storm::models::sparse::Model<T>>, std::vector<storm::storage::FlatSet<uint_fast64_t>>>> candidateSubModels;
+        std::vector<storm::storage::BitVector> candidateReachableStates;
+        std::vector<std::vector<double>> candidatePropertyValues;
+
+        // (7a) Retrieves the next batch of candidates from the solver, given the number of candidates that are still being checked.
+        // Returns false if no further candidates need to be retrieved afterwards.
+        auto retrieveCandidates = [&](std::vector<storm::storage::FlatSet<uint_fast64_t>>& batch, uint64_t numberOfPendingCandidates) {
+            while (batch.size() < batchSize) {
+                uint64_t numberOfRetrievedCandidates = iterations + numberOfPendingCandidates + batch.size();
+                if (result.size() > 0 && numberOfRetrievedCandidates + 1 > firstCounterexampleFound + options.maximumExtraIterations) {
+                    return false;
+                }
+                if (result.size() == 0 && numberOfPendingCandidates == 0 && batch.empty()) {
+                    STORM_LOG_DEBUG("Sanity check to see whether constraint system is still satisfiable.");
+                    STORM_LOG_ASSERT(solver->check() == storm::solver::SmtSolver::CheckResult::Sat, "Constraint system is not satisfiable anymore.");
+                }
+                STORM_LOG_DEBUG("Computing minimal command set.");
+                auto solverStart = std::chrono::high_resolution_clock::now();
+                boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(*solver, variableInformation, currentBound);
+                totalSolverTime += std::chrono::high_resolution_clock::now() - solverStart;
+                if (smallest == boost::none) {
+                    STORM_LOG_DEBUG("No further counterexamples.");
+                    return false;
+                }
+                storm::storage::FlatSet<uint_fast64_t> candidate = std::move(smallest.get());
+                STORM_LOG_DEBUG("Computed minimal command with bound " << currentBound << " and set of size "
+                                                                       << candidate.size() + relevancyInformation.knownLabels.size() << " (" << candidate.size()
+                                                                       << " + " << relevancyInformation.knownLabels.size() << ") ");
+
+                candidate.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
+                candidate.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
+                if (candidate.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
+                    (result.size() > 1 && candidate.size() > options.multipleCounterexampleSizeCap)) {
+                    STORM_LOG_DEBUG("No further counterexamples of similar size.");
+                    return false;
+                }
+                bool allCommands = candidate.size() == nrCommands(symbolicModel);
+                if (!allCommands && (retrieveConcurrently || batch.size() + 1 < batchSize)) {
+                    ruleOutSingleSolution(*solver, candidate, variableInformation, relevancyInformation);
+                }
+                batch.push_back(std::move(candidate));
+                if (allCommands) {
+                    // The candidate is a counterexample, so there is no need to search for further candidates.
+                    return false;
+                }
             }
-            STORM_LOG_DEBUG("Computing minimal command set.");
-            solverClock = std::chrono::high_resolution_clock::now();
-            boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(*solver, variableInformation, currentBound);
-            totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
-            if (smallest == boost::none) {
-                STORM_LOG_DEBUG("No further counterexamples.");
-                break;
+            return true;
+        };
+
+        // (7b) Restricts the given model to the labels of each candidate and computes the reachability probability.
+        auto checkCandidates = [&]() {
+            auto checkingStart = std::chrono::high_resolution_clock::now();
+            candidateSubModels.assign(candidates.size(), {});
+            candidateReachableStates.assign(candidates.size(), storm::storage::BitVector());
+            candidatePropertyValues.assign(candidates.size(), {});
+            storm::utility::parallel::executeTasks(batchSize, candidates.size(), [&](uint64_t candidateIndex, uint64_t) {
+                auto const& candidate = candidates[candidateIndex];
+                if (candidate.size() == nrCommands(symbolicModel)) {
+                    return;
+                }
+                candidateSubModels[candidateIndex] =
+                    restrictModelToLabelSet(model, candidate, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
+                auto const& subModel = *candidateSubModels[candidateIndex].first;
+                if (computeReachableStates) {
+                    candidateReachableStates[candidateIndex] =
+                        storm::utility::graph::getReachableStates(subModel.getTransitionMatrix(), subModel.getInitialStates(), phiStates, psiStates);
+                    if (!rewardName && candidateReachableStates[candidateIndex].isDisjointFrom(psiStates)) {
+                        // No target state is reachable, so there is no need to invoke the model checker.
+                        candidatePropertyValues[candidateIndex].push_back(storm::utility::zero<T>());
+                        return;
+                    }
+                }
+                candidatePropertyValues[candidateIndex] = computeMaximalReachabilityProbability(env, subModel, phiStates, psiStates, rewardName);
+            });
+            totalModelCheckingTime += std::chrono::high_resolution_clock::now() - checkingStart;
+        };
+
+        bool moreCandidates = retrieveCandidates(candidates, 0);
+        while (!done && !candidates.empty()) {
+            nextCandidates.clear();
+            bool const retrieveNextBatch = retrieveConcurrently && moreCandidates;
+            if (retrieveNextBatch) {
+                // The solver is only accessed by the thread that retrieves the next batch.
+                storm::utility::parallel::executeOnThreads(2, [&](uint64_t threadIndex) {
+                    if (threadIndex == 0) {
+                        checkCandidates();
+                    } else {
+                        moreCandidates = retrieveCandidates(nextCandidates, candidates.size());
+                    }
+                });
             } else {
-                commandSet = smallest.get();
-            }
-            STORM_LOG_DEBUG("Computed minimal command with bound " << currentBound << " and set of size "
-                                                                   << commandSet.size() + relevancyInformation.knownLabels.size() << " (" << commandSet.size()
-                                                                   << " + " << relevancyInformation.knownLabels.size() << ") ");
-
-            // Restrict the given model to the current set of labels and compute the reachability probability.
-            modelCheckingClock = std::chrono::high_resolution_clock::now();
-            commandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
-            commandSet.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
-            if (commandSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
-                (result.size() > 1 && commandSet.size() > options.multipleCounterexampleSizeCap)) {
-                STORM_LOG_DEBUG("No further counterexamples of similar size.");
-                break;
-            }
-
-            if (commandSet.size() == nrCommands(symbolicModel)) {
-                result.push_back(commandSet);
-                break;
-            }
-
-            auto subChoiceOrigins = restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
-            std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
-            std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
-
-            // Now determine the maximal reachability probability in the sub-model.
-            maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
-            totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
-
-            // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration
-            // process.
-            analysisClock = std::chrono::high_resolution_clock::now();
-            bool violation = false;
-            for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
-                violation |=
-                    (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
+                checkCandidates();
             }
 
-            if (violation) {
-                if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
-                    ++zeroProbabilityCount;
+            // (7c) Process the candidates in the order in which they were found.
+            for (uint64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+                ++iterations;
+                commandSet = std::move(candidates[candidateIndex]);
+                if (commandSet.size() == nrCommands(symbolicModel)) {
+                    result.push_back(commandSet);
+                    done = true;
+                    break;
+                }
+                if (commandSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
+                    (result.size() > 1 && commandSet.size() > options.multipleCounterexampleSizeCap)) {
+                    // The candidate was retrieved before a counterexample of the previous batch was found.
+                    STORM_LOG_DEBUG("No further counterexamples of similar size.");
+                    done = true;
+                    break;
+                }
+                std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = candidateSubModels[candidateIndex].first;
+                std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = candidateSubModels[candidateIndex].second;
+                std::vector<double> const& maximalPropertyValue = candidatePropertyValues[candidateIndex];
+
+                // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the
+                // iteration process.
+                analysisClock = std::chrono::high_resolution_clock::now();
+                bool violation = false;
+                for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
+                    violation |=
+                        (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
                 }
 
-                if (options.useDynamicConstraints) {
-                    // Determine which of the two analysis techniques to call by performing a reachability analysis.
-                    storm::storage::BitVector reachableStates =
-                        storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
-
-                    if (reachableStates.isDisjointFrom(psiStates)) {
-                        // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
-                        analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                       variableInformation, relevancyInformation);
-                    } else {
-                        // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was insufficient
-                        // to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
-                        analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                               variableInformation, relevancyInformation);
+                if (violation) {
+                    if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
+                        ++zeroProbabilityCount;
                     }
 
-                    if (relevancyInformation.dontCareLabels.size() > 0) {
+                    if (options.useDynamicConstraints) {
+                        // Determine which of the two analysis techniques to call by performing a reachability analysis.
+                        if (candidateReachableStates[candidateIndex].isDisjointFrom(psiStates)) {
+                            // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
+                            analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
+                                                           variableInformation, relevancyInformation);
+                        } else {
+                            // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was
+                            // insufficient to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
+                            analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
+                                                                   variableInformation, relevancyInformation);
+                        }
+
+                        if (relevancyInformation.dontCareLabels.size() > 0) {
+                            ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                        }
+                    } else {
+                        // Do not guide solver, just rule out current solution.
                         ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
                     }
+                } else if (std::any_of(result.begin(), result.end(), [&commandSet](storm::storage::FlatSet<uint_fast64_t> const& counterexample) {
+                               return std::includes(commandSet.begin(), commandSet.end(), counterexample.begin(), counterexample.end());
+                           })) {
+                    // The candidate was retrieved before a counterexample of the same or the previous batch excluded its supersets.
+                    STORM_LOG_DEBUG("Skipping superset of a previously found counterexample.");
                 } else {
-                    // Do not guide solver, just rule out current solution.
-                    ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                    STORM_LOG_DEBUG("Found a counterexample.");
+                    if (result.empty()) {
+                        // If this is the first counterexample we find, we store when we found it.
+                        firstCounterexampleFound = iterations;
+                    }
+                    result.push_back(commandSet);
+                    if (options.maximumCounterexamples > result.size()) {
+                        STORM_LOG_DEBUG("Exclude counterexample for future.");
+                        ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
+                    } else {
+                        STORM_LOG_DEBUG("Stop searching for further counterexamples.");
+                        done = true;
+                    }
+                    smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
                 }
-            } else {
-                STORM_LOG_DEBUG("Found a counterexample.");
-                if (result.empty()) {
-                    // If this is the first counterexample we find, we store when we found it.
-                    firstCounterexampleFound = iterations;
+                totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
+
+                auto now = std::chrono::high_resolution_clock::now();
+                auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                if (static_cast<uint64_t>(durationSinceLastMessage) >= progressDelay || lastSize < commandSet.size()) {
+                    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - totalClock).count();
+                    if (lastSize < commandSet.size()) {
+                        STORM_LOG_DEBUG("Improved lower bound to " << currentBound << " after " << milliseconds << "ms.");
+                        lastSize = commandSet.size();
+                    } else {
+                        STORM_LOG_DEBUG("Lower bound on label set size is " << currentBound << " after " << milliseconds << "ms (checked " << iterations
+                                                                            << " models, " << zeroProbabilityCount << " could not reach the target set).");
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                    }
                 }
-                result.push_back(commandSet);
-                if (options.maximumCounterexamples > result.size()) {
-                    STORM_LOG_DEBUG("Exclude counterexample for future.");
-                    ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
-                } else {
-                    STORM_LOG_DEBUG("Stop searching for further counterexamples.");
+                if (done || (result.size() > 0 && iterations >= firstCounterexampleFound + options.maximumExtraIterations)) {
                     done = true;
+                    break;
                 }
-                smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
             }
-            totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
-
-            auto now = std::chrono::high_resolution_clock::now();
-            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
-            if (static_cast<uint64_t>(durationSinceLastMessage) >= progressDelay || lastSize < commandSet.size()) {
-                auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - totalClock).count();
-                if (lastSize < commandSet.size()) {
-                    STORM_LOG_DEBUG("Improved lower bound to " << currentBound << " after " << milliseconds << "ms.");
-                    lastSize = commandSet.size();
-                } else {
-                    STORM_LOG_DEBUG("Lower bound on label set size is " << currentBound << " after " << milliseconds << "ms (checked " << iterations
-                                                                        << " models, " << zeroProbabilityCount << " could not reach the target set).");
-                    timeOfLastMessage = std::chrono::high_resolution_clock::now();
-                }
+
+            if (!done && !retrieveNextBatch && moreCandidates) {
+                moreCandidates = retrieveCandidates(nextCandidates, 0);
             }
-        } while (!done);
+            candidates.swap(nextCandidates);
+        }
 
         // Compute and emit the time measurements if the corresponding flag was set.
         totalTime = std::chrono::high_resolution_clock::now() - totalClock;
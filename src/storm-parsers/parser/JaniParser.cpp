@@ -32,9 +32,13 @@
 #include <boost/lexical_cast.hpp>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <set>
 #include <sstream>
 
 #include "storm/io/file.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -81,34 +85,273 @@ int64_t getSignedInt(typename JaniParser<ValueType>::Json const& structure, std:
     return structure.front();
 }
 
+namespace {
+/*!
+ * Thrown while reading the input if a member of the model is read after a member that requires it has already been translated.
+ */
+struct MemberOrderConflict {};
+
+/*!
+ * Retrieves the members of a model that are required for translating the given member.
+ */
+std::set<std::string> const& getRequiredMembers(std::string const& member) {
+    static const std::map<std::string, std::set<std::string>> requiredMembers = {
+        {"variables", {"constants"}},
+        {"functions", {"constants", "variables"}},
+        {"automata", {"jani-version", "name", "type", "features", "actions", "constants", "variables", "functions"}}};
+    static const std::set<std::string> noRequiredMembers;
+    auto requiredMembersIt = requiredMembers.find(member);
+    return requiredMembersIt == requiredMembers.end() ? noRequiredMembers : requiredMembersIt->second;
+}
+}  // namespace
+
 template<typename ValueType>
 std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parse(std::string const& path, bool parseProperties) {
+    {
+        JaniParser parser;
+        if (parser.readFile(path, parseProperties)) {
+            return parser.parseModel(parseProperties);
+        }
+    }
+    // The members of the input are not given in an order that allows translating them while reading, so we read the input again.
     JaniParser parser;
-    parser.readFile(path);
+    parser.readFile(path, parseProperties, false);
     return parser.parseModel(parseProperties);
 }
 
 template<typename ValueType>
 std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parseFromString(std::string const& jsonstring, bool parseProperties) {
-    JaniParser parser(jsonstring);
+    {
+        JaniParser parser;
+        if (parser.read(jsonstring, parseProperties, true)) {
+            return parser.parseModel(parseProperties);
+        }
+    }
+    JaniParser parser(jsonstring, parseProperties);
     return parser.parseModel(parseProperties);
 }
 
 template<typename ValueType>
-JaniParser<ValueType>::JaniParser(std::string const& jsonstring) : expressionManager(new storm::expressions::ExpressionManager()) {
-    parsedStructure = Json::parse(jsonstring);
+JaniParser<ValueType>::JaniParser() : expressionManager(new storm::expressions::ExpressionManager()) {
+    // Sharing has to be enabled before the first expression is created, as expressions are only shared if their operands are.
+    if (storm::settings::hasModule<storm::settings::modules::BuildSettings>() &&
+        storm::settings::getModule<storm::settings::modules::BuildSettings>().isShareExpressionsSet()) {
+        expressionManager->setExpressionSharing(true);
+    }
 }
 
 template<typename ValueType>
-void JaniParser<ValueType>::readFile(std::string const& path) {
+JaniParser<ValueType>::JaniParser(std::string const& jsonstring, bool parseProperties) : JaniParser() {
+    read(jsonstring, parseProperties, false);
+}
+
+template<typename ValueType>
+bool JaniParser<ValueType>::readFile(std::string const& path, bool parseProperties, bool translateWhileReading) {
     std::ifstream file;
     storm::utility::openFile(path, file);
-    file >> parsedStructure;
+    bool result = read(file, parseProperties, translateWhileReading);
     storm::utility::closeFile(file);
+    return result;
 }
 
 template<typename ValueType>
-std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parseModel(bool parseProperties) {
+template<typename InputType>
+bool JaniParser<ValueType>::read(InputType&& input, bool parseProperties, bool translateWhileReading) {
+    try {
+        // The members of the model are moved to the parsed structure while reading, so the returned root only contains copies of the primitive members.
+        Json root = Json::parse(std::forward<InputType>(input), getParserCallback(parseProperties, translateWhileReading));
+    } catch (MemberOrderConflict const&) {
+        return false;
+    }
+    return true;
+}
+
+template<typename ValueType>
+typename JaniParser<ValueType>::Json::parser_callback_t JaniParser<ValueType>::getParserCallback(bool parseProperties, bool translateWhileReading) {
+    return [this, parseProperties, translateWhileReading](int depth, typename Json::parse_event_t event, Json& parsed) {
+        return handleParserEvent(depth, event, parsed, parseProperties, translateWhileReading);
+    };
+}
+
+template<typename ValueType>
+bool JaniParser<ValueType>::handleParserEvent(int depth, typename Json::parse_event_t event, Json& parsed, bool parseProperties, bool translateWhileReading) {
+    if (depth == 1 && event == Json::parse_event_t::key) {
+        currentMember = parsed.template get<std::string>();
+        currentMemberIsArray = false;
+        translateCurrentMember = false;
+        if (!parseProperties && currentMember == "properties") {
+            // The properties are skipped, so that they are never stored.
+            return false;
+        }
+        STORM_LOG_THROW(readMembers.insert(currentMember).second, storm::exceptions::InvalidJaniException,
+                        "Member '" << currentMember << "' of the model is given more than once.");
+        for (auto const& translatedMember : translatedMembers) {
+            if (getRequiredMembers(translatedMember).count(currentMember) > 0) {
+                throw MemberOrderConflict();
+            }
+        }
+        // Automata can only be translated once the model exists. Function definitions are usually few, so they and the automata are only translated
+        // while reading if the global variables are already known. If a member that is required for the translation is read later on, the input is
+        // read again.
+        bool variablesRead = readMembers.count("variables") > 0;
+        translateCurrentMember = translateWhileReading && (currentMember == "constants" || currentMember == "variables" ||
+                                                           (currentMember == "functions" && variablesRead) ||
+                                                           (currentMember == "automata" && variablesRead && readMembers.count("jani-version") > 0 &&
+                                                            readMembers.count("name") > 0 && readMembers.count("type") > 0));
+        if (translateCurrentMember) {
+            translatedMembers.insert(currentMember);
+        }
+        return true;
+    }
+    if (depth == 1 && event == Json::parse_event_t::array_start) {
+        currentMemberIsArray = true;
+        return true;
+    }
+    if (translateCurrentMember && currentMemberIsArray && currentMember != "functions" && depth == 2 && event == Json::parse_event_t::object_end) {
+        // An element of the array has been read completely, so we translate it and release it.
+        translate(parsed);
+        return false;
+    }
+    if (depth == 1 && (event == Json::parse_event_t::value || event == Json::parse_event_t::object_end || event == Json::parse_event_t::array_end)) {
+        if (translateCurrentMember) {
+            STORM_LOG_THROW(event == Json::parse_event_t::array_end, storm::exceptions::InvalidJaniException,
+                            "Member '" << currentMember << "' of the model must be an array.");
+            if (currentMember == "functions") {
+                translate(parsed);
+            } else {
+                for (auto const& element : parsed) {
+                    translate(element);
+                }
+            }
+            return false;
+        }
+        if (event == Json::parse_event_t::value) {
+            parsedStructure[currentMember] = parsed;
+            return true;
+        }
+        parsedStructure[currentMember] = std::move(parsed);
+        return false;
+    }
+    return true;
+}
+
+template<typename ValueType>
+void JaniParser<ValueType>::translate(Json const& structure) {
+    try {
+        if (currentMember == "constants") {
+            addConstant(structure);
+        } else if (currentMember == "variables") {
+            addVariable(structure);
+        } else if (currentMember == "functions") {
+            addFunctionDefinitions(structure);
+        } else {
+            assert(currentMember == "automata");
+            addAutomaton(structure);
+        }
+    } catch (storm::exceptions::BaseException const&) {
+        // The translation fails if it refers to declarations that are only given later on. In this case, the input is read again.
+        for (auto const& requiredMember : getRequiredMembers(currentMember)) {
+            if (readMembers.count(requiredMember) == 0) {
+                throw MemberOrderConflict();
+            }
+        }
+        throw;
+    }
+}
+
+template<typename ValueType>
+typename JaniParser<ValueType>::Scope JaniParser<ValueType>::getGlobalScope() const {
+    std::string description = "global";
+    if (parsedStructure.count("name") == 1 && parsedStructure.at("name").is_string()) {
+        description = parsedStructure.at("name").template get<std::string>();
+    }
+    return Scope(description, &constants, &globalVariables, &globalFunctions);
+}
+
+template<typename ValueType>
+void JaniParser<ValueType>::addConstant(Json const& constantStructure) {
+    STORM_LOG_ASSERT(!translatedModel, "Constants can not be added after the model has been created.");
+    // Constants may only refer to previously declared constants.
+    Scope scope = getGlobalScope();
+    scope.clearVariables();
+    scope.globalFunctions = nullptr;
+    std::shared_ptr<storm::jani::Constant> constant = parseConstant(constantStructure, scope.refine("constants[" + std::to_string(constants.size()) + "]"));
+    constants.emplace(constant->getName(), constant.get());
+    constantDeclarations.push_back(std::move(constant));
+}
+
+template<typename ValueType>
+void JaniParser<ValueType>::addVariable(Json const& variableStructure) {
+    STORM_LOG_ASSERT(!translatedModel, "Variables can not be added after the model has been created.");
+    Scope scope = getGlobalScope();
+    scope.globalFunctions = nullptr;
+    std::shared_ptr<storm::jani::Variable> variable =
+        parseVariable(variableStructure, scope.refine("variables[" + std::to_string(globalVariables.size()) + "]"));
+    globalVariables.emplace(variable->getName(), variable.get());
+    variableDeclarations.push_back(std::move(variable));
+}
+
+template<typename ValueType>
+void JaniParser<ValueType>::addFunctionDefinitions(Json const& functionsStructure) {
+    STORM_LOG_ASSERT(!translatedModel, "Function definitions can not be added after the model has been created.");
+    Scope scope = getGlobalScope();
+    // We require two passes through the function definitions array to allow referring to functions before they were defined.
+    std::vector<storm::jani::FunctionDefinition> dummyFunctionDefinitions;
+    for (auto const& funStructure : functionsStructure) {
+        // Skip parsing of function body
+        dummyFunctionDefinitions.push_back(
+            parseFunctionDefinition(funStructure, scope.refine("functions[" + std::to_string(dummyFunctionDefinitions.size()) + "]"), true));
+    }
+    // Store references to the dummy function definitions. This needs to happen in a separate loop since otherwise, references to FunDefs can be invalidated
+    // after calling dummyFunctionDefinitions.push_back
+    for (auto const& funDef : dummyFunctionDefinitions) {
+        bool unused = globalFunctions.emplace(funDef.getName(), &funDef).second;
+        STORM_LOG_THROW(unused, storm::exceptions::InvalidJaniException,
+                        "Multiple definitions of functions with the name " << funDef.getName() << " in " << scope.description);
+    }
+    uint64_t functionIndex = 0;
+    for (auto const& funStructure : functionsStructure) {
+        // Actually parse the function body
+        storm::jani::FunctionDefinition funDef =
+            parseFunctionDefinition(funStructure, scope.refine("functions[" + std::to_string(functionIndex++) + "]"), false);
+        assert(globalFunctions.count(funDef.getName()) == 1);
+        std::string funName = funDef.getName();
+        globalFunctions[funName] = &functionDefinitions.insert_or_assign(funName, std::move(funDef)).first->second;
+    }
+}
+
+template<typename ValueType>
+void JaniParser<ValueType>::addAutomaton(Json const& automatonStructure) {
+    storm::jani::Model& model = getModel();
+    model.addAutomaton(parseAutomaton(automatonStructure, model, getGlobalScope().refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
+}
+
+template<typename ValueType>
+storm::jani::Model& JaniParser<ValueType>::getModel() {
+    if (translatedModel) {
+        return *translatedModel;
+    }
+
+    // Translate the declarations that have not been translated while reading the input. The translated parts of the input are released on the way.
+    if (parsedStructure.count("constants") == 1) {
+        for (auto& constStructure : parsedStructure.at("constants")) {
+            addConstant(constStructure);
+            constStructure = Json();
+        }
+        parsedStructure.erase("constants");
+    }
+    if (parsedStructure.count("variables") == 1) {
+        for (auto& varStructure : parsedStructure.at("variables")) {
+            addVariable(varStructure);
+            varStructure = Json();
+        }
+        parsedStructure.erase("variables");
+    }
+    if (parsedStructure.count("functions") == 1) {
+        addFunctionDefinitions(parsedStructure.at("functions"));
+        parsedStructure.erase("functions");
+    }
+
     // jani-version
     STORM_LOG_THROW(parsedStructure.count("jani-version") == 1, storm::exceptions::InvalidJaniException, "Jani-version must be given exactly once.");
     uint64_t version = getUnsignedInt<ValueType>(parsedStructure.at("jani-version"), "jani version");
@@ -121,7 +364,7 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
     std::string modeltypestring = getString<ValueType>(parsedStructure.at("type"), "type of the model");
     storm::jani::ModelType type = storm::jani::getModelType(modeltypestring);
     STORM_LOG_THROW(type != storm::jani::ModelType::UNDEFINED, storm::exceptions::InvalidJaniException, "model type " + modeltypestring + " not recognized");
-    storm::jani::Model model(name, type, version, expressionManager);
+    translatedModel = std::make_unique<storm::jani::Model>(name, type, version, expressionManager);
     uint_fast64_t featuresCount = parsedStructure.count("features");
     STORM_LOG_THROW(featuresCount < 2, storm::exceptions::InvalidJaniException, "features-declarations can be given at most once.");
     if (featuresCount == 1) {
@@ -131,7 +374,7 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             bool found = false;
             for (auto const& knownFeature : allKnownModelFeatures.asSet()) {
                 if (featureStr == storm::jani::toString(knownFeature)) {
-                    model.getModelFeatures().add(knownFeature);
+                    translatedModel->getModelFeatures().add(knownFeature);
                     found = true;
                     break;
                 }
@@ -142,74 +385,43 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
     uint_fast64_t actionCount = parsedStructure.count("actions");
     STORM_LOG_THROW(actionCount < 2, storm::exceptions::InvalidJaniException, "Action-declarations can be given at most once.");
     if (actionCount > 0) {
-        parseActions(parsedStructure.at("actions"), model);
-    }
-
-    Scope scope(name);
-
-    // Parse constants
-    ConstantsMap constants;
-    scope.constants = &constants;
-    uint_fast64_t constantsCount = parsedStructure.count("constants");
-    STORM_LOG_THROW(constantsCount < 2, storm::exceptions::InvalidJaniException, "Constant-declarations can be given at most once.");
-    if (constantsCount == 1) {
-        // Reserve enough space to make sure that pointers to constants remain valid after adding new ones.
-        model.getConstants().reserve(parsedStructure.at("constants").size());
-        for (auto const& constStructure : parsedStructure.at("constants")) {
-            std::shared_ptr<storm::jani::Constant> constant =
-                parseConstant(constStructure, scope.refine("constants[" + std::to_string(constants.size()) + "]"));
-            model.addConstant(*constant);
-            assert(model.getConstants().back().getName() == constant->getName());
-            constants.emplace(constant->getName(), &model.getConstants().back());
-        }
+        parseActions(parsedStructure.at("actions"), *translatedModel);
     }
 
-    // Parse variables
-    uint_fast64_t variablesCount = parsedStructure.count("variables");
-    STORM_LOG_THROW(variablesCount < 2, storm::exceptions::InvalidJaniException, "Variable-declarations can be given at most once for global variables.");
-    VariablesMap globalVars;
-    scope.globalVars = &globalVars;
-    if (variablesCount == 1) {
-        for (auto const& varStructure : parsedStructure.at("variables")) {
-            std::shared_ptr<storm::jani::Variable> variable = parseVariable(varStructure, scope.refine("variables[" + std::to_string(globalVars.size())));
-            globalVars.emplace(variable->getName(), &model.addVariable(*variable));
-        }
+    // Move the translated declarations to the model and let the scope refer to the declarations of the model from now on.
+    // Reserve enough space to make sure that pointers to constants remain valid after adding new ones.
+    translatedModel->getConstants().reserve(constantDeclarations.size());
+    for (auto const& constant : constantDeclarations) {
+        translatedModel->addConstant(*constant);
+        assert(translatedModel->getConstants().back().getName() == constant->getName());
+        constants[constant->getName()] = &translatedModel->getConstants().back();
     }
-
-    uint64_t funDeclCount = parsedStructure.count("functions");
-    STORM_LOG_THROW(funDeclCount < 2, storm::exceptions::InvalidJaniException, "Model '" << name << "' has more than one list of functions");
-    FunctionsMap globalFuns;
-    scope.globalFunctions = &globalFuns;
-    if (funDeclCount > 0) {
-        // We require two passes through the function definitions array to allow referring to functions before they were defined.
-        std::vector<storm::jani::FunctionDefinition> dummyFunctionDefinitions;
-        for (auto const& funStructure : parsedStructure.at("functions")) {
-            // Skip parsing of function body
-            dummyFunctionDefinitions.push_back(
-                parseFunctionDefinition(funStructure, scope.refine("functions[" + std::to_string(globalFuns.size()) + "] of model " + name), true));
-        }
-        // Store references to the dummy function definitions. This needs to happen in a separate loop since otherwise, references to FunDefs can be invalidated
-        // after calling dummyFunctionDefinitions.push_back
-        for (auto const& funDef : dummyFunctionDefinitions) {
-            bool unused = globalFuns.emplace(funDef.getName(), &funDef).second;
-            STORM_LOG_THROW(unused, storm::exceptions::InvalidJaniException,
-                            "Multiple definitions of functions with the name " << funDef.getName() << " in " << scope.description);
-        }
-        for (auto const& funStructure : parsedStructure.at("functions")) {
-            // Actually parse the function body
-            storm::jani::FunctionDefinition funDef =
-                parseFunctionDefinition(funStructure, scope.refine("functions[" + std::to_string(globalFuns.size()) + "] of model " + name), false);
-            assert(globalFuns.count(funDef.getName()) == 1);
-            globalFuns[funDef.getName()] = &model.addFunctionDefinition(funDef);
-        }
+    constantDeclarations.clear();
+    for (auto const& variable : variableDeclarations) {
+        globalVariables[variable->getName()] = &translatedModel->addVariable(*variable);
     }
+    variableDeclarations.clear();
+    for (auto const& funDef : functionDefinitions) {
+        globalFunctions[funDef.first] = &translatedModel->addFunctionDefinition(funDef.second);
+    }
+    functionDefinitions.clear();
+    return *translatedModel;
+}
+
+template<typename ValueType>
+std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parseModel(bool parseProperties) {
+    storm::jani::Model& model = getModel();
+    Scope scope = getGlobalScope();
 
     // Parse Automata
-    STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
-    STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
-    // Automatons can only be parsed after constants and variables.
-    for (auto const& automataEntry : parsedStructure.at("automata")) {
-        model.addAutomaton(parseAutomaton(automataEntry, model, scope.refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
+    if (translatedMembers.count("automata") == 0) {
+        STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
+        STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
+        // Automatons can only be parsed after constants and variables.
+        for (auto& automataEntry : parsedStructure.at("automata")) {
+            addAutomaton(automataEntry);
+            automataEntry = Json();
+        }
     }
     STORM_LOG_THROW(parsedStructure.count("restrict-initial") < 2, storm::exceptions::InvalidJaniException, "Model has multiple initial value restrictions");
     storm::expressions::Expression initialValueRestriction = expressionManager->boolean(true);
@@ -230,7 +442,7 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
     std::vector<storm::jani::Property> properties;
     if (parseProperties && parsedStructure.count("properties") == 1) {
         STORM_LOG_THROW(parsedStructure.at("properties").is_array(), storm::exceptions::InvalidJaniException, "Properties should be an array");
-        for (auto const& propertyEntry : parsedStructure.at("properties")) {
+        for (auto& propertyEntry : parsedStructure.at("properties")) {
             try {
                 auto prop = this->parseProperty(model, propertyEntry, scope.refine("property[" + std::to_string(properties.size()) + "]"));
                 // Eliminate reward accumulations as much as possible
@@ -241,9 +453,10 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             } catch (storm::exceptions::NotImplementedException const& ex) {
                 STORM_LOG_WARN("Cannot handle property: " << ex.what());
             }
+            propertyEntry = Json();
         }
     }
-    return {model, properties};
+    return {std::move(model), properties};
 }
 
 template<typename ValueType>
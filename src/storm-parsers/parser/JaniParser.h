@@ -38,13 +38,17 @@ class JaniParser {
     typedef std::unordered_map<std::string, storm::jani::FunctionDefinition const*> FunctionsMap;
     typedef storm::json<ValueType> Json;
 
-    JaniParser() : expressionManager(new storm::expressions::ExpressionManager()) {}
-    JaniParser(std::string const& jsonstring);
+    JaniParser();
+    JaniParser(std::string const& jsonstring, bool parseProperties = true);
     static std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parse(std::string const& path, bool parseProperties = true);
     static std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parseFromString(std::string const& jsonstring, bool parseProperties = true);
 
    protected:
-    void readFile(std::string const& path);
+    /*!
+     * Reads the given file. If requested, the model is translated while reading (see handleParserEvent).
+     * @return false if the members of the model are not given in an order that allows translating them while reading.
+     */
+    bool readFile(std::string const& path, bool parseProperties = true, bool translateWhileReading = true);
 
     struct Scope {
         Scope(std::string description = "global", ConstantsMap const* constants = nullptr, VariablesMap const* globalVars = nullptr,
@@ -78,6 +82,9 @@ class JaniParser {
         }
     };
 
+    /*!
+     * Translates the remaining parsed structure into a model (and its properties). The translated parts of the structure are released on the way.
+     */
     std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parseModel(bool parseProperties = true);
     storm::jani::Property parseProperty(storm::jani::Model& model, storm::json<ValueType> const& propertyStructure, Scope const& scope);
     storm::jani::Automaton parseAutomaton(storm::json<ValueType> const& automatonStructure, storm::jani::Model const& parentModel, Scope const& scope);
@@ -91,6 +98,41 @@ class JaniParser {
                                                    std::unordered_map<std::string, storm::expressions::Variable> const& auxiliaryVariables = {});
 
    private:
+    template<typename InputType>
+    bool read(InputType&& input, bool parseProperties, bool translateWhileReading);
+
+    /*!
+     * Retrieves the callback that is used while reading the input.
+     */
+    typename Json::parser_callback_t getParserCallback(bool parseProperties, bool translateWhileReading);
+
+    /*!
+     * Handles an event of the parser while reading the input. The properties are skipped if they are not parsed. If requested, constants, variables,
+     * function definitions and (once the model header and the global variables are known) automata are translated as soon as they have been read, so
+     * that they are never stored completely. All other top-level members are moved to the parsed structure.
+     * @return false if the given part of the input is not to be stored.
+     */
+    bool handleParserEvent(int depth, typename Json::parse_event_t event, Json& parsed, bool parseProperties, bool translateWhileReading);
+
+    /*!
+     * Translates the given element of the member that is currently read (or all function definitions, if these are read).
+     */
+    void translate(Json const& structure);
+
+    /*!
+     * Retrieves the scope that contains all global declarations.
+     */
+    Scope getGlobalScope() const;
+    void addConstant(Json const& constantStructure);
+    void addVariable(Json const& variableStructure);
+    void addFunctionDefinitions(Json const& functionsStructure);
+    void addAutomaton(Json const& automatonStructure);
+
+    /*!
+     * Retrieves the model, which is created on the first call. All global declarations have to be translated before.
+     */
+    storm::jani::Model& getModel();
+
     std::shared_ptr<storm::jani::Constant> parseConstant(storm::json<ValueType> const& constantStructure, Scope const& scope);
     storm::jani::FunctionDefinition parseFunctionDefinition(storm::json<ValueType> const& functionDefinitionStructure, Scope const& scope, bool firstPass,
                                                             std::string const& parameterNamePrefix = "");
@@ -128,6 +170,27 @@ class JaniParser {
      * The overall structure currently under inspection.
      */
     storm::json<ValueType> parsedStructure;
+
+    /**
+     * The top-level member of the input that is currently read, whether it is an array and whether it is translated while reading.
+     */
+    std::string currentMember;
+    bool currentMemberIsArray = false;
+    bool translateCurrentMember = false;
+    std::set<std::string> readMembers;
+    std::set<std::string> translatedMembers;
+
+    /**
+     * The global declarations that have been translated before the model was created.
+     */
+    std::vector<std::shared_ptr<storm::jani::Constant>> constantDeclarations;
+    std::vector<std::shared_ptr<storm::jani::Variable>> variableDeclarations;
+    std::unordered_map<std::string, storm::jani::FunctionDefinition> functionDefinitions;
+    ConstantsMap constants;
+    VariablesMap globalVariables;
+    FunctionsMap globalFunctions;
+    std::unique_ptr<storm::jani::Model> translatedModel;
+
     /**
      * The expression manager to be used.
      */
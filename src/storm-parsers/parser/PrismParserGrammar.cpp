@@ -8,6 +8,8 @@
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/io/file.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/storage/BitVector.h"
@@ -91,6 +93,12 @@ PrismParserGrammar::PrismParserGrammar(std::string const& filename, Iterator fir
       annotate(first),
       manager(new storm::expressions::ExpressionManager()),
       expressionParser(new ExpressionParser(*manager, keywords_, false, false)) {
+    // Sharing has to be enabled before the first expression is created, as expressions are only shared if their operands are.
+    if (storm::settings::hasModule<storm::settings::modules::BuildSettings>() &&
+        storm::settings::getModule<storm::settings::modules::BuildSettings>().isShareExpressionsSet()) {
+        manager->setExpressionSharing(true);
+    }
+
     ExpressionParser& expression_ = *expressionParser;
     boolExpression = (expression_[qi::_val = qi::_1])[qi::_pass = phoenix::bind(&PrismParserGrammar::isOfBoolType, phoenix::ref(*this), qi::_val)];
     boolExpression.name("boolean expression");
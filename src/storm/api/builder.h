@@ -23,6 +23,9 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/file.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -44,6 +47,9 @@ std::shared_ptr<storm::models::symbolic::Model<LibraryType, ValueType>> buildSym
             options.buildAllRewardModels = true;
             options.terminalStates.clear();
         }
+        if (storm::settings::hasModule<storm::settings::modules::BuildSettings>()) {
+            options.variableOrderHeuristic = storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderHeuristic();
+        }
 
         storm::builder::DdPrismModelBuilder<LibraryType, ValueType> builder;
         return builder.build(model.asPrismProgram(), options);
@@ -59,6 +65,9 @@ std::shared_ptr<storm::models::symbolic::Model<LibraryType, ValueType>> buildSym
         } else {
             options.applyMaximumProgressAssumption = (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MA && applyMaximumProgress);
         }
+        if (storm::settings::hasModule<storm::settings::modules::BuildSettings>()) {
+            options.variableOrderHeuristic = storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderHeuristic();
+        }
 
         storm::builder::DdJaniModelBuilder<LibraryType, ValueType> builder;
         return builder.build(model.asJaniModel(), options);
@@ -108,6 +117,24 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm:
     return builder.build();
 }
 
+/*!
+ * Explores the given model and writes it to the given file in the drn format without building it in memory.
+ *
+ * @param model SymbolicModelDescription of the model
+ * @param options Builder options
+ * @param filename The file to write to
+ * @param parameterNames The names of the parameters of the model
+ */
+template<typename ValueType>
+void exportSparseModelAsDrnWhileBuilding(storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options,
+                                         std::string const& filename, std::vector<std::string> const& parameterNames = {}) {
+    storm::builder::ExplicitModelBuilder<ValueType> builder = makeExplicitModelBuilder<ValueType>(model, options);
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    builder.exportModelAsDrn(stream, parameterNames);
+    storm::utility::closeFile(stream);
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& model,
                                                                           std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
@@ -51,23 +51,20 @@ template<typename ValueType>
 typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithExplorationEngine(
     storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
     storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
-    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Exploration engine is currently only applicable to PRISM models.");
-    storm::prism::Program const& program = model.asPrismProgram();
-
     std::unique_ptr<storm::modelchecker::CheckResult> result;
-    if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
-        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+    if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model);
         if (checker.canHandle(task)) {
             result = checker.check(env, task);
         }
-    } else if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
-        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> checker(program);
+    } else if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> checker(model);
         if (checker.canHandle(task)) {
             result = checker.check(env, task);
         }
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
-                        "The model type " << program.getModelType() << " is not supported by the exploration engine.");
+                        "The model type " << model.getModelType() << " is not supported by the exploration engine.");
     }
 
     return result;
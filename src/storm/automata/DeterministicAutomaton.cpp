@@ -46,6 +46,15 @@ std::size_t DeterministicAutomaton::getNumberOfEdgesPerState() const {
     return edgesPerState;
 }
 
+bool DeterministicAutomaton::isSink(std::size_t state) const {
+    for (std::size_t index = state * edgesPerState; index < (state + 1) * edgesPerState; ++index) {
+        if (successors.at(index) != state) {
+            return false;
+        }
+    }
+    return true;
+}
+
 AcceptanceCondition::ptr DeterministicAutomaton::getAcceptance() const {
     return acceptance;
 }
@@ -25,6 +25,11 @@ class DeterministicAutomaton {
     std::size_t getNumberOfStates() const;
     std::size_t getNumberOfEdgesPerState() const;
 
+    /*!
+     * Retrieves whether the given state is a sink, i.e., whether all its outgoing transitions are self-loops.
+     */
+    bool isSink(std::size_t state) const;
+
     std::shared_ptr<AcceptanceCondition> getAcceptance() const;
 
     void printHOA(std::ostream& out) const;
@@ -51,6 +51,7 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       inferObservationsFromActions(false),
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
+      cacheSynchronizations(false),
       reservedBitsForUnboundedVariables(32),
       showProgress(false),
       showProgressDelay(0) {
@@ -182,6 +183,10 @@ bool BuilderOptions::isAddOutOfBoundsStateSet() const {
     return addOutOfBoundsState;
 }
 
+bool BuilderOptions::isCacheSynchronizationsSet() const {
+    return cacheSynchronizations;
+}
+
 uint64_t BuilderOptions::getReservedBitsForUnboundedVariables() const {
     return reservedBitsForUnboundedVariables;
 }
@@ -281,6 +286,11 @@ BuilderOptions& BuilderOptions::setAddOutOfBoundsState(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setCacheSynchronizations(bool newValue) {
+    cacheSynchronizations = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::setReservedBitsForUnboundedVariables(uint64_t newValue) {
     reservedBitsForUnboundedVariables = newValue;
     return *this;
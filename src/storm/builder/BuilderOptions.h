@@ -118,6 +118,7 @@ class BuilderOptions {
     bool isShowProgressSet() const;
     bool isScaleAndLiftTransitionRewardsSet() const;
     bool isAddOutOfBoundsStateSet() const;
+    bool isCacheSynchronizationsSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
     uint64_t getShowProgressDelay() const;
@@ -200,6 +201,13 @@ class BuilderOptions {
      */
     BuilderOptions& setAddOutOfBoundsState(bool newValue = true);
 
+    /**
+     * Should the synchronizations of JANI models be cached per location vector
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setCacheSynchronizations(bool newValue = true);
+
     /**
      * Should a state be labelled for overlapping guards
      * @param newValue the new value (default true)
@@ -268,6 +276,9 @@ class BuilderOptions {
     /// A flag indicating that the an additional state for out of bounds should be created.
     bool addOutOfBoundsState;
 
+    /// A flag indicating whether the synchronizations of JANI models are cached per location vector.
+    bool cacheSynchronizations;
+
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
@@ -108,20 +108,28 @@ DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool
       buildAllRewardModels(buildAllRewardModels),
       applyMaximumProgressAssumption(applyMaximumProgressAssumption),
       rewardModelsToBuild(),
-      constantDefinitions() {
+      constantDefinitions(),
+      variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration) {
     // Intentionally left empty.
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula)
-    : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      constantDefinitions(),
+      variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration) {
     this->preserveFormula(formula);
     this->setTerminalStatesFromFormula(formula);
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
-    : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+    : buildAllLabels(false),
+      buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      constantDefinitions(),
+      variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration) {
     if (!formulas.empty()) {
         for (auto const& formula : formulas) {
             this->preserveFormula(*formula);
@@ -301,8 +309,9 @@ struct CompositionVariables {
 template<storm::dd::DdType Type, typename ValueType>
 class CompositionVariableCreator : public storm::jani::CompositionVisitor {
    public:
-    CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation)
-        : model(model), automata(), actionInformation(actionInformation) {
+    CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation,
+                               storm::builder::DdVariableOrderHeuristic variableOrderHeuristic = storm::builder::DdVariableOrderHeuristic::Declaration)
+        : model(model), automata(), actionInformation(actionInformation), variableOrderHeuristic(variableOrderHeuristic) {
         // Intentionally left empty.
     }
 
@@ -379,37 +388,39 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
         }
 
-        for (auto const& automatonName : this->automata) {
-            storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
-
-            // Start by creating a meta variable for the location of the automaton.
-            storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-            result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-            result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-            result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-            result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-
-            // Add the location variable to the row/column variables.
-            result.rowMetaVariables.insert(variablePair.first);
-            result.columnMetaVariables.insert(variablePair.second);
-
-            // Add the legal range for the location variables.
-            result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-            result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+        // Create the meta variables for the locations of the automata and the non-transient variables. Since the DD
+        // variables of each meta variable are placed below the existing ones, the order of creation determines the
+        // variable order of the DDs.
+        std::map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomatonMap;
+        std::map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariableMap;
+        for (auto const& automaton : this->model.getAutomata()) {
+            if (this->automata.count(automaton.getName()) > 0) {
+                locationVariableToAutomatonMap.emplace(automaton.getLocationExpressionVariable(), &automaton);
+            }
+            for (auto const& variable : automaton.getVariables()) {
+                expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+            }
+        }
+        for (auto const& variable : this->model.getGlobalVariables()) {
+            expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+        }
+        for (auto const& expressionVariable : storm::builder::computeDdVariableOrder(this->model, variableOrderHeuristic)) {
+            auto automatonIt = locationVariableToAutomatonMap.find(expressionVariable);
+            if (automatonIt != locationVariableToAutomatonMap.end()) {
+                createLocationVariable(*automatonIt->second, result);
+            } else if (expressionVariableToVariableMap.count(expressionVariable) > 0) {
+                createVariable(*expressionVariableToVariableMap.at(expressionVariable), result);
+            }
         }
 
-        // Create global variables.
+        // Create the ranges of the global variables.
         storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
         for (auto const& variable : this->model.getGlobalVariables()) {
-            // Only create the variable if it's non-transient.
+            // Only consider the variable if it's non-transient.
             if (variable.isTransient()) {
                 continue;
             }
 
-            createVariable(variable, result);
             globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
         }
         result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
@@ -426,14 +437,13 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             identity &= variableIdentity;
             range &= result.manager->getRange(locationVariables.first);
 
-            // Then create variables for the variables of the automaton.
+            // Then add the identities and ranges of the variables of the automaton.
             for (auto const& variable : automaton.getVariables()) {
-                // Only create the variable if it's non-transient.
+                // Only consider the variable if it's non-transient.
                 if (variable.isTransient()) {
                     continue;
                 }
 
-                createVariable(variable, result);
                 identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                 range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
             }
@@ -451,6 +461,25 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         return result;
     }
 
+    void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+        storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+            result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+        result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+        result.rowColumnMetaVariablePairs.push_back(variablePair);
+
+        result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+        result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+
+        // Add the location variable to the row/column variables.
+        result.rowMetaVariables.insert(variablePair.first);
+        result.columnMetaVariables.insert(variablePair.second);
+
+        // Add the legal range for the location variables.
+        result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+        result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+    }
+
     void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
         auto const& type = variable.getType();
         if (type.isBasicType() && type.asBasicType().isBooleanType()) {
@@ -518,6 +547,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
     storm::jani::Model const& model;
     std::set<std::string> automata;
     storm::jani::CompositionInformation actionInformation;
+    storm::builder::DdVariableOrderHeuristic variableOrderHeuristic;
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -2344,7 +2374,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     storm::jani::CompositionInformation actionInformation = visitor.getInformation();
 
     // Create all necessary variables.
-    CompositionVariableCreator<Type, ValueType> variableCreator(model, actionInformation);
+    CompositionVariableCreator<Type, ValueType> variableCreator(model, actionInformation, options.variableOrderHeuristic);
     CompositionVariables<Type, ValueType> variables = variableCreator.create(manager);
 
     // Determine which transient assignments need to be considered in the building process.
@@ -2403,6 +2433,10 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     modelComponents.rewardModels =
         buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, model.getModelType(), variables, system, rewardVariables);
 
+    STORM_LOG_INFO("Transition matrix has " << modelComponents.transitionMatrix.getNodeCount() << " nodes and reachable states have "
+                                            << modelComponents.reachableStates.getNodeCount() << " nodes using the '" << options.variableOrderHeuristic
+                                            << "' variable order.");
+
     // Finally, create the model.
     return createModel(model.getModelType(), variables, modelComponents);
 }
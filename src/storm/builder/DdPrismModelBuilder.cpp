@@ -95,7 +95,8 @@ class ParameterCreator<Type, storm::RationalFunction> {
 template<storm::dd::DdType Type, typename ValueType>
 class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
    public:
-    GenerationInformation(storm::prism::Program const& program, std::shared_ptr<storm::dd::DdManager<Type>> const& manager)
+    GenerationInformation(storm::prism::Program const& program, std::shared_ptr<storm::dd::DdManager<Type>> const& manager,
+                          storm::builder::DdVariableOrderHeuristic variableOrderHeuristic = storm::builder::DdVariableOrderHeuristic::Declaration)
         : program(program),
           manager(manager),
           rowMetaVariables(),
@@ -110,7 +111,7 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
           moduleToIdentityMap(),
           parameters() {
         // Initializes variables and identity DDs.
-        createMetaVariablesAndIdentities();
+        createMetaVariablesAndIdentities(variableOrderHeuristic);
 
         // Initialize the parameters (if any).
         ParameterCreator<Type, ValueType> parameterCreator;
@@ -170,7 +171,7 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
     /*!
      * Creates the required meta variables and variable/module identities.
      */
-    void createMetaVariablesAndIdentities() {
+    void createMetaVariablesAndIdentities(storm::builder::DdVariableOrderHeuristic variableOrderHeuristic) {
         // Add synchronization variables.
         for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
             std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -190,93 +191,65 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
-        // Create meta variables for global program variables.
+        // Create meta variables for all program variables. Since the DD variables of each meta variable are placed
+        // below the existing ones, the order of creation determines the variable order of the DDs.
+        std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableBounds;
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-            int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-            int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-
-            STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
+            integerVariableBounds.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(),
+                                                                                                  integerVariable.getUpperBoundExpression().evaluateAsInt()));
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                integerVariableBounds.emplace(
+                    integerVariable.getExpressionVariable(),
+                    std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+            }
+        }
+        for (storm::expressions::Variable const& variable : storm::builder::computeDdVariableOrder(program, variableOrderHeuristic)) {
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+            auto boundsIt = integerVariableBounds.find(variable);
+            if (boundsIt != integerVariableBounds.end()) {
+                variablePair = manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second);
+                STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
+                                                                                << "] and " << variablePair.second.getName() << "["
+                                                                                << variablePair.second.getIndex() << "]");
+            } else {
+                variablePair = manager->addMetaVariable(variable.getName());
+                STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
+                                                                                << "] and " << variablePair.second.getName() << "["
+                                                                                << variablePair.second.getIndex() << "]");
+            }
 
             rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
+            variableToRowMetaVariableMap->emplace(variable, variablePair.first);
 
             columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
+            variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
 
             storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
+            variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
             rowColumnMetaVariablePairs.push_back(variablePair);
+        }
 
+        for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
             allGlobalVariables.insert(integerVariable.getExpressionVariable());
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-
-            STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
-
-            rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-
-            columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-
-            storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-
-            rowColumnMetaVariablePairs.push_back(variablePair);
             allGlobalVariables.insert(booleanVariable.getExpressionVariable());
         }
 
-        // Create meta variables for each of the modules' variables.
+        // Create the identities and ranges of the modules.
         for (storm::prism::Module const& module : program.getModules()) {
             storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
             storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
 
             for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
-                STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                moduleIdentity &= variableToIdentityMap.at(integerVariable.getExpressionVariable()).toBdd();
+                moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(integerVariable.getExpressionVariable()));
             }
             for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                moduleIdentity &= variableToIdentityMap.at(booleanVariable.getExpressionVariable()).toBdd();
+                moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(booleanVariable.getExpressionVariable()));
             }
             moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
             moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
@@ -607,20 +580,33 @@ bool DdPrismModelBuilder<Type, ValueType>::canHandle(storm::prism::Program const
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options()
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates() {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      buildAllLabels(false),
+      labelsToBuild(),
+      terminalStates(),
+      variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration) {
     // Intentionally left empty.
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula)
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()) {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      buildAllLabels(false),
+      labelsToBuild(std::set<std::string>()),
+      variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration) {
     this->preserveFormula(formula);
     this->setTerminalStatesFromFormula(formula);
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild() {
+    : buildAllRewardModels(false),
+      rewardModelsToBuild(),
+      buildAllLabels(false),
+      labelsToBuild(),
+      variableOrderHeuristic(storm::builder::DdVariableOrderHeuristic::Declaration) {
     for (auto const& formula : formulas) {
         this->preserveFormula(*formula);
     }
@@ -1424,7 +1410,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
     storm::prism::Program const& program, Options const& options, std::shared_ptr<storm::dd::DdManager<Type>> const& manager) {
     // Start by initializing the structure used for storing all information needed during the model generation.
     // In particular, this creates the meta variables used to encode the model.
-    GenerationInformation generationInfo(program, manager);
+    GenerationInformation generationInfo(program, manager, options.variableOrderHeuristic);
 
     SystemResult system = createSystemDecisionDiagram(generationInfo);
     storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
@@ -1569,6 +1555,8 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         result->addParameters(generationInfo.parameters);
     }
 
+    STORM_LOG_INFO("Transition matrix has " << transitionMatrix.getNodeCount() << " nodes and reachable states have " << reachableStates.getNodeCount()
+                                            << " nodes using the '" << options.variableOrderHeuristic << "' variable order.");
     return result;
 }
 
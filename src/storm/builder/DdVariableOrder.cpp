@@ -0,0 +1,340 @@
+#include "storm/builder/DdVariableOrder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrderHeuristic const& heuristic) {
+    switch (heuristic) {
+        case DdVariableOrderHeuristic::Declaration:
+            out << "declaration";
+            break;
+        case DdVariableOrderHeuristic::Force:
+            out << "force";
+            break;
+        case DdVariableOrderHeuristic::Clustered:
+            out << "clustered";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+namespace {
+
+// The dependency graph of a model. Its nodes are the variables of the model and each hyperedge relates variables that
+// are read or written by the same command (or edge). Additionally, the variables are clustered according to the
+// module (or automaton) they belong to, where every global variable forms a cluster on its own.
+class DependencyGraph {
+   public:
+    uint64_t addCluster() {
+        clusters.emplace_back();
+        return clusters.size() - 1;
+    }
+
+    void addVariable(storm::expressions::Variable const& variable, uint64_t cluster) {
+        variableToIndexMap.emplace(variable, variables.size());
+        clusters[cluster].push_back(variables.size());
+        variables.push_back(variable);
+    }
+
+    void addVariablesOf(storm::expressions::Expression const& expression, std::set<uint64_t>& nodes) const {
+        if (expression.isInitialized()) {
+            for (auto const& variable : expression.getVariables()) {
+                addNode(variable, nodes);
+            }
+        }
+    }
+
+    void addNode(storm::expressions::Variable const& variable, std::set<uint64_t>& nodes) const {
+        auto it = variableToIndexMap.find(variable);
+        if (it != variableToIndexMap.end()) {
+            nodes.insert(it->second);
+        }
+    }
+
+    void addHyperedge(std::set<uint64_t> const& nodes) {
+        if (nodes.size() > 1) {
+            hyperedges.emplace_back(nodes.begin(), nodes.end());
+        }
+    }
+
+    std::vector<storm::expressions::Variable> computeOrder(DdVariableOrderHeuristic heuristic) const {
+        std::vector<uint64_t> order;
+        if (heuristic == DdVariableOrderHeuristic::Declaration) {
+            order.resize(variables.size());
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                order[index] = index;
+            }
+        } else if (heuristic == DdVariableOrderHeuristic::Force) {
+            std::vector<uint64_t> initialOrder(variables.size());
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                initialOrder[index] = index;
+            }
+            order = computeForceOrder(initialOrder, hyperedges);
+        } else {
+            STORM_LOG_ASSERT(heuristic == DdVariableOrderHeuristic::Clustered, "Unknown variable order heuristic.");
+            // First order the clusters wrt. the hyperedges between them and then order the variables within each cluster.
+            std::vector<uint64_t> variableToClusterMap(variables.size());
+            std::vector<uint64_t> initialClusterOrder(clusters.size());
+            for (uint64_t cluster = 0; cluster < clusters.size(); ++cluster) {
+                initialClusterOrder[cluster] = cluster;
+                for (auto const& variable : clusters[cluster]) {
+                    variableToClusterMap[variable] = cluster;
+                }
+            }
+            std::vector<std::vector<uint64_t>> clusterHyperedges;
+            for (auto const& hyperedge : hyperedges) {
+                std::set<uint64_t> clusterNodes;
+                for (auto const& variable : hyperedge) {
+                    clusterNodes.insert(variableToClusterMap[variable]);
+                }
+                if (clusterNodes.size() > 1) {
+                    clusterHyperedges.emplace_back(clusterNodes.begin(), clusterNodes.end());
+                }
+            }
+            for (auto const& cluster : computeForceOrder(initialClusterOrder, clusterHyperedges)) {
+                std::vector<uint64_t> clusterOrder = computeForceOrder(clusters[cluster], hyperedges);
+                order.insert(order.end(), clusterOrder.begin(), clusterOrder.end());
+            }
+        }
+
+        STORM_LOG_DEBUG("Total span of the variable dependencies is " << computeTotalSpan(order, hyperedges) << " with the '" << heuristic
+                                                                       << "' variable order.");
+        std::vector<storm::expressions::Variable> result;
+        result.reserve(order.size());
+        for (auto const& index : order) {
+            result.push_back(variables[index]);
+        }
+        return result;
+    }
+
+   private:
+    std::vector<storm::expressions::Variable> variables;
+    std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+    std::vector<std::vector<uint64_t>> hyperedges;
+    std::vector<std::vector<uint64_t>> clusters;
+};
+
+}  // namespace
+
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderHeuristic heuristic) {
+    DependencyGraph graph;
+    for (auto const& integerVariable : program.getGlobalIntegerVariables()) {
+        graph.addVariable(integerVariable.getExpressionVariable(), graph.addCluster());
+    }
+    for (auto const& booleanVariable : program.getGlobalBooleanVariables()) {
+        graph.addVariable(booleanVariable.getExpressionVariable(), graph.addCluster());
+    }
+    for (auto const& module : program.getModules()) {
+        uint64_t cluster = graph.addCluster();
+        for (auto const& integerVariable : module.getIntegerVariables()) {
+            graph.addVariable(integerVariable.getExpressionVariable(), cluster);
+        }
+        for (auto const& booleanVariable : module.getBooleanVariables()) {
+            graph.addVariable(booleanVariable.getExpressionVariable(), cluster);
+        }
+    }
+
+    // Each command relates the variables it reads and writes. Commands that synchronize additionally relate all
+    // variables of the commands they synchronize with.
+    std::map<uint_fast64_t, std::set<uint64_t>> actionIndexToNodesMap;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            std::set<uint64_t> nodes;
+            graph.addVariablesOf(command.getGuardExpression(), nodes);
+            for (auto const& update : command.getUpdates()) {
+                graph.addVariablesOf(update.getLikelihoodExpression(), nodes);
+                for (auto const& assignment : update.getAssignments()) {
+                    graph.addNode(assignment.getVariable(), nodes);
+                    graph.addVariablesOf(assignment.getExpression(), nodes);
+                }
+            }
+            if (command.isLabeled()) {
+                actionIndexToNodesMap[command.getActionIndex()].insert(nodes.begin(), nodes.end());
+            }
+            graph.addHyperedge(nodes);
+        }
+    }
+    for (auto const& actionIndexNodesPair : actionIndexToNodesMap) {
+        graph.addHyperedge(actionIndexNodesPair.second);
+    }
+
+    return graph.computeOrder(heuristic);
+}
+
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, DdVariableOrderHeuristic heuristic) {
+    // The location variables come first (ordered by the names of the automata), then the global variables and then the
+    // variables of the automata.
+    DependencyGraph graph;
+    std::map<std::string, uint64_t> automatonToClusterMap;
+    for (auto const& automaton : model.getAutomata()) {
+        automatonToClusterMap[automaton.getName()] = 0;
+    }
+    for (auto& automatonClusterPair : automatonToClusterMap) {
+        automatonClusterPair.second = graph.addCluster();
+        graph.addVariable(model.getAutomaton(automatonClusterPair.first).getLocationExpressionVariable(), automatonClusterPair.second);
+    }
+    for (auto const& variable : model.getGlobalVariables()) {
+        if (!variable.isTransient()) {
+            graph.addVariable(variable.getExpressionVariable(), graph.addCluster());
+        }
+    }
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& variable : automaton.getVariables()) {
+            if (!variable.isTransient()) {
+                graph.addVariable(variable.getExpressionVariable(), automatonToClusterMap.at(automaton.getName()));
+            }
+        }
+    }
+
+    // Each edge relates the location variable of its automaton and the variables it reads and writes. Edges with the
+    // same (non-silent) action additionally relate all variables of the edges they may synchronize with.
+    std::map<uint64_t, std::set<uint64_t>> actionIndexToNodesMap;
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& edge : automaton.getEdges()) {
+            std::set<uint64_t> nodes;
+            graph.addNode(automaton.getLocationExpressionVariable(), nodes);
+            graph.addVariablesOf(edge.getGuard(), nodes);
+            if (edge.hasRate()) {
+                graph.addVariablesOf(edge.getRate(), nodes);
+            }
+            for (auto const& assignment : edge.getAssignments()) {
+                graph.addVariablesOf(assignment.getAssignedExpression(), nodes);
+            }
+            for (auto const& destination : edge.getDestinations()) {
+                graph.addVariablesOf(destination.getProbability(), nodes);
+                for (auto const& assignment : destination.getOrderedAssignments()) {
+                    if (assignment.getLValue().isVariable()) {
+                        graph.addNode(assignment.getExpressionVariable(), nodes);
+                    }
+                    graph.addVariablesOf(assignment.getAssignedExpression(), nodes);
+                }
+            }
+            if (!edge.hasSilentAction()) {
+                actionIndexToNodesMap[edge.getActionIndex()].insert(nodes.begin(), nodes.end());
+            }
+            graph.addHyperedge(nodes);
+        }
+    }
+    for (auto const& actionIndexNodesPair : actionIndexToNodesMap) {
+        graph.addHyperedge(actionIndexNodesPair.second);
+    }
+
+    return graph.computeOrder(heuristic);
+}
+
+std::vector<uint64_t> computeForceOrder(std::vector<uint64_t> const& initialOrder, std::vector<std::vector<uint64_t>> const& hyperedges) {
+    if (initialOrder.size() <= 2) {
+        return initialOrder;
+    }
+
+    // Restrict the hyperedges to the nodes that are to be ordered.
+    uint64_t const numberOfNodes = *std::max_element(initialOrder.begin(), initialOrder.end()) + 1;
+    std::vector<uint64_t> positions(numberOfNodes, std::numeric_limits<uint64_t>::max());
+    for (uint64_t position = 0; position < initialOrder.size(); ++position) {
+        positions[initialOrder[position]] = position;
+    }
+    std::vector<std::vector<uint64_t>> relevantHyperedges;
+    std::vector<std::vector<uint64_t>> nodeToHyperedgesMap(numberOfNodes);
+    for (auto const& hyperedge : hyperedges) {
+        std::vector<uint64_t> relevantNodes;
+        for (auto const& node : hyperedge) {
+            if (node < numberOfNodes && positions[node] != std::numeric_limits<uint64_t>::max()) {
+                relevantNodes.push_back(node);
+            }
+        }
+        if (relevantNodes.size() > 1) {
+            for (auto const& node : relevantNodes) {
+                nodeToHyperedgesMap[node].push_back(relevantHyperedges.size());
+            }
+            relevantHyperedges.push_back(std::move(relevantNodes));
+        }
+    }
+    if (relevantHyperedges.empty()) {
+        return initialOrder;
+    }
+
+    std::vector<uint64_t> order = initialOrder;
+    std::vector<uint64_t> bestOrder = initialOrder;
+    uint64_t bestSpan = computeTotalSpan(order, relevantHyperedges);
+    std::vector<double> centersOfGravity(relevantHyperedges.size());
+    std::vector<double> newPositions(numberOfNodes);
+    // FORCE typically converges within a number of iterations that is logarithmic in the number of nodes.
+    uint64_t const maximalNumberOfIterations = 10 * (static_cast<uint64_t>(std::log2(initialOrder.size())) + 1);
+    uint64_t iterationsWithoutImprovement = 0;
+    for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+        for (uint64_t hyperedge = 0; hyperedge < relevantHyperedges.size(); ++hyperedge) {
+            double sum = 0.0;
+            for (auto const& node : relevantHyperedges[hyperedge]) {
+                sum += positions[node];
+            }
+            centersOfGravity[hyperedge] = sum / relevantHyperedges[hyperedge].size();
+        }
+        for (auto const& node : order) {
+            if (nodeToHyperedgesMap[node].empty()) {
+                newPositions[node] = positions[node];
+            } else {
+                double sum = 0.0;
+                for (auto const& hyperedge : nodeToHyperedgesMap[node]) {
+                    sum += centersOfGravity[hyperedge];
+                }
+                newPositions[node] = sum / nodeToHyperedgesMap[node].size();
+            }
+        }
+        std::stable_sort(order.begin(), order.end(), [&newPositions](uint64_t const& first, uint64_t const& second) {
+            return newPositions[first] < newPositions[second];
+        });
+        for (uint64_t position = 0; position < order.size(); ++position) {
+            positions[order[position]] = position;
+        }
+
+        uint64_t span = computeTotalSpan(order, relevantHyperedges);
+        if (span < bestSpan) {
+            bestSpan = span;
+            bestOrder = order;
+            iterationsWithoutImprovement = 0;
+        } else if (++iterationsWithoutImprovement == 3) {
+            // The span has stopped decreasing.
+            break;
+        }
+    }
+    return bestOrder;
+}
+
+uint64_t computeTotalSpan(std::vector<uint64_t> const& order, std::vector<std::vector<uint64_t>> const& hyperedges) {
+    std::map<uint64_t, uint64_t> positions;
+    for (uint64_t position = 0; position < order.size(); ++position) {
+        positions[order[position]] = position;
+    }
+    uint64_t result = 0;
+    for (auto const& hyperedge : hyperedges) {
+        uint64_t first = std::numeric_limits<uint64_t>::max();
+        uint64_t last = 0;
+        for (auto const& node : hyperedge) {
+            auto it = positions.find(node);
+            if (it != positions.end()) {
+                first = std::min(first, it->second);
+                last = std::max(last, it->second);
+            }
+        }
+        if (first < last) {
+            result += last - first;
+        }
+    }
+    return result;
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+// An enum that contains all currently supported heuristics for statically ordering the variables of symbolic models.
+enum class DdVariableOrderHeuristic { Declaration, Force, Clustered };
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrderHeuristic const& heuristic);
+
+/*!
+ * Computes the order in which the meta variables for the (state) variables of the given program are to be created. The
+ * order is derived from the dependency graph of the program, in which each command (and each synchronizing action)
+ * relates all variables that it reads or writes.
+ *
+ * @param program The program whose variables are to be ordered.
+ * @param heuristic The heuristic that is used to compute the order.
+ * @return All global and module variables of the program in the order in which they should appear in the DDs.
+ */
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderHeuristic heuristic);
+
+/*!
+ * Computes the order in which the meta variables for the (non-transient) variables of the given model are to be
+ * created. The location variables of the automata are treated like all other variables.
+ *
+ * @param model The model whose variables are to be ordered.
+ * @param heuristic The heuristic that is used to compute the order.
+ * @return The location variables of all automata and the non-transient global and automaton variables of the model in
+ * the order in which they should appear in the DDs.
+ */
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, DdVariableOrderHeuristic heuristic);
+
+/*!
+ * Computes an order of the nodes of the given hypergraph that keeps the nodes of each hyperedge close together, using
+ * the FORCE heuristic (Aloul, Markov and Sakallah, 2003). Starting from the given order, the nodes are repeatedly
+ * moved towards the centers of gravity of their hyperedges until the total span of the hyperedges no longer decreases.
+ *
+ * @param initialOrder The initial order of the nodes. Only these nodes are ordered.
+ * @param hyperedges The hyperedges of the graph. Nodes that do not appear in the initial order are ignored.
+ * @return The order with the smallest total span that was encountered.
+ */
+std::vector<uint64_t> computeForceOrder(std::vector<uint64_t> const& initialOrder, std::vector<std::vector<uint64_t>> const& hyperedges);
+
+/*!
+ * Computes the sum of the spans of the given hyperedges with respect to the given order, i.e., for each hyperedge the
+ * distance between the first and the last of its nodes in the order.
+ */
+uint64_t computeTotalSpan(std::vector<uint64_t> const& order, std::vector<std::vector<uint64_t>> const& hyperedges);
+
+}  // namespace builder
+}  // namespace storm
@@ -9,6 +9,7 @@
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -30,6 +31,7 @@
 #include "storm/storage/jani/ParallelComposition.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/Metrics.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
@@ -56,14 +58,18 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      explorationQueueSpillThreshold(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationQueueSpillThreshold()) {
     // Intentionally left empty.
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
-    : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+    : generator(generator),
+      options(options),
+      stateStorage(generator->getStateSize()),
+      statesToExplore(generator->getStateSize(), options.explorationQueueSpillThreshold) {
     // Intentionally left empty.
 }
 
@@ -118,12 +124,12 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
 
     if (actualIndex == newIndex) {
         if (options.explorationOrder == ExplorationOrder::Dfs) {
-            statesToExplore.emplace_front(state, actualIndex);
+            statesToExplore.pushFront(state, actualIndex);
 
             // Reserve one slot for the new state in the remapping.
             stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else if (options.explorationOrder == ExplorationOrder::Bfs) {
-            statesToExplore.emplace_back(state, actualIndex);
+            statesToExplore.pushBack(state, actualIndex);
         } else {
             STORM_LOG_ASSERT(false, "Invalid exploration order.");
         }
@@ -132,6 +138,37 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
     return actualIndex;
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportModelAsDrn(std::ostream& os, std::vector<std::string> const& parameters) {
+    storm::models::ModelType modelType;
+    switch (generator->getModelType()) {
+        case storm::generator::ModelType::DTMC:
+            modelType = storm::models::ModelType::Dtmc;
+            break;
+        case storm::generator::ModelType::CTMC:
+            modelType = storm::models::ModelType::Ctmc;
+            break;
+        case storm::generator::ModelType::MDP:
+            modelType = storm::models::ModelType::Mdp;
+            break;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting models of this type during the exploration is not supported.");
+    }
+    std::vector<std::string> rewardModelNames;
+    for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
+        rewardModelNames.push_back(generator->getRewardModelInformation(i).getName());
+    }
+    storm::exporter::DirectEncodingStreamExporter<ValueType> streamExporter(modelType, rewardModelNames, generator->getOptions().isBuildChoiceLabelsSet());
+
+    // The component builders remain empty as all states are passed to the exporter.
+    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder;
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
+    StateAndChoiceInformationBuilder stateAndChoiceInformationBuilder;
+    buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder, &streamExporter);
+
+    streamExporter.exportModel(os, buildStateLabeling(), parameters, stateRemapping ? &stateRemapping.get() : nullptr);
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
     return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
@@ -141,7 +178,7 @@ template<typename ValueType, typename RewardModelType, typename StateType>
 void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
     std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
-    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, storm::exporter::DirectEncodingStreamExporter<ValueType>* streamExporter) {
     // Initialize building state valuations (if necessary)
     if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
         stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
@@ -175,9 +212,9 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     // Perform a search through the model.
     while (!statesToExplore.empty()) {
         // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
-        StateType currentIndex = statesToExplore.front().second;
-        statesToExplore.pop_front();
+        auto currentStateIndexPair = statesToExplore.popFront();
+        CompressedState const& currentState = currentStateIndexPair.first;
+        StateType currentIndex = currentStateIndexPair.second;
 
         // If the exploration order differs from breadth-first, we remember that this row group was actually
         // filled with the transitions of a different state.
@@ -203,19 +240,26 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
                     this->stateStorage.deadlockStateIndices.push_back(currentIndex);
                 }
 
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
-                }
+                if (streamExporter) {
+                    std::vector<ValueType> zeroRewards(generator->getNumberOfRewardModels(), storm::utility::zero<ValueType>());
+                    streamExporter->newState(zeroRewards);
+                    streamExporter->newChoice({}, zeroRewards);
+                    streamExporter->addTransition(currentIndex, storm::utility::one<ValueType>());
+                } else {
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
 
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+                    transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
 
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                    }
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
 
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
                     }
                 }
 
@@ -236,6 +280,9 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             }
         } else {
             // Add the state rewards to the corresponding reward models.
+            if (streamExporter) {
+                streamExporter->newState(behavior.getStateRewards());
+            }
             auto stateRewardIt = behavior.getStateRewards().begin();
             for (auto& rewardModelBuilder : rewardModelBuilders) {
                 if (rewardModelBuilder.hasStateRewards()) {
@@ -245,7 +292,7 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             }
 
             // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
+            if (!generator->isDeterministicModel() && !streamExporter) {
                 transitionMatrixBuilder.newRowGroup(currentRow);
             }
 
@@ -274,8 +321,15 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
                 }
 
                 // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                if (streamExporter) {
+                    streamExporter->newChoice(choice.hasLabels() ? choice.getLabels() : std::set<std::string>(), choice.getRewards());
+                    for (auto const& stateProbabilityPair : choice) {
+                        streamExporter->addTransition(stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                } else {
+                    for (auto const& stateProbabilityPair : choice) {
+                        transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
                 }
 
                 // Add the rewards to the reward models.
@@ -317,6 +371,20 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         }
     }
 
+    if (storm::utility::metrics::isEnabled()) {
+        auto durationSinceStart = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+        storm::utility::metrics::addToCounter("explored states", numberOfExploredStates);
+        storm::utility::metrics::addToCounter("explored choices", currentRow);
+        if (durationSinceStart > 0.0) {
+            storm::utility::metrics::setValue("explored states per second", numberOfExploredStates / durationSinceStart);
+        }
+        auto const& stateToId = this->stateStorage.stateToId;
+        storm::utility::metrics::setValue("state storage load factor", static_cast<double>(stateToId.size()) / static_cast<double>(stateToId.capacity()));
+    }
+
+    STORM_LOG_INFO_COND(statesToExplore.getNumberOfSpilledStates() == 0,
+                        "Exploration queue spilled " << statesToExplore.getNumberOfSpilledStates() << " states to disk.");
+
     // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
     // (reversed) mapping of row groups to indices.
     if (options.explorationOrder != ExplorationOrder::Bfs) {
@@ -329,8 +397,10 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         // (c) the hash map storing the mapping states -> ids
         // (d) fix remapping for state-generation labels
 
-        // Fix (a).
-        transitionMatrixBuilder.replaceColumns(remapping, 0);
+        // Fix (a). When exporting during the exploration, the exporter takes care of this.
+        if (!streamExporter) {
+            transitionMatrixBuilder.replaceColumns(remapping, 0);
+        }
 
         // Fix (b).
         std::vector<StateType> newInitialStateIndices(this->stateStorage.initialStateIndices.size());
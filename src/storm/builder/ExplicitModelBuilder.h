@@ -24,11 +24,14 @@
 #include "storm/utility/prism.h"
 
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/ExplorationQueue.h"
 
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/VariableInformation.h"
 
+#include "storm/io/DirectEncodingStreamExporter.h"
+
 namespace storm {
 
 namespace builder {
@@ -76,6 +79,10 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // The number of unexplored states that are kept in memory before further states are spilled to disk (zero
+        // means that states are only spilled if the memory budget is under pressure).
+        uint64_t explorationQueueSpillThreshold;
     };
 
     /*!
@@ -112,6 +119,15 @@ class ExplicitModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
 
+    /*!
+     * Explores the model and writes it to the given stream in the explicit DRN format. In contrast to building the
+     * model and exporting it afterwards, the transitions are never kept in memory.
+     *
+     * @param os The stream to write to.
+     * @param parameters The names of the parameters of the model.
+     */
+    void exportModelAsDrn(std::ostream& os, std::vector<std::string> const& parameters = {});
+
     /*!
      * Export a wrapper that contains (a copy of) the internal information that maps states to ids.
      * This wrapper can be helpful to find states in later stages.
@@ -137,10 +153,12 @@ class ExplicitModelBuilder {
      * @param transitionMatrixBuilder The builder of the transition matrix.
      * @param rewardModelBuilders The builders for the selected reward models.
      * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
+     * @param streamExporter If given, the states are passed to this exporter instead of the builders above.
      */
     void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
                        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
-                       StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+                       StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder,
+                       storm::exporter::DirectEncodingStreamExporter<ValueType>* streamExporter = nullptr);
 
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
@@ -166,7 +184,7 @@ class ExplicitModelBuilder {
     storm::storage::sparse::StateStorage<StateType> stateStorage;
 
     /// A set of states that still need to be explored.
-    std::deque<std::pair<CompressedState, StateType>> statesToExplore;
+    ExplorationQueue<StateType> statesToExplore;
 
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
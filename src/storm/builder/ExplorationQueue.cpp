@@ -0,0 +1,193 @@
+#include "storm/builder/ExplorationQueue.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/utility/MemoryBudget.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+// The number of states that are written to disk at once if no threshold is given.
+uint64_t const defaultBlockSize = 1ull << 16;
+}  // namespace
+
+template<typename StateType>
+void ExplorationQueue<StateType>::FileCloser::operator()(std::FILE* file) const {
+    std::fclose(file);
+}
+
+template<typename StateType>
+ExplorationQueue<StateType>::ExplorationQueue(uint64_t stateSize, uint64_t memoryThreshold)
+    : stateSize(stateSize),
+      recordWords((stateSize + 63) / 64 + 1),
+      memoryThreshold(memoryThreshold),
+      blockSize(memoryThreshold > 0 ? std::max<uint64_t>(memoryThreshold / 4, 1) : defaultBlockSize),
+      numberOfSpilledStatesInQueue(0),
+      numberOfSpilledStates(0),
+      pushesSinceLastPressureCheck(0),
+      fileSize(0) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::pushFront(storm::generator::CompressedState const& state, StateType index) {
+    head.emplace_front(state, index);
+    spillIfNecessary();
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::pushBack(storm::generator::CompressedState const& state, StateType index) {
+    // As long as nothing was spilled, all states are kept in the head.
+    if (spilledBlocks.empty() && tail.empty()) {
+        head.emplace_back(state, index);
+    } else {
+        tail.emplace_back(state, index);
+    }
+    spillIfNecessary();
+}
+
+template<typename StateType>
+typename ExplorationQueue<StateType>::EntryType ExplorationQueue<StateType>::popFront() {
+    STORM_LOG_ASSERT(!empty(), "Cannot take a state from an empty queue.");
+    if (head.empty()) {
+        if (!spilledBlocks.empty()) {
+            readBlock(spilledBlocks.front());
+            numberOfSpilledStatesInQueue -= spilledBlocks.front().size;
+            spilledBlocks.pop_front();
+            if (spilledBlocks.empty()) {
+                // All spilled states are back in memory, so the file can be cleared.
+                freeBlockOffsets.clear();
+                fileSize = 0;
+#if defined LINUX || defined MACOS
+                bool truncated = std::fflush(file.get()) == 0 && ftruncate(fileno(file.get()), 0) == 0;
+                STORM_LOG_WARN_COND(truncated, "Unable to truncate the temporary file of the exploration queue.");
+#endif
+            }
+        } else {
+            std::swap(head, tail);
+        }
+    }
+    EntryType result = std::move(head.front());
+    head.pop_front();
+    return result;
+}
+
+template<typename StateType>
+bool ExplorationQueue<StateType>::empty() const {
+    return head.empty() && tail.empty() && spilledBlocks.empty();
+}
+
+template<typename StateType>
+uint64_t ExplorationQueue<StateType>::size() const {
+    return head.size() + numberOfSpilledStatesInQueue + tail.size();
+}
+
+template<typename StateType>
+uint64_t ExplorationQueue<StateType>::getNumberOfSpilledStates() const {
+    return numberOfSpilledStates;
+}
+
+template<typename StateType>
+uint64_t ExplorationQueue<StateType>::getSpillFileSize() const {
+    return static_cast<uint64_t>(fileSize);
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::spillIfNecessary() {
+    uint64_t limit = memoryThreshold;
+    if (limit == 0) {
+        // Querying the memory consumption is comparatively expensive, so we only do it once per block.
+        if (++pushesSinceLastPressureCheck < blockSize) {
+            return;
+        }
+        pushesSinceLastPressureCheck = 0;
+        if (!storm::utility::resources::MemoryBudget::instance().isUnderPressure()) {
+            return;
+        }
+        limit = 2 * blockSize;
+    }
+
+    while (head.size() + tail.size() > limit) {
+        if (tail.size() >= blockSize) {
+            // The tail holds the states that are explored last, so we spill its oldest states.
+            spilledBlocks.push_back(writeBlock(tail.begin(), tail.begin() + blockSize));
+            tail.erase(tail.begin(), tail.begin() + blockSize);
+        } else if (head.size() > blockSize) {
+            // The back of the head is explored right before the spilled blocks.
+            spilledBlocks.push_front(writeBlock(head.end() - blockSize, head.end()));
+            head.erase(head.end() - blockSize, head.end());
+        } else {
+            break;
+        }
+    }
+}
+
+template<typename StateType>
+template<typename IteratorType>
+typename ExplorationQueue<StateType>::Block ExplorationQueue<StateType>::writeBlock(IteratorType first, IteratorType last) {
+    if (!file) {
+        file.reset(std::tmpfile());
+        STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Unable to create a temporary file for the exploration queue.");
+        STORM_LOG_INFO("Exploration queue exceeds the memory threshold, spilling states to disk.");
+    }
+
+    uint64_t numberOfEntries = std::distance(first, last);
+    buffer.resize(numberOfEntries * recordWords);
+    auto bufferIt = buffer.begin();
+    for (; first != last; ++first) {
+        for (uint64_t bitIndex = 0; bitIndex < stateSize; bitIndex += 64) {
+            *bufferIt = first->first.getAsInt(bitIndex, std::min<uint64_t>(64, stateSize - bitIndex));
+            ++bufferIt;
+        }
+        *bufferIt = static_cast<uint64_t>(first->second);
+        ++bufferIt;
+    }
+
+    // As all blocks have the same size, the block can take the space of any block that was read again.
+    STORM_LOG_ASSERT(numberOfEntries == blockSize, "Unexpected size of a spilled block.");
+    Block block{fileSize, numberOfEntries};
+    if (!freeBlockOffsets.empty()) {
+        block.offset = freeBlockOffsets.back();
+        freeBlockOffsets.pop_back();
+    }
+    bool success = std::fseek(file.get(), block.offset, SEEK_SET) == 0;
+    success = success && std::fwrite(buffer.data(), sizeof(uint64_t), buffer.size(), file.get()) == buffer.size();
+    STORM_LOG_THROW(success, storm::exceptions::FileIoException, "Unable to write states of the exploration queue to disk.");
+    if (block.offset == fileSize) {
+        fileSize += buffer.size() * sizeof(uint64_t);
+    }
+    numberOfSpilledStatesInQueue += numberOfEntries;
+    numberOfSpilledStates += numberOfEntries;
+    return block;
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::readBlock(Block const& block) {
+    buffer.resize(block.size * recordWords);
+    bool success = std::fseek(file.get(), block.offset, SEEK_SET) == 0;
+    success = success && std::fread(buffer.data(), sizeof(uint64_t), buffer.size(), file.get()) == buffer.size();
+    STORM_LOG_THROW(success, storm::exceptions::FileIoException, "Unable to read states of the exploration queue from disk.");
+    freeBlockOffsets.push_back(block.offset);
+
+    auto bufferIt = buffer.begin();
+    for (uint64_t entry = 0; entry < block.size; ++entry) {
+        storm::generator::CompressedState state(stateSize);
+        for (uint64_t bitIndex = 0; bitIndex < stateSize; bitIndex += 64) {
+            state.setFromInt(bitIndex, std::min<uint64_t>(64, stateSize - bitIndex), *bufferIt);
+            ++bufferIt;
+        }
+        head.emplace_back(std::move(state), static_cast<StateType>(*bufferIt));
+        ++bufferIt;
+    }
+}
+
+template class ExplorationQueue<uint32_t>;
+template class ExplorationQueue<uint64_t>;
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * The queue of states that still need to be explored by the explicit model builder. As the frontier of a breadth-first
+ * search can get very large, the queue keeps only a bounded number of states in memory and spills the remaining
+ * states to a temporary file. The states are written in blocks of fixed-width records (the bits of the compressed state
+ * followed by its index), so that the blocks can be read back with a single sequential read.
+ *
+ * Conceptually, the queue consists of an in-memory head, a sequence of spilled blocks and an in-memory tail (in this
+ * order). States are always taken from the head. If the head runs empty, it is refilled from the first spilled block
+ * (or the tail if there are no spilled blocks).
+ *
+ * All spilled blocks have the same size. The space of blocks that were read again is reused for subsequently spilled
+ * blocks and the file is truncated once all spilled blocks have been read, so the file does not grow beyond the
+ * largest number of states that were spilled at the same time.
+ */
+template<typename StateType>
+class ExplorationQueue {
+   public:
+    typedef std::pair<storm::generator::CompressedState, StateType> EntryType;
+
+    /*!
+     * Creates an empty queue.
+     *
+     * @param stateSize The number of bits of the compressed states.
+     * @param memoryThreshold The maximal number of states that are kept in memory. If zero, states are only spilled
+     * if the memory budget is under pressure.
+     */
+    ExplorationQueue(uint64_t stateSize, uint64_t memoryThreshold = 0);
+
+    ExplorationQueue(ExplorationQueue const&) = delete;
+    ExplorationQueue& operator=(ExplorationQueue const&) = delete;
+    ExplorationQueue(ExplorationQueue&&) = default;
+    ExplorationQueue& operator=(ExplorationQueue&&) = default;
+
+    /*!
+     * Inserts the state at the front (depth-first search) or the back (breadth-first search) of the queue.
+     */
+    void pushFront(storm::generator::CompressedState const& state, StateType index);
+    void pushBack(storm::generator::CompressedState const& state, StateType index);
+
+    /*!
+     * Removes the first state from the queue and returns it. The queue must not be empty.
+     */
+    EntryType popFront();
+
+    bool empty() const;
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of states that were written to disk so far.
+     */
+    uint64_t getNumberOfSpilledStates() const;
+
+    /*!
+     * Retrieves the number of bytes of the temporary file that are currently occupied (by spilled or reusable blocks).
+     */
+    uint64_t getSpillFileSize() const;
+
+   private:
+    struct Block {
+        // The position of the block within the file.
+        long offset;
+        // The number of states in the block.
+        uint64_t size;
+    };
+
+    // Spills states to disk if there are too many states in memory.
+    void spillIfNecessary();
+
+    // Writes the given range of entries to the file and returns the corresponding block.
+    template<typename IteratorType>
+    Block writeBlock(IteratorType first, IteratorType last);
+
+    // Reads the given block from the file and appends its entries to the head. The space of the block is released.
+    void readBlock(Block const& block);
+
+    struct FileCloser {
+        void operator()(std::FILE* file) const;
+    };
+
+    // The number of bits of the states and the number of 64-bit words per record.
+    uint64_t stateSize;
+    uint64_t recordWords;
+
+    // The number of states that may be kept in memory (or zero if only the memory budget is relevant) and the number
+    // of states that are written to disk at once.
+    uint64_t memoryThreshold;
+    uint64_t blockSize;
+
+    std::deque<EntryType> head;
+    std::deque<Block> spilledBlocks;
+    std::deque<EntryType> tail;
+
+    uint64_t numberOfSpilledStatesInQueue;
+    uint64_t numberOfSpilledStates;
+    uint64_t pushesSinceLastPressureCheck;
+
+    // The temporary file holding the spilled blocks. It is created upon the first spill and removed automatically.
+    std::unique_ptr<std::FILE, FileCloser> file;
+    long fileSize;
+    // The offsets of blocks in the file whose states were read again and whose space can thus be reused.
+    std::vector<long> freeBlockOffsets;
+
+    // A buffer for the records of one block.
+    std::vector<uint64_t> buffer;
+};
+
+}  // namespace builder
+}  // namespace storm
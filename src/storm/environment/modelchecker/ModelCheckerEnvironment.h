@@ -25,8 +25,15 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    /*!
+     * The number of threads used by model checking algorithms that support parallelization. Zero means 'auto-detect'.
+     */
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
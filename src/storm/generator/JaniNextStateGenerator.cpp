@@ -1038,40 +1038,40 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                                                                                               EdgeFilter const& edgeFilter) {
     std::vector<Choice<ValueType>> result;
 
+    // Only the synchronizations for which each participating automaton has an edge leaving its current location need to be considered.
+    SynchronizationCandidates const& candidates = getSynchronizationCandidates(locations);
+
     // To avoid reallocations, we declare some memory here here.
-    // This vector will store for each automaton the set of edges with the current output and the current source location
-    std::vector<EdgeSetWithIndices const*> edgeSetsMemory;
     // This vector will store the 'first' combination of edges that is productive.
     std::vector<typename EdgeSetWithIndices::const_iterator> edgeIteratorMemory;
 
-    for (OutputAndEdges const& outputAndEdges : edges) {
-        auto const& edges = outputAndEdges.second;
-        if (edges.size() == 1) {
+    // The edge sets of the candidates are stored consecutively, one for each participating automaton.
+    auto edgeSetsBegin = candidates.edgeSets.begin();
+    for (OutputAndEdges const* outputAndEdgesPointer : candidates.outputsAndEdges) {
+        OutputAndEdges const& outputAndEdges = *outputAndEdgesPointer;
+        auto edgeSetsEnd = edgeSetsBegin + outputAndEdges.second.size();
+        if (outputAndEdges.second.size() == 1) {
             // If the synch consists of just one element, it's non-synchronizing.
-            auto const& nonsychingEdges = edges.front();
-            uint64_t automatonIndex = nonsychingEdges.first;
+            uint64_t automatonIndex = outputAndEdges.second.front().first;
 
-            auto edgesIt = nonsychingEdges.second.find(locations[automatonIndex]);
-            if (edgesIt != nonsychingEdges.second.end()) {
-                for (auto const& indexAndEdge : edgesIt->second) {
-                    if (edgeFilter != EdgeFilter::All) {
-                        STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
-                        if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdge.second->hasRate()) {
-                            continue;
-                        }
-                    }
-                    if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+            for (auto const& indexAndEdge : **edgeSetsBegin) {
+                if (edgeFilter != EdgeFilter::All) {
+                    STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
+                    if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdge.second->hasRate()) {
                         continue;
                     }
+                }
+                if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                    continue;
+                }
 
-                    result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second,
-                                                                outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
-                                                                automatonIndex, state, stateToIdCallback));
+                result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second,
+                                                            outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
+                                                            automatonIndex, state, stateToIdCallback));
 
-                    if (this->getOptions().isBuildChoiceOriginsSet()) {
-                        EdgeIndexSet edgeIndex{model.encodeAutomatonAndEdgeIndices(automatonIndex, indexAndEdge.first)};
-                        result.back().addOriginData(boost::any(std::move(edgeIndex)));
-                    }
+                if (this->getOptions().isBuildChoiceOriginsSet()) {
+                    EdgeIndexSet edgeIndex{model.encodeAutomatonAndEdgeIndices(automatonIndex, indexAndEdge.first)};
+                    result.back().addOriginData(boost::any(std::move(edgeIndex)));
                 }
             }
         } else {
@@ -1080,53 +1080,36 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
 
             uint64_t outputActionIndex = outputAndEdges.first.get();
 
-            // Find out whether this combination is productive
+            // Find out whether this combination is productive, i.e., whether each automaton has at least one enabled action.
             bool productiveCombination = true;
-            // First check, whether each automaton has at least one edge with the current output and the current source location
-            // We will also store the edges of each automaton with the current outputAction
-            edgeSetsMemory.clear();
-            for (auto const& automatonAndEdges : outputAndEdges.second) {
-                uint64_t automatonIndex = automatonAndEdges.first;
-                LocationsAndEdges const& locationsAndEdges = automatonAndEdges.second;
-                auto edgesIt = locationsAndEdges.find(locations[automatonIndex]);
-                if (edgesIt == locationsAndEdges.end()) {
-                    productiveCombination = false;
-                    break;
-                }
-                edgeSetsMemory.push_back(&edgesIt->second);
-            }
-
-            if (productiveCombination) {
-                // second, check whether each automaton has at least one enabled action
-                edgeIteratorMemory.clear();  // Store the first enabled edge in each automaton.
-                for (auto const& edgesIt : edgeSetsMemory) {
-                    bool atLeastOneEdge = false;
-                    EdgeSetWithIndices const& edgeSetWithIndices = *edgesIt;
-                    for (auto indexAndEdgeIt = edgeSetWithIndices.begin(), indexAndEdgeIte = edgeSetWithIndices.end(); indexAndEdgeIt != indexAndEdgeIte;
-                         ++indexAndEdgeIt) {
-                        // check whether we do not consider this edge
-                        if (edgeFilter != EdgeFilter::All) {
-                            STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
-                            if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdgeIt->second->hasRate()) {
-                                continue;
-                            }
-                        }
-
-                        if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+            edgeIteratorMemory.clear();  // Store the first enabled edge in each automaton.
+            for (auto edgesIt = edgeSetsBegin; edgesIt != edgeSetsEnd; ++edgesIt) {
+                bool atLeastOneEdge = false;
+                EdgeSetWithIndices const& edgeSetWithIndices = **edgesIt;
+                for (auto indexAndEdgeIt = edgeSetWithIndices.begin(), indexAndEdgeIte = edgeSetWithIndices.end(); indexAndEdgeIt != indexAndEdgeIte;
+                     ++indexAndEdgeIt) {
+                    // check whether we do not consider this edge
+                    if (edgeFilter != EdgeFilter::All) {
+                        STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
+                        if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdgeIt->second->hasRate()) {
                             continue;
                         }
-
-                        // If we reach this point, the edge is considered enabled.
-                        atLeastOneEdge = true;
-                        edgeIteratorMemory.push_back(indexAndEdgeIt);
-                        break;
                     }
 
-                    // If there is no enabled edge of this automaton, the whole combination is not productive.
-                    if (!atLeastOneEdge) {
-                        productiveCombination = false;
-                        break;
+                    if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                        continue;
                     }
+
+                    // If we reach this point, the edge is considered enabled.
+                    atLeastOneEdge = true;
+                    edgeIteratorMemory.push_back(indexAndEdgeIt);
+                    break;
+                }
+
+                // If there is no enabled edge of this automaton, the whole combination is not productive.
+                if (!atLeastOneEdge) {
+                    productiveCombination = false;
+                    break;
                 }
             }
 
@@ -1134,9 +1117,8 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
             if (productiveCombination) {
                 AutomataEdgeSets automataEdgeSets;
                 automataEdgeSets.reserve(outputAndEdges.second.size());
-                STORM_LOG_ASSERT(edgeSetsMemory.size() == outputAndEdges.second.size(), "Unexpected number of edge sets stored.");
                 STORM_LOG_ASSERT(edgeIteratorMemory.size() == outputAndEdges.second.size(), "Unexpected number of edge iterators stored.");
-                auto edgeSetIt = edgeSetsMemory.begin();
+                auto edgeSetIt = edgeSetsBegin;
                 auto edgeIteratorIt = edgeIteratorMemory.begin();
                 for (auto const& automatonAndEdges : outputAndEdges.second) {
                     EdgeSetWithIndices enabledEdgesOfAutomaton;
@@ -1169,11 +1151,55 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                 expandSynchronizingEdgeCombination(automataEdgeSets, outputActionIndex, state, stateToIdCallback, result);
             }
         }
+        edgeSetsBegin = edgeSetsEnd;
     }
 
     return result;
 }
 
+template<typename ValueType, typename StateType>
+typename JaniNextStateGenerator<ValueType, StateType>::SynchronizationCandidates const&
+JaniNextStateGenerator<ValueType, StateType>::getSynchronizationCandidates(std::vector<uint64_t> const& locations) {
+    if (!this->options.isCacheSynchronizationsSet()) {
+        computeSynchronizationCandidates(locations, synchronizationCandidatesMemory);
+        return synchronizationCandidatesMemory;
+    }
+
+    auto cacheIt = synchronizationCandidatesCache.find(locations);
+    if (cacheIt == synchronizationCandidatesCache.end()) {
+        cacheIt = synchronizationCandidatesCache.emplace(locations, SynchronizationCandidates()).first;
+        computeSynchronizationCandidates(locations, cacheIt->second);
+        cacheIt->second.outputsAndEdges.shrink_to_fit();
+        cacheIt->second.edgeSets.shrink_to_fit();
+    }
+    return cacheIt->second;
+}
+
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::computeSynchronizationCandidates(std::vector<uint64_t> const& locations,
+                                                                                   SynchronizationCandidates& candidates) const {
+    candidates.outputsAndEdges.clear();
+    candidates.edgeSets.clear();
+    for (OutputAndEdges const& outputAndEdges : edges) {
+        // Check whether each automaton has at least one edge with the current output and the current source location.
+        uint64_t numberOfEdgeSets = candidates.edgeSets.size();
+        for (auto const& automatonAndEdges : outputAndEdges.second) {
+            LocationsAndEdges const& locationsAndEdges = automatonAndEdges.second;
+            auto edgesIt = locationsAndEdges.find(locations[automatonAndEdges.first]);
+            if (edgesIt == locationsAndEdges.end()) {
+                break;
+            }
+            candidates.edgeSets.push_back(&edgesIt->second);
+        }
+
+        if (candidates.edgeSets.size() - numberOfEdgeSets == outputAndEdges.second.size()) {
+            candidates.outputsAndEdges.push_back(&outputAndEdges);
+        } else {
+            candidates.edgeSets.resize(numberOfEdgeSets);
+        }
+    }
+}
+
 template<typename ValueType, typename StateType>
 void JaniNextStateGenerator<ValueType, StateType>::checkGlobalVariableWritesValid(AutomataEdgeSets const& enabledEdges) const {
     // Todo: this also throws if the writes are on different assignment level
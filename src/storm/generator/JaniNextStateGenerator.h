@@ -1,5 +1,9 @@
 #pragma once
 
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
 
@@ -172,6 +176,26 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
                                           storm::generator::Distribution<StateType, ValueType>& distribution, std::vector<ValueType>& stateActionRewards,
                                           EdgeIndexSet& edgeIndices, StateToIdCallback stateToIdCallback);
 
+    /*!
+     * The synchronizations for which each participating automaton has at least one edge leaving its location. For each
+     * synchronization, the edge sets of the participating automata are stored consecutively in edgeSets.
+     */
+    struct SynchronizationCandidates {
+        std::vector<OutputAndEdges const*> outputsAndEdges;
+        std::vector<EdgeSetWithIndices const*> edgeSets;
+    };
+
+    /*!
+     * Retrieves the synchronization candidates for the given location vector. If synchronizations are cached, the
+     * candidates are computed once per location vector.
+     */
+    SynchronizationCandidates const& getSynchronizationCandidates(std::vector<uint64_t> const& locations);
+
+    /*!
+     * Computes the synchronization candidates for the given location vector.
+     */
+    void computeSynchronizationCandidates(std::vector<uint64_t> const& locations, SynchronizationCandidates& candidates) const;
+
     /*!
      * Checks the list of enabled edges for multiple synchronized writes to the same global variable.
      */
@@ -211,6 +235,12 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     /// The vector storing the edges that need to be explored (synchronously or asynchronously).
     std::vector<OutputAndEdges> edges;
 
+    /// The synchronization candidates of the location vectors encountered so far (only used if synchronizations are cached).
+    std::unordered_map<std::vector<uint64_t>, SynchronizationCandidates, boost::hash<std::vector<uint64_t>>> synchronizationCandidatesCache;
+
+    /// The synchronization candidates of the current state (only used if synchronizations are not cached).
+    SynchronizationCandidates synchronizationCandidatesMemory;
+
     /// The names and defining expressions of reward models that need to be considered.
     std::vector<std::pair<std::string, storm::expressions::Expression>> rewardExpressions;
 
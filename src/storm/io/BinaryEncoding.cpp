@@ -0,0 +1,378 @@
+#include "storm/io/BinaryEncoding.h"
+
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+// Identifies the format (including its version) at the beginning of the stream.
+std::string const formatIdentifier = "storm-binary-model-v1";
+
+// Writes integers and doubles in their binary representation and all other values as strings.
+class BinaryWriter {
+   public:
+    explicit BinaryWriter(std::ostream& os) : os(os) {
+        // Intentionally left empty.
+    }
+
+    void writeRaw(void const* data, size_t bytes) {
+        os.write(static_cast<char const*>(data), bytes);
+        STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Unable to write the binary model.");
+    }
+
+    void writeInteger(uint64_t value) {
+        writeRaw(&value, sizeof(uint64_t));
+    }
+
+    void writeString(std::string const& value) {
+        writeInteger(value.size());
+        writeRaw(value.data(), value.size());
+    }
+
+    template<typename ValueType>
+    void writeValue(ValueType const& value) {
+        if constexpr (std::is_same<ValueType, double>::value) {
+            writeRaw(&value, sizeof(double));
+        } else {
+            writeString(storm::utility::to_string(value));
+        }
+    }
+
+    template<typename ValueType>
+    void writeVector(std::vector<ValueType> const& values) {
+        writeInteger(values.size());
+        if constexpr (std::is_same<ValueType, double>::value) {
+            writeRaw(values.data(), values.size() * sizeof(double));
+        } else {
+            for (auto const& value : values) {
+                writeValue(value);
+            }
+        }
+    }
+
+    void writeBitVector(storm::storage::BitVector const& bitVector) {
+        writeInteger(bitVector.size());
+        writeInteger(bitVector.getNumberOfSetBits());
+        for (auto index : bitVector) {
+            writeInteger(index);
+        }
+    }
+
+    template<typename ValueType>
+    void writeMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
+        writeInteger(matrix.getRowCount());
+        writeInteger(matrix.getColumnCount());
+        writeInteger(matrix.getEntryCount());
+        writeInteger(matrix.hasTrivialRowGrouping() ? 0 : 1);
+        if (!matrix.hasTrivialRowGrouping()) {
+            writeInteger(matrix.getRowGroupCount());
+            for (auto const& rowGroupIndex : matrix.getRowGroupIndices()) {
+                writeInteger(rowGroupIndex);
+            }
+        }
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            auto const& rowEntries = matrix.getRow(row);
+            writeInteger(rowEntries.getNumberOfEntries());
+            for (auto const& entry : rowEntries) {
+                writeInteger(entry.getColumn());
+                writeValue(entry.getValue());
+            }
+        }
+    }
+
+    template<typename LabelingType, typename GetItemsFunction>
+    void writeLabeling(LabelingType const& labeling, GetItemsFunction const& getItems) {
+        std::set<std::string> labels = labeling.getLabels();
+        writeInteger(labels.size());
+        for (auto const& label : labels) {
+            writeString(label);
+            writeBitVector(getItems(label));
+        }
+    }
+
+   private:
+    std::ostream& os;
+};
+
+// Reads the values written by the BinaryWriter.
+// Length fields are checked against the remaining size of the input (if known) such that corrupt inputs do not lead to huge allocations.
+class BinaryReader {
+   public:
+    explicit BinaryReader(std::istream& is) : is(is), remainingBytes(std::numeric_limits<uint64_t>::max()) {
+        auto position = is.tellg();
+        if (position != std::istream::pos_type(-1) && is.seekg(0, std::ios::end)) {
+            auto end = is.tellg();
+            is.seekg(position);
+            if (end != std::istream::pos_type(-1) && end >= position) {
+                remainingBytes = static_cast<uint64_t>(end - position);
+            }
+        }
+        is.clear();
+    }
+
+    void readRaw(void* data, size_t bytes) {
+        STORM_LOG_THROW(bytes <= remainingBytes, storm::exceptions::FileIoException, "Unexpected end of the binary model.");
+        is.read(static_cast<char*>(data), bytes);
+        STORM_LOG_THROW(is.good(), storm::exceptions::FileIoException, "Unexpected end of the binary model.");
+        if (remainingBytes != std::numeric_limits<uint64_t>::max()) {
+            remainingBytes -= bytes;
+        }
+    }
+
+    // Reads a length field and checks that the given number of bytes per item still fits into the input.
+    uint64_t readLength(uint64_t bytesPerItem) {
+        uint64_t length = readInteger();
+        STORM_LOG_THROW(length <= remainingBytes / bytesPerItem, storm::exceptions::WrongFormatException, "Invalid length in the binary model.");
+        return length;
+    }
+
+    uint64_t readInteger() {
+        uint64_t result;
+        readRaw(&result, sizeof(uint64_t));
+        return result;
+    }
+
+    std::string readString() {
+        std::string result(readLength(1), '\0');
+        if (!result.empty()) {
+            readRaw(&result[0], result.size());
+        }
+        return result;
+    }
+
+    template<typename ValueType>
+    ValueType readValue() {
+        if constexpr (std::is_same<ValueType, double>::value) {
+            double result;
+            readRaw(&result, sizeof(double));
+            return result;
+        } else {
+            return storm::utility::convertNumber<ValueType>(readString());
+        }
+    }
+
+    template<typename ValueType>
+    std::vector<ValueType> readVector() {
+        std::vector<ValueType> result;
+        // Values are stored as double or as a string (which takes at least the bytes of its length field).
+        uint64_t size = readLength(sizeof(uint64_t));
+        if constexpr (std::is_same<ValueType, double>::value) {
+            result.resize(size);
+            readRaw(result.data(), size * sizeof(double));
+        } else {
+            result.reserve(size);
+            for (uint64_t index = 0; index < size; ++index) {
+                result.push_back(readValue<ValueType>());
+            }
+        }
+        return result;
+    }
+
+    storm::storage::BitVector readBitVector(uint64_t expectedSize) {
+        uint64_t size = readInteger();
+        STORM_LOG_THROW(size == expectedSize, storm::exceptions::WrongFormatException, "Invalid size of a bit vector in the binary model.");
+        storm::storage::BitVector result(size);
+        uint64_t numberOfSetBits = readLength(sizeof(uint64_t));
+        for (uint64_t bit = 0; bit < numberOfSetBits; ++bit) {
+            uint64_t index = readInteger();
+            STORM_LOG_THROW(index < result.size(), storm::exceptions::WrongFormatException, "Invalid index in the binary model.");
+            result.set(index);
+        }
+        return result;
+    }
+
+    template<typename ValueType>
+    storm::storage::SparseMatrix<ValueType> readMatrix() {
+        // Each row stores its number of entries and each entry stores its column and its value.
+        uint64_t rowCount = readLength(sizeof(uint64_t));
+        uint64_t columnCount = readInteger();
+        uint64_t entryCount = readLength(2 * sizeof(uint64_t));
+        bool hasCustomRowGrouping = readInteger() != 0;
+        std::vector<uint64_t> rowGroupIndices;
+        if (hasCustomRowGrouping) {
+            rowGroupIndices.resize(readLength(sizeof(uint64_t)) + 1);
+            uint64_t previousRowGroupIndex = 0;
+            for (auto& rowGroupIndex : rowGroupIndices) {
+                rowGroupIndex = readInteger();
+                STORM_LOG_THROW(previousRowGroupIndex <= rowGroupIndex && rowGroupIndex <= rowCount, storm::exceptions::WrongFormatException,
+                                "Invalid row group in the binary model.");
+                previousRowGroupIndex = rowGroupIndex;
+            }
+        }
+        uint64_t rowGroupCount = hasCustomRowGrouping ? rowGroupIndices.size() - 1 : 0;
+
+        storm::storage::SparseMatrixBuilder<ValueType> builder(rowCount, columnCount, entryCount, true, hasCustomRowGrouping, rowGroupCount);
+        uint64_t rowGroup = 0;
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            for (; rowGroup < rowGroupCount && rowGroupIndices[rowGroup] <= row; ++rowGroup) {
+                builder.newRowGroup(rowGroupIndices[rowGroup]);
+            }
+            uint64_t numberOfEntries = readLength(2 * sizeof(uint64_t));
+            for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                uint64_t column = readInteger();
+                STORM_LOG_THROW(column < columnCount, storm::exceptions::WrongFormatException, "Invalid column in the binary model.");
+                builder.addNextValue(row, column, readValue<ValueType>());
+            }
+        }
+        for (; rowGroup < rowGroupCount; ++rowGroup) {
+            builder.newRowGroup(rowGroupIndices[rowGroup]);
+        }
+        return builder.build(rowCount, columnCount, rowGroupCount);
+    }
+
+    template<typename LabelingType>
+    LabelingType readLabeling(uint64_t numberOfItems) {
+        LabelingType labeling(numberOfItems);
+        uint64_t numberOfLabels = readInteger();
+        for (uint64_t label = 0; label < numberOfLabels; ++label) {
+            std::string name = readString();
+            labeling.addLabel(name, readBitVector(numberOfItems));
+        }
+        return labeling;
+    }
+
+   private:
+    std::istream& is;
+    uint64_t remainingBytes;  // the number of bytes that are left in the input (or the maximal value if unknown)
+};
+}  // namespace
+
+template<typename ValueType>
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel) {
+    storm::models::ModelType type = sparseModel->getType();
+    STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::Mdp ||
+                        type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp,
+                    storm::exceptions::NotSupportedException, "Exporting models of type " << type << " in the binary format is not supported.");
+    STORM_LOG_THROW(!sparseModel->hasStateValuations() && !sparseModel->hasChoiceOrigins(), storm::exceptions::NotSupportedException,
+                    "Exporting state valuations or choice origins in the binary format is not supported.");
+
+    BinaryWriter writer(os);
+    writer.writeRaw(formatIdentifier.data(), formatIdentifier.size());
+    writer.writeInteger(static_cast<uint64_t>(type));
+    writer.writeMatrix(sparseModel->getTransitionMatrix());
+
+    auto const& stateLabeling = sparseModel->getStateLabeling();
+    writer.writeLabeling(stateLabeling,
+                         [&stateLabeling](std::string const& label) -> storm::storage::BitVector const& { return stateLabeling.getStates(label); });
+
+    writer.writeInteger(sparseModel->getRewardModels().size());
+    for (auto const& nameAndRewardModel : sparseModel->getRewardModels()) {
+        auto const& rewardModel = nameAndRewardModel.second;
+        writer.writeString(nameAndRewardModel.first);
+        writer.writeInteger(rewardModel.hasStateRewards() ? 1 : 0);
+        if (rewardModel.hasStateRewards()) {
+            writer.writeVector(rewardModel.getStateRewardVector());
+        }
+        writer.writeInteger(rewardModel.hasStateActionRewards() ? 1 : 0);
+        if (rewardModel.hasStateActionRewards()) {
+            writer.writeVector(rewardModel.getStateActionRewardVector());
+        }
+        writer.writeInteger(rewardModel.hasTransitionRewards() ? 1 : 0);
+        if (rewardModel.hasTransitionRewards()) {
+            writer.writeMatrix(rewardModel.getTransitionRewardMatrix());
+        }
+    }
+
+    writer.writeInteger(sparseModel->hasChoiceLabeling() ? 1 : 0);
+    if (sparseModel->hasChoiceLabeling()) {
+        auto const& choiceLabeling = sparseModel->getChoiceLabeling();
+        writer.writeLabeling(choiceLabeling,
+                             [&choiceLabeling](std::string const& label) -> storm::storage::BitVector const& { return choiceLabeling.getChoices(label); });
+    }
+
+    if (type == storm::models::ModelType::Ctmc) {
+        writer.writeVector(sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector());
+    } else if (type == storm::models::ModelType::MarkovAutomaton) {
+        auto const& markovAutomaton = *sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+        writer.writeVector(markovAutomaton.getExitRates());
+        writer.writeBitVector(markovAutomaton.getMarkovianStates());
+    } else if (type == storm::models::ModelType::Pomdp) {
+        auto const& observations = sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservations();
+        writer.writeInteger(observations.size());
+        for (auto const& observation : observations) {
+            writer.writeInteger(observation);
+        }
+    }
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> binaryImportSparseModel(std::istream& is) {
+    std::string identifier(formatIdentifier.size(), '\0');
+    is.read(&identifier[0], identifier.size());
+    STORM_LOG_THROW(is.good() && identifier == formatIdentifier, storm::exceptions::WrongFormatException,
+                    "The input is not a model in the binary format of this version of Storm.");
+    BinaryReader reader(is);
+
+    storm::models::ModelType type = static_cast<storm::models::ModelType>(reader.readInteger());
+    storm::storage::sparse::ModelComponents<ValueType> components(reader.readMatrix<ValueType>());
+    uint64_t numberOfStates = components.transitionMatrix.getRowGroupCount();
+    components.stateLabeling = reader.readLabeling<storm::models::sparse::StateLabeling>(numberOfStates);
+
+    uint64_t numberOfRewardModels = reader.readInteger();
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < numberOfRewardModels; ++rewardModelIndex) {
+        std::string name = reader.readString();
+        std::optional<std::vector<ValueType>> stateRewards, stateActionRewards;
+        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+        if (reader.readInteger() != 0) {
+            stateRewards = reader.readVector<ValueType>();
+        }
+        if (reader.readInteger() != 0) {
+            stateActionRewards = reader.readVector<ValueType>();
+        }
+        if (reader.readInteger() != 0) {
+            transitionRewards = reader.readMatrix<ValueType>();
+        }
+        components.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards),
+                                                                                                   std::move(transitionRewards)));
+    }
+
+    if (reader.readInteger() != 0) {
+        components.choiceLabeling = reader.readLabeling<storm::models::sparse::ChoiceLabeling>(components.transitionMatrix.getRowCount());
+    }
+
+    if (type == storm::models::ModelType::Ctmc) {
+        // The transition matrix of a CTMC contains the rates.
+        components.rateTransitions = true;
+        components.exitRates = reader.readVector<ValueType>();
+    } else if (type == storm::models::ModelType::MarkovAutomaton) {
+        components.exitRates = reader.readVector<ValueType>();
+        components.markovianStates = reader.readBitVector(numberOfStates);
+    } else if (type == storm::models::ModelType::Pomdp) {
+        std::vector<uint32_t> observations(reader.readLength(sizeof(uint64_t)));
+        for (auto& observation : observations) {
+            observation = static_cast<uint32_t>(reader.readInteger());
+        }
+        components.observabilityClasses = std::move(observations);
+    } else {
+        STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Mdp, storm::exceptions::WrongFormatException,
+                        "Unexpected model type in the binary model.");
+    }
+
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+template void binaryExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+template std::shared_ptr<storm::models::sparse::Model<double>> binaryImportSparseModel<double>(std::istream& is);
+template void binaryExportSparseModel<storm::RationalNumber>(std::ostream& os,
+                                                             std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> const& sparseModel);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> binaryImportSparseModel<storm::RationalNumber>(std::istream& is);
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports a sparse model in a compact binary format that can be read back without any parsing effort. The format
+ * is only intended for caching models and may change between versions of Storm.
+ *
+ * The transition matrix, the state labeling, the reward models and the choice labeling are exported as well as the
+ * exit rates and Markovian states of continuous-time models and the observations of POMDPs. State valuations and
+ * choice origins are not exported.
+ *
+ * @param os The (binary) stream to export to.
+ * @param sparseModel The model to export. Currently, DTMCs, CTMCs, MDPs, MAs and POMDPs are supported.
+ */
+template<typename ValueType>
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel);
+
+/*!
+ * Imports a sparse model that was exported with binaryExportSparseModel.
+ *
+ * @param is The (binary) stream to import from.
+ * @return The imported model.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> binaryImportSparseModel(std::istream& is);
+
+}  // namespace exporter
+}  // namespace storm
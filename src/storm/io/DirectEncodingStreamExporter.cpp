@@ -0,0 +1,307 @@
+#include "storm/io/DirectEncodingStreamExporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+// The size of the buffer that is used when reading the temporary file.
+size_t const readBufferSize = 1 << 20;
+
+/*!
+ * The representation of values in the temporary file: doubles are stored in binary, all other types as strings (they
+ * only need to be written to the output again).
+ */
+template<typename ValueType>
+using StoredValueType = typename std::conditional<std::is_same<ValueType, double>::value, double, std::string>::type;
+
+// Reads the temporary file sequentially in large chunks.
+class RecordReader {
+   public:
+    explicit RecordReader(std::FILE* file) : file(file), buffer(readBufferSize), position(0), size(0) {
+        // Intentionally left empty.
+    }
+
+    void read(void* destination, size_t bytes) {
+        char* target = static_cast<char*>(destination);
+        while (bytes > 0) {
+            if (position == size) {
+                size = std::fread(buffer.data(), 1, buffer.size(), file);
+                position = 0;
+                STORM_LOG_THROW(size > 0, storm::exceptions::FileIoException, "Unable to read the temporary file of the model export.");
+            }
+            size_t chunk = std::min(bytes, size - position);
+            std::memcpy(target, buffer.data() + position, chunk);
+            position += chunk;
+            target += chunk;
+            bytes -= chunk;
+        }
+    }
+
+    uint64_t readInteger() {
+        uint64_t result;
+        read(&result, sizeof(uint64_t));
+        return result;
+    }
+
+    std::string readString() {
+        std::string result(readInteger(), '\0');
+        if (!result.empty()) {
+            read(&result[0], result.size());
+        }
+        return result;
+    }
+
+    template<typename ValueType>
+    StoredValueType<ValueType> readValue() {
+        if constexpr (std::is_same<ValueType, double>::value) {
+            double result;
+            read(&result, sizeof(double));
+            return result;
+        } else {
+            return readString();
+        }
+    }
+
+   private:
+    std::FILE* file;
+    std::vector<char> buffer;
+    size_t position;
+    size_t size;
+};
+
+template<typename ValueType>
+void writeRewards(std::ostream& os, RecordReader& reader, uint64_t numberOfRewardModels) {
+    for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+        os << (rewardModel == 0 ? " [" : ", ") << reader.readValue<ValueType>();
+    }
+    if (numberOfRewardModels > 0) {
+        os << "]";
+    }
+}
+}  // namespace
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::FileCloser::operator()(std::FILE* file) const {
+    std::fclose(file);
+}
+
+template<typename ValueType>
+DirectEncodingStreamExporter<ValueType>::DirectEncodingStreamExporter(storm::models::ModelType const& modelType,
+                                                                      std::vector<std::string> const& rewardModelNames, bool exportChoiceLabels)
+    : modelType(modelType),
+      rewardModelNames(rewardModelNames),
+      exportChoiceLabels(exportChoiceLabels),
+      numberOfStates(0),
+      numberOfChoices(0),
+      hasCurrentState(false),
+      file(std::tmpfile()) {
+    STORM_LOG_THROW(modelType == storm::models::ModelType::Dtmc || modelType == storm::models::ModelType::Ctmc || modelType == storm::models::ModelType::Mdp,
+                    storm::exceptions::NotSupportedException, "Exporting models of type " << modelType << " during the exploration is not supported.");
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Unable to create a temporary file for the model export.");
+}
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::newState(std::vector<ValueType> const& stateRewards) {
+    STORM_LOG_ASSERT(stateRewards.size() == rewardModelNames.size(), "Unexpected number of state rewards.");
+    if (hasCurrentState) {
+        flushState();
+    }
+    hasCurrentState = true;
+    currentStateRewards = stateRewards;
+    currentChoices.clear();
+    ++numberOfStates;
+}
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::newChoice(std::set<std::string> const& labels, std::vector<ValueType> const& actionRewards) {
+    STORM_LOG_ASSERT(hasCurrentState, "Cannot add a choice without a state.");
+    STORM_LOG_ASSERT(actionRewards.size() == rewardModelNames.size(), "Unexpected number of action rewards.");
+    STORM_LOG_ASSERT(modelType == storm::models::ModelType::Mdp || currentChoices.empty(), "Deterministic models must have one choice per state.");
+    currentChoices.push_back(Choice{exportChoiceLabels ? labels : std::set<std::string>(), actionRewards, {}});
+    ++numberOfChoices;
+}
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::addTransition(uint64_t column, ValueType const& value) {
+    STORM_LOG_ASSERT(!currentChoices.empty(), "Cannot add a transition without a choice.");
+    currentChoices.back().transitions.emplace_back(column, value);
+}
+
+template<typename ValueType>
+uint64_t DirectEncodingStreamExporter<ValueType>::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+template<typename ValueType>
+uint64_t DirectEncodingStreamExporter<ValueType>::getNumberOfChoices() const {
+    return numberOfChoices;
+}
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::appendInteger(uint64_t value) {
+    char const* bytes = reinterpret_cast<char const*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(uint64_t));
+}
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::appendString(std::string const& value) {
+    appendInteger(value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::appendValue(ValueType const& value) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        char const* bytes = reinterpret_cast<char const*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(double));
+    } else {
+        std::stringstream stream;
+        stream << value;
+        appendString(stream.str());
+    }
+}
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::flushState() {
+    // A record consists of the exit rate (only for CTMCs), the state rewards and the choices. Each choice consists of
+    // its labels (only if choice labels are exported), its action rewards and its transitions.
+    buffer.clear();
+    if (modelType == storm::models::ModelType::Ctmc) {
+        ValueType exitRate = storm::utility::zero<ValueType>();
+        for (auto const& choice : currentChoices) {
+            for (auto const& transition : choice.transitions) {
+                exitRate += transition.second;
+            }
+        }
+        appendValue(exitRate);
+    }
+    for (auto const& reward : currentStateRewards) {
+        appendValue(reward);
+    }
+    appendInteger(currentChoices.size());
+    for (auto const& choice : currentChoices) {
+        if (exportChoiceLabels) {
+            appendInteger(choice.labels.size());
+            for (auto const& label : choice.labels) {
+                appendString(label);
+            }
+        }
+        for (auto const& reward : choice.rewards) {
+            appendValue(reward);
+        }
+        appendInteger(choice.transitions.size());
+        for (auto const& transition : choice.transitions) {
+            appendInteger(transition.first);
+            appendValue(transition.second);
+        }
+    }
+    STORM_LOG_THROW(std::fwrite(buffer.data(), 1, buffer.size(), file.get()) == buffer.size(), storm::exceptions::FileIoException,
+                    "Unable to write to the temporary file of the model export.");
+    hasCurrentState = false;
+}
+
+template<typename ValueType>
+void DirectEncodingStreamExporter<ValueType>::exportModel(std::ostream& os, storm::models::sparse::StateLabeling const& stateLabeling,
+                                                          std::vector<std::string> const& parameters, std::vector<uint_fast64_t> const* columnRemapping) {
+    if (hasCurrentState) {
+        flushState();
+    }
+    STORM_LOG_THROW(std::fflush(file.get()) == 0 && std::fseek(file.get(), 0, SEEK_SET) == 0, storm::exceptions::FileIoException,
+                    "Unable to read the temporary file of the model export.");
+    RecordReader reader(file.get());
+
+    // Write header
+    os << "// Exported by storm\n";
+    os << "// Original model type: " << modelType << '\n';
+    os << "@type: " << modelType << '\n';
+    os << "@parameters\n";
+    for (std::string const& parameter : parameters) {
+        os << parameter << " ";
+    }
+    os << '\n';
+    os << "@reward_models\n";
+    for (auto const& rewardModelName : rewardModelNames) {
+        os << rewardModelName << " ";
+    }
+    os << '\n';
+    os << "@nr_states\n" << numberOfStates << '\n';
+    os << "@nr_choices\n" << numberOfChoices << '\n';
+    os << "@model\n";
+
+    std::vector<std::pair<uint64_t, StoredValueType<ValueType>>> transitions;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        os << "state " << state;
+        if (modelType == storm::models::ModelType::Ctmc) {
+            os << " !" << reader.readValue<ValueType>();
+        }
+        writeRewards<ValueType>(os, reader, rewardModelNames.size());
+
+        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+        for (auto const& label : stateLabeling.getLabelsOfState(state)) {
+            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+                os << " \"" << label << "\"";
+            } else {
+                os << " " << label;
+            }
+        }
+        os << '\n';
+
+        uint64_t numberOfChoicesOfState = reader.readInteger();
+        for (uint64_t choice = 0; choice < numberOfChoicesOfState; ++choice) {
+            os << "\taction ";
+            if (exportChoiceLabels) {
+                uint64_t numberOfLabels = reader.readInteger();
+                if (numberOfLabels == 0) {
+                    os << "__NOLABEL__";
+                }
+                for (uint64_t label = 0; label < numberOfLabels; ++label) {
+                    os << reader.readString();
+                }
+            } else {
+                os << choice;
+            }
+            writeRewards<ValueType>(os, reader, rewardModelNames.size());
+            os << '\n';
+
+            // The columns need to be sorted again after they were remapped.
+            transitions.resize(reader.readInteger());
+            for (auto& transition : transitions) {
+                transition.first = reader.readInteger();
+                if (columnRemapping) {
+                    transition.first = (*columnRemapping)[transition.first];
+                }
+                transition.second = reader.readValue<ValueType>();
+            }
+            if (columnRemapping) {
+                std::sort(transitions.begin(), transitions.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+            }
+            for (auto const& transition : transitions) {
+                os << "\t\t" << transition.first << " : " << transition.second << '\n';
+            }
+        }
+    }
+}
+
+template class DirectEncodingStreamExporter<double>;
+#ifdef STORM_HAVE_CARL
+template class DirectEncodingStreamExporter<storm::RationalNumber>;
+template class DirectEncodingStreamExporter<storm::RationalFunction>;
+#endif
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/models/ModelType.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+class StateLabeling;
+}
+}  // namespace models
+
+namespace exporter {
+
+/*!
+ * Exports a model in the explicit DRN format while it is explored, i.e., without building the model in memory.
+ *
+ * The number of states and choices (which are part of the header) as well as the state labels are only known once the
+ * exploration is complete. Hence, the states are first appended to a temporary file in a compact binary encoding and
+ * the DRN output is produced in a second sequential pass over this file. During this pass, the columns can be remapped
+ * to the final state indices (e.g. if the states were explored in depth-first order).
+ *
+ * Currently, DTMCs, CTMCs and MDPs are supported. No placeholders are introduced for the values.
+ */
+template<typename ValueType>
+class DirectEncodingStreamExporter {
+   public:
+    /*!
+     * Creates an exporter for a model of the given type.
+     *
+     * @param modelType The type of the model.
+     * @param rewardModelNames The names of the reward models, in the order in which the rewards are given.
+     * @param exportChoiceLabels If set, the actions are named by their choice labels instead of their local index.
+     */
+    DirectEncodingStreamExporter(storm::models::ModelType const& modelType, std::vector<std::string> const& rewardModelNames, bool exportChoiceLabels);
+
+    DirectEncodingStreamExporter(DirectEncodingStreamExporter const&) = delete;
+    DirectEncodingStreamExporter& operator=(DirectEncodingStreamExporter const&) = delete;
+
+    /*!
+     * Starts the next state. States have to be added in the order of their (final) indices.
+     *
+     * @param stateRewards The state rewards of the state (one value per reward model).
+     */
+    void newState(std::vector<ValueType> const& stateRewards);
+
+    /*!
+     * Starts the next choice of the current state.
+     *
+     * @param labels The labels of the choice (only relevant if choice labels are exported).
+     * @param actionRewards The action rewards of the choice (one value per reward model).
+     */
+    void newChoice(std::set<std::string> const& labels, std::vector<ValueType> const& actionRewards);
+
+    /*!
+     * Adds a transition to the current choice. For CTMCs, the value is the rate of the transition.
+     */
+    void addTransition(uint64_t column, ValueType const& value);
+
+    uint64_t getNumberOfStates() const;
+    uint64_t getNumberOfChoices() const;
+
+    /*!
+     * Writes the model that was given so far to the given stream.
+     *
+     * @param os The stream to write to.
+     * @param stateLabeling The labeling of the (final) states.
+     * @param parameters The names of the parameters of the model.
+     * @param columnRemapping If given, the columns of the transitions are replaced by the values of this mapping.
+     */
+    void exportModel(std::ostream& os, storm::models::sparse::StateLabeling const& stateLabeling, std::vector<std::string> const& parameters,
+                     std::vector<uint_fast64_t> const* columnRemapping = nullptr);
+
+   private:
+    struct Choice {
+        std::set<std::string> labels;
+        std::vector<ValueType> rewards;
+        std::vector<std::pair<uint64_t, ValueType>> transitions;
+    };
+
+    // Appends the current state to the temporary file.
+    void flushState();
+
+    // Appends a value to the record of the current state.
+    void appendValue(ValueType const& value);
+    void appendInteger(uint64_t value);
+    void appendString(std::string const& value);
+
+    struct FileCloser {
+        void operator()(std::FILE* file) const;
+    };
+
+    storm::models::ModelType modelType;
+    std::vector<std::string> rewardModelNames;
+    bool exportChoiceLabels;
+
+    uint64_t numberOfStates;
+    uint64_t numberOfChoices;
+
+    // The current state that is not yet written to the temporary file.
+    bool hasCurrentState;
+    std::vector<ValueType> currentStateRewards;
+    std::vector<Choice> currentChoices;
+
+    // The temporary file and a buffer for the record of one state.
+    std::unique_ptr<std::FILE, FileCloser> file;
+    std::vector<char> buffer;
+};
+
+}  // namespace exporter
+}  // namespace storm
@@ -1,6 +1,9 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include <array>
+
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -22,6 +25,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -58,6 +62,23 @@ std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> setUpProba
     return solver;
 }
 
+/*!
+ * Multiplies the given matrix with the given vector. If more than one thread is given, ranges of rows are multiplied concurrently.
+ */
+template<typename ValueType>
+void multiplyInRowRanges(Environment const& env, uint64_t numberOfThreads, storm::solver::Multiplier<ValueType> const& multiplier,
+                         storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType>& result) {
+    if (numberOfThreads > 1) {
+        storm::utility::parallel::forEachChunk(numberOfThreads, matrix.getRowCount(), [&](uint64_t firstRow, uint64_t lastRow) {
+            for (uint64_t row = firstRow; row < lastRow; ++row) {
+                result[row] = matrix.multiplyRowWithVector(row, x);
+            }
+        });
+    } else {
+        multiplier.multiply(env, x, nullptr, result);
+    }
+}
+
 template<typename ValueType>
 class UnifPlusHelper {
    public:
@@ -129,19 +150,38 @@ class UnifPlusHelper {
         // The probabilities to go from a probabilistic state to a psi state in one step
         std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
 
-        // Set up a solver for the transitions between probabilistic states (if there are some)
+        // The upper and the lower bound of an outer iteration are computed independently of each other. If multiple threads are available, both bounds are
+        // computed concurrently, each with its own solver, multipliers, and auxiliary memory.
+        uint64_t availableNumberOfThreads = 1;
+        if (storm::utility::parallel::isThreadSafeValueType<ValueType>) {
+            availableNumberOfThreads = storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfThreads());
+        }
+        uint64_t const numberOfThreads = std::min<uint64_t>(2, availableNumberOfThreads);
+        // The remaining threads split the multiplications of every step into row ranges. As the threads are created in every step, this only pays off for
+        // sufficiently large matrices.
+        uint64_t const minimalEntryCountForRowRanges = 1ull << 16;
+        uint64_t const markovianMultiplicationThreads =
+            markovianToMaybeTransitions.getEntryCount() >= minimalEntryCountForRowRanges ? availableNumberOfThreads / numberOfThreads : 1;
+        uint64_t const probabilisticMultiplicationThreads =
+            probabilisticToMarkovianTransitions.getEntryCount() >= minimalEntryCountForRowRanges ? availableNumberOfThreads / numberOfThreads : 1;
         Environment solverEnv = env;
         solverEnv.solver().setForceExact(true);  // Errors within the inner iterations can propagate significantly
-        auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
-
-        // Allocate auxiliary memory that can be used during the iterations
+        std::vector<InnerIterationData> innerIterationData(numberOfThreads);
+        for (auto& data : innerIterationData) {
+            // Set up a solver for the transitions between probabilistic states (if there are some)
+            data.solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+            // The transitions from probabilistic to Markovian states are not affected by uniformization, so the multiplier can be kept for all iterations
+            data.probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+            // Allocate auxiliary memory that can be used during the iterations
+            data.nextMarkovianStateValues.resize(markovianMaybeStates.getNumberOfSetBits());
+            data.nextProbabilisticStateValues.resize(probabilisticToProbabilisticTransitions.getRowGroupCount());
+            data.eqSysRhs.resize(probabilisticToProbabilisticTransitions.getRowCount());
+        }
         std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
         std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
         std::vector<ValueType> maybeStatesValuesUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> nextMarkovianStateValues = std::move(
-            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
-        std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
-        std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
+        markovianExitRates.clear();
+        markovianExitRates.shrink_to_fit();  // At this point, the markovianExitRates are no longer needed
 
         // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
         storm::utility::ProgressMeasurement progressIterations("iterations");
@@ -158,19 +198,20 @@ class UnifPlusHelper {
             // Scale the weights so they sum to one.
             // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
 
-            // Set up multiplier
-            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+            // Set up the multipliers for the current uniformization rate
+            for (auto& data : innerIterationData) {
+                data.markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
+            }
 
-            // Perform inner iterations first for upper, then for lower bound
-            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-            for (bool computeLowerBound : {false, true}) {
+            // Performs the inner iterations for the upper or the lower bound. Returns true if the iterations have been aborted.
+            auto performInnerIterations = [&](bool computeLowerBound, InnerIterationData& data) {
                 auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
                 ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
                 storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
                                                                   std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
                 progressSteps.setMaxCount(N);
                 progressSteps.startNewMeasurement(0);
+                bool aborted = false;
                 bool firstIteration = true;  // The first iterations can be irrelevant, because they will only produce zeroes anyway.
                 int64_t k = N;
                 // Iteration k = N is always non-relevant
@@ -197,12 +238,13 @@ class UnifPlusHelper {
                         // Reaching this point means that this is the very first relevant iteration.
                         // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
                         // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
-                        std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+                        std::fill(data.nextMarkovianStateValues.begin(), data.nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
                     } else {
                         // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                        multiplyInRowRanges(env, markovianMultiplicationThreads, *data.markovianToMaybeMultiplier, markovianToMaybeTransitions,
+                                            maybeStatesValues, data.nextMarkovianStateValues);
                         for (auto const& oneStepProb : markovianToPsiProbabilities) {
-                            nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
+                            data.nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
                         }
                     }
 
@@ -214,21 +256,22 @@ class UnifPlusHelper {
                     }
 
                     // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                    multiplyInRowRanges(env, probabilisticMultiplicationThreads, *data.probabilisticToMarkovianMultiplier, probabilisticToMarkovianTransitions,
+                                        data.nextMarkovianStateValues, data.eqSysRhs);
                     for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
+                        data.eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
                     }
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                    if (data.solver) {
+                        data.solver->solveEquations(solverEnv, dir, data.nextProbabilisticStateValues, data.eqSysRhs);
                     } else {
-                        storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
+                        storm::utility::vector::reduceVectorMinOrMax(dir, data.eqSysRhs, data.nextProbabilisticStateValues,
                                                                      probabilisticToProbabilisticTransitions.getRowGroupIndices());
                     }
 
                     // Create the new values for the maybestates
                     // Fuse the results together
-                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, data.nextMarkovianStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, data.nextProbabilisticStateValues);
                     if (!computeLowerBound) {
                         // Add the scaled values to the actual result vector
                         uint64_t i = N - 1 - k;
@@ -241,7 +284,7 @@ class UnifPlusHelper {
 
                     progressSteps.updateProgress(N - k);
                     if (storm::utility::resources::isTerminate()) {
-                        abortedInnerIterations = true;
+                        aborted = true;
                         break;
                     }
                 }
@@ -251,18 +294,11 @@ class UnifPlusHelper {
                 } else {
                     storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                 }
+                return aborted;
+            };
 
-                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                    break;
-                }
-
-                // Check if the lower and upper bound are sufficiently close to each other
-                converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
-                if (converged) {
-                    break;
-                }
-
-                // Store the best solution we have found so far.
+            // Stores the best solution we have found so far.
+            auto storeBestKnownSolution = [&]() {
                 if (relevantMaybeStates) {
                     auto currentSolIt = bestKnownSolution.begin();
                     for (auto state : relevantMaybeStates.get()) {
@@ -271,6 +307,38 @@ class UnifPlusHelper {
                         ++currentSolIt;
                     }
                 }
+            };
+
+            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
+            if (numberOfThreads > 1) {
+                // Perform inner iterations for upper and lower bound concurrently
+                std::array<bool, 2> abortedBounds{false, false};
+                storm::utility::parallel::executeTasks(numberOfThreads, 2, [&](uint64_t task, uint64_t thread) {
+                    abortedBounds[task] = performInnerIterations(task == 1, innerIterationData[thread]);
+                });
+                abortedInnerIterations = abortedBounds[0] || abortedBounds[1];
+                if (!abortedInnerIterations && !storm::utility::resources::isTerminate()) {
+                    // Check if the lower and upper bound are sufficiently close to each other
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (!converged) {
+                        storeBestKnownSolution();
+                    }
+                }
+            } else {
+                // Perform inner iterations first for upper, then for lower bound
+                for (bool computeLowerBound : {false, true}) {
+                    abortedInnerIterations = performInnerIterations(computeLowerBound, innerIterationData.front());
+                    if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+
+                    // Check if the lower and upper bound are sufficiently close to each other
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (converged) {
+                        break;
+                    }
+                    storeBestKnownSolution();
+                }
             }
 
             if (!converged) {
@@ -326,6 +394,18 @@ class UnifPlusHelper {
     }
 
    private:
+    /*!
+     * Data needed to perform the inner iterations for one bound. Each thread has its own copy so that the bounds can be computed concurrently.
+     */
+    struct InnerIterationData {
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> markovianToMaybeMultiplier;
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> probabilisticToMarkovianMultiplier;
+        std::vector<ValueType> nextMarkovianStateValues;
+        std::vector<ValueType> nextProbabilisticStateValues;
+        std::vector<ValueType> eqSysRhs;
+    };
+
     bool checkConvergence(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper,
                           boost::optional<storm::storage::BitVector> const& relevantValues, ValueType const& epsilon, bool relative, ValueType& kappa) {
         STORM_LOG_ASSERT(!relevantValues.is_initialized() || relevantValues->size() == lower.size(), "Relevant values size mismatch.");
@@ -1,5 +1,10 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <thread>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
@@ -12,6 +17,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/storage/jani/Model.h"
 #include "storm/storage/prism/Program.h"
 
 #include "storm/logic/FragmentSpecification.h"
@@ -29,6 +35,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -40,7 +47,20 @@ namespace modelchecker {
 
 template<typename ModelType, typename StateType>
 SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
-    : program(program.substituteConstantsFormulas()),
+    : SparseExplorationModelChecker(storm::storage::SymbolicModelDescription(program)) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::jani::Model const& model)
+    : SparseExplorationModelChecker(storm::storage::SymbolicModelDescription(model)) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::storage::SymbolicModelDescription const& model)
+    : model(model.isPrismProgram() ? storm::storage::SymbolicModelDescription(model.asPrismProgram().substituteConstantsFormulas())
+                                   : storm::storage::SymbolicModelDescription(model.asJaniModel().substituteConstantsFunctions())),
       randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
       comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
     // Intentionally left empty.
@@ -59,7 +79,7 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     storm::logic::UntilFormula const& untilFormula = checkTask.getFormula();
     storm::logic::Formula const& conditionFormula = untilFormula.getLeftSubformula();
     storm::logic::Formula const& targetFormula = untilFormula.getRightSubformula();
-    STORM_LOG_THROW(program.isDeterministicModel() || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+    STORM_LOG_THROW(isDeterministicModel() || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
                     "For nondeterministic systems, an optimization direction (min/max) must be given in the property.");
 
     ExplorationInformation<StateType, ValueType> explorationInformation(checkTask.isOptimizationDirectionSet() ? checkTask.getOptimizationDirection()
@@ -68,13 +88,19 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     // The first row group starts at action 0.
     explorationInformation.newRowGroup(0);
 
-    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
-    StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation,
-                                                          conditionFormula.toExpression(program.getManager(), labelToExpressionMapping),
-                                                          targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = getLabelToExpressionMapping();
+    StateGeneration<StateType, ValueType> stateGeneration(model, explorationInformation,
+                                                          conditionFormula.toExpression(model.getManager(), labelToExpressionMapping),
+                                                          targetFormula.toExpression(model.getManager(), labelToExpressionMapping));
 
     // Compute and return result.
-    std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfThreads());
+    std::tuple<StateType, ValueType, ValueType> boundsForInitialState;
+    if (numberOfThreads > 1) {
+        boundsForInitialState = performConcurrentExploration(stateGeneration, explorationInformation, numberOfThreads);
+    } else {
+        boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+    }
     return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
 }
 
@@ -201,11 +227,214 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
     return foundTerminalState;
 }
 
+template<typename ModelType, typename StateType>
+struct SparseExplorationModelChecker<ModelType, StateType>::StateExpansion {
+    bool isTargetState = false;
+    bool isConditionState = false;
+
+    // The behavior of the state. This is only generated for condition states that are not target states.
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+};
+
+template<typename ModelType, typename StateType>
+struct SparseExplorationModelChecker<ModelType, StateType>::ConcurrentExplorationState {
+    ConcurrentExplorationState(ExplorationInformation<StateType, ValueType>& explorationInformation)
+        : explorationInformation(explorationInformation), epoch(0), done(false) {
+        // Intentionally left empty.
+    }
+
+    // Guards all other members as well as the random generator of the model checker.
+    std::mutex mutex;
+
+    ExplorationInformation<StateType, ValueType>& explorationInformation;
+    Bounds<StateType, ValueType> bounds;
+    Statistics<StateType, ValueType> stats;
+
+    // Counts the precomputations. As collapsing MECs moves actions, paths that were sampled across a precomputation are discarded.
+    uint64_t epoch;
+
+    // Set once the bounds of the initial state converged (or one of the threads failed).
+    bool done;
+};
+
+template<typename ModelType, typename StateType>
+std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType>
+SparseExplorationModelChecker<ModelType, StateType>::performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                  ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                  uint64_t numberOfThreads) const {
+    // Generate the initial state so we know where to start the simulation.
+    stateGeneration.computeInitialStates();
+    STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
+                    "Currently only models with one initial state are supported by the exploration engine.");
+    StateType initialStateIndex = stateGeneration.getFirstInitialState();
+
+    ConcurrentExplorationState sharedState(explorationInformation);
+
+    // Every thread needs its own generator. They are created upfront, because creating a generator might modify the expression manager.
+    std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>> threadStateGenerations;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threadStateGenerations.push_back(std::make_unique<StateGeneration<StateType, ValueType>>(stateGeneration, sharedState.mutex));
+    }
+
+    STORM_LOG_INFO("Sampling paths with " << numberOfThreads << " threads.");
+    storm::utility::parallel::executeOnThreads(numberOfThreads, [&](uint64_t thread) {
+        StateActionStack stack;
+        std::unique_lock<std::mutex> lock(sharedState.mutex);
+        try {
+            while (!sharedState.done) {
+                if (!samplePathConcurrently(*threadStateGenerations[thread], sharedState, stack, lock)) {
+                    // The path was abandoned. Give the other threads the chance to make progress before trying again.
+                    lock.unlock();
+                    std::this_thread::yield();
+                    lock.lock();
+                    continue;
+                }
+
+                sharedState.stats.sampledPath();
+                sharedState.stats.updateMaxPathLength(stack.size());
+
+                // Update the bounds along the path to the terminal state.
+                STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, sharedState.bounds);
+
+                ValueType difference = sharedState.bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+                STORM_LOG_DEBUG("Difference after iteration " << sharedState.stats.pathsSampled << " is " << difference << ".");
+                if (comparator.isZero(difference)) {
+                    sharedState.done = true;
+                } else if (explorationInformation.performPrecomputationExcessiveSampledPaths(sharedState.stats.pathsSampledSinceLastPrecomputation)) {
+                    // The precomputation is performed while holding the lock, i.e., the other threads wait until the MECs are collapsed.
+                    performPrecomputation(stack, explorationInformation, sharedState.bounds, sharedState.stats);
+                    ++sharedState.epoch;
+                }
+            }
+        } catch (...) {
+            // Make sure that the other threads terminate as well. The exception is then rethrown in the calling thread.
+            if (!lock.owns_lock()) {
+                lock.lock();
+            }
+            sharedState.done = true;
+            throw;
+        }
+    });
+
+    // Show statistics if required.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        sharedState.stats.printToStream(std::cout, explorationInformation);
+    }
+
+    return std::make_tuple(initialStateIndex, sharedState.bounds.getLowerBoundForState(initialStateIndex, explorationInformation),
+                           sharedState.bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::samplePathConcurrently(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                 ConcurrentExplorationState& sharedState, StateActionStack& stack,
+                                                                                 std::unique_lock<std::mutex>& lock) const {
+    ExplorationInformation<StateType, ValueType>& explorationInformation = sharedState.explorationInformation;
+    uint64_t const pathEpoch = sharedState.epoch;
+
+    // Start the search from the initial state.
+    stack.clear();
+    stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
+
+    // As long as we didn't find a terminal (accepting) state in the search, sample a new successor.
+    bool foundTerminalState = false;
+    while (!foundTerminalState) {
+        StateType const currentStateId = stack.back().first;
+        STORM_LOG_TRACE("State on top of stack is: " << currentStateId << ".");
+
+        auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+        if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+            STORM_LOG_TRACE("State was not yet explored.");
+
+            // Claim the state and expand it without holding the lock, such that the other threads can continue meanwhile.
+            storm::generator::CompressedState compressedState = unexploredIt->second;
+            explorationInformation.removeUnexploredState(unexploredIt);
+            lock.unlock();
+            StateExpansion expansion = expandState(stateGeneration, compressedState);
+            lock.lock();
+            foundTerminalState = insertExpandedState(currentStateId, expansion, explorationInformation, sharedState.bounds, sharedState.stats);
+
+            // If the MECs were collapsed in the meantime, the actions on the stack might have been moved.
+            if (pathEpoch != sharedState.epoch || sharedState.done) {
+                STORM_LOG_TRACE("Aborting sampling of path, because a precomputation was performed concurrently.");
+                stack.clear();
+                return false;
+            }
+        } else if (explorationInformation.isUnexplored(currentStateId)) {
+            // The state is currently being expanded by another thread.
+            STORM_LOG_TRACE("Aborting sampling of path, because state " << currentStateId << " is being explored by another thread.");
+            stack.clear();
+            return false;
+        } else if (explorationInformation.isTerminal(currentStateId)) {
+            STORM_LOG_TRACE("Found already explored terminal state: " << currentStateId << ".");
+            foundTerminalState = true;
+        }
+
+        // Notify the stats about the performed exploration step.
+        sharedState.stats.explorationStep();
+
+        // If the state was not a terminal state, we continue the path search and sample the next state.
+        if (!foundTerminalState) {
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, sharedState.bounds);
+            stack.back().second = chosenAction;
+            STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
+
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, sharedState.bounds);
+            STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
+
+            // Put the successor state and a dummy action on top of the stack.
+            stack.emplace_back(successor, 0);
+
+            // If the number of exploration steps exceeds a certain threshold, do a precomputation.
+            if (explorationInformation.performPrecomputationExcessiveExplorationSteps(sharedState.stats.explorationStepsSinceLastPrecomputation)) {
+                performPrecomputation(stack, explorationInformation, sharedState.bounds, sharedState.stats);
+                ++sharedState.epoch;
+
+                STORM_LOG_TRACE("Aborting the search after precomputation.");
+                stack.clear();
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                                                                        storm::generator::CompressedState const& currentState,
                                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                                        Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+    return insertExpandedState(currentStateId, expandState(stateGeneration, currentState), explorationInformation, bounds, stats);
+}
+
+template<typename ModelType, typename StateType>
+typename SparseExplorationModelChecker<ModelType, StateType>::StateExpansion SparseExplorationModelChecker<ModelType, StateType>::expandState(
+    StateGeneration<StateType, ValueType>& stateGeneration, storm::generator::CompressedState const& currentState) const {
+    StateExpansion expansion;
+
+    // Before generating the behavior of the state, we need to determine whether it's a target state that
+    // does not need to be expanded.
+    stateGeneration.load(currentState);
+    if (stateGeneration.isTargetState()) {
+        expansion.isTargetState = true;
+    } else if (stateGeneration.isConditionState()) {
+        STORM_LOG_TRACE("Exploring state.");
+        expansion.isConditionState = true;
+
+        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
+        expansion.behavior = stateGeneration.expand();
+        STORM_LOG_TRACE("State has " << expansion.behavior.getNumberOfChoices() << " choices.");
+    }
+    return expansion;
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::insertExpandedState(StateType const& currentStateId, StateExpansion const& expansion,
+                                                                              ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                              Bounds<StateType, ValueType>& bounds,
+                                                                              Statistics<StateType, ValueType>& stats) const {
     bool isTerminalState = false;
     bool isTargetState = false;
 
@@ -219,19 +448,12 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
     // all states that have been assigned to a row-group.
     bounds.initializeBoundsForNextState();
 
-    // Before generating the behavior of the state, we need to determine whether it's a target state that
-    // does not need to be expanded.
-    stateGeneration.load(currentState);
-    if (stateGeneration.isTargetState()) {
+    if (expansion.isTargetState) {
         ++stats.numberOfTargetStates;
         isTargetState = true;
         isTerminalState = true;
-    } else if (stateGeneration.isConditionState()) {
-        STORM_LOG_TRACE("Exploring state.");
-
-        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
-        STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
+    } else if (expansion.isConditionState) {
+        storm::generator::StateBehavior<ValueType, StateType> const& behavior = expansion.behavior;
 
         // Clumsily check whether we have found a state that forms a trivial BMEC.
         bool otherSuccessor = false;
@@ -755,6 +977,28 @@ std::pair<typename ModelType::ValueType, typename ModelType::ValueType> SparseEx
     }
 }
 
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::isDeterministicModel() const {
+    return model.isPrismProgram() ? model.asPrismProgram().isDeterministicModel() : model.asJaniModel().isDeterministicModel();
+}
+
+template<typename ModelType, typename StateType>
+std::map<std::string, storm::expressions::Expression> SparseExplorationModelChecker<ModelType, StateType>::getLabelToExpressionMapping() const {
+    if (model.isPrismProgram()) {
+        return model.asPrismProgram().getLabelToExpressionMapping();
+    }
+
+    // In JANI, labels are given as transient boolean variables.
+    std::map<std::string, storm::expressions::Expression> result;
+    storm::jani::Model const& janiModel = model.asJaniModel();
+    for (auto const& variable : janiModel.getGlobalVariables().getTransientVariables()) {
+        if (variable.getType().isBasicType() && variable.getType().asBasicType().isBooleanType()) {
+            result[variable.getName()] = janiModel.getLabelExpression(variable);
+        }
+    }
+    return result;
+}
+
 template class SparseExplorationModelChecker<storm::models::sparse::Dtmc<double>, uint32_t>;
 template class SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t>;
 }  // namespace modelchecker
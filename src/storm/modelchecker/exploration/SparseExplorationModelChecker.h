@@ -1,11 +1,12 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 #define STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 
+#include <mutex>
 #include <random>
 
 #include "storm/modelchecker/AbstractModelChecker.h"
 
-#include "storm/storage/prism/Program.h"
+#include "storm/storage/SymbolicModelDescription.h"
 
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/VariableInformation.h"
@@ -24,6 +25,9 @@ class SparseMatrix;
 namespace prism {
 class Program;
 }
+namespace jani {
+class Model;
+}
 
 namespace modelchecker {
 namespace exploration_detail {
@@ -48,15 +52,46 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     SparseExplorationModelChecker(storm::prism::Program const& program);
 
+    SparseExplorationModelChecker(storm::jani::Model const& model);
+
+    /*!
+     * Creates a model checker for the given PRISM program or JANI model. The model is explored on-the-fly. If the
+     * environment requests more than one thread, the paths are sampled concurrently.
+     */
+    SparseExplorationModelChecker(storm::storage::SymbolicModelDescription const& model);
+
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
 
     virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
                                                                    CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
 
    private:
+    // The result of expanding a single state (before it is inserted into the exploration information).
+    struct StateExpansion;
+
+    // The structures that are shared by the threads of a concurrent exploration.
+    struct ConcurrentExplorationState;
+
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                    ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+    /*!
+     * Performs the exploration with the given number of sampling threads. Each thread has its own next-state
+     * generator and samples paths on the shared exploration information and bounds. These are guarded by a single
+     * lock which is released while a thread expands a state, as this typically dominates the cost of a path.
+     */
+    std::tuple<StateType, ValueType, ValueType> performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                             ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                             uint64_t numberOfThreads) const;
+
+    /*!
+     * Samples a path from the initial state while holding the given lock (which is released while expanding states).
+     * Returns true iff a terminal state was reached. Otherwise, the path was abandoned (e.g. because another thread
+     * was exploring one of its states) and the stack is empty.
+     */
+    bool samplePathConcurrently(StateGeneration<StateType, ValueType>& stateGeneration, ConcurrentExplorationState& sharedState, StateActionStack& stack,
+                                std::unique_lock<std::mutex>& lock) const;
+
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
                                     Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -65,6 +100,12 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                       storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation,
                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
+    StateExpansion expandState(StateGeneration<StateType, ValueType>& stateGeneration, storm::generator::CompressedState const& currentState) const;
+
+    bool insertExpandedState(StateType const& currentStateId, StateExpansion const& expansion,
+                             ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                             Statistics<StateType, ValueType>& stats) const;
+
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
                                    Bounds<StateType, ValueType>& bounds) const;
 
@@ -102,8 +143,12 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     std::pair<ValueType, ValueType> combineBounds(storm::OptimizationDirection const& direction, std::pair<ValueType, ValueType> const& bounds1,
                                                   std::pair<ValueType, ValueType> const& bounds2) const;
 
-    // The program that defines the model to check.
-    storm::prism::Program program;
+    bool isDeterministicModel() const;
+
+    std::map<std::string, storm::expressions::Expression> getLabelToExpressionMapping() const;
+
+    // The PRISM program or JANI model that defines the model to check.
+    storm::storage::SymbolicModelDescription model;
 
     // The random number generator.
     mutable std::default_random_engine randomGenerator;
@@ -1,26 +1,63 @@
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 
 namespace storm {
 namespace modelchecker {
 namespace exploration_detail {
 
+namespace {
+template<typename StateType, typename ValueType>
+std::unique_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> createGenerator(storm::storage::SymbolicModelDescription const& model) {
+    if (model.isPrismProgram()) {
+        return std::make_unique<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(model.asPrismProgram());
+    } else {
+        return std::make_unique<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model.asJaniModel());
+    }
+}
+}  // namespace
+
 template<typename StateType, typename ValueType>
-StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program,
+StateGeneration<StateType, ValueType>::StateGeneration(storm::storage::SymbolicModelDescription const& model,
                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                        storm::expressions::Expression const& conditionStateExpression,
                                                        storm::expressions::Expression const& targetStateExpression)
-    : generator(program),
-      stateStorage(generator.getStateSize()),
+    : model(model),
+      explorationInformation(explorationInformation),
+      generator(createGenerator<StateType, ValueType>(model)),
+      stateStorage(std::make_shared<storm::storage::sparse::StateStorage<StateType>>(generator->getStateSize())),
       conditionStateExpression(conditionStateExpression),
       targetStateExpression(targetStateExpression) {
-    stateToIdCallback = [&explorationInformation, this](storm::generator::CompressedState const& state) -> StateType {
-        StateType newIndex = stateStorage.getNumberOfStates();
+    createStateToIdCallback(nullptr);
+}
+
+template<typename StateType, typename ValueType>
+StateGeneration<StateType, ValueType>::StateGeneration(StateGeneration const& other, std::mutex& mutex)
+    : model(other.model),
+      explorationInformation(other.explorationInformation),
+      generator(createGenerator<StateType, ValueType>(other.model)),
+      stateStorage(other.stateStorage),
+      conditionStateExpression(other.conditionStateExpression),
+      targetStateExpression(other.targetStateExpression) {
+    createStateToIdCallback(&mutex);
+}
+
+template<typename StateType, typename ValueType>
+void StateGeneration<StateType, ValueType>::createStateToIdCallback(std::mutex* mutex) {
+    stateToIdCallback = [mutex, this](storm::generator::CompressedState const& state) -> StateType {
+        std::unique_lock<std::mutex> lock;
+        if (mutex) {
+            lock = std::unique_lock<std::mutex>(*mutex);
+        }
+
+        StateType newIndex = stateStorage->getNumberOfStates();
 
         // Check, if the state was already registered.
-        std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+        std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage->stateToId.findOrAddAndGetBucket(state, newIndex);
 
         if (actualIndexBucketPair.first == newIndex) {
             explorationInformation.addUnexploredState(newIndex, state);
@@ -32,42 +69,42 @@ StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program con
 
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedState const& state) {
-    generator.load(state);
+    generator->load(state);
 }
 
 template<typename StateType, typename ValueType>
 std::vector<StateType> StateGeneration<StateType, ValueType>::getInitialStates() {
-    return stateStorage.initialStateIndices;
+    return stateStorage->initialStateIndices;
 }
 
 template<typename StateType, typename ValueType>
 storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::expand() {
-    return generator.expand(stateToIdCallback);
+    return generator->expand(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 bool StateGeneration<StateType, ValueType>::isConditionState() const {
-    return generator.satisfies(conditionStateExpression);
+    return generator->satisfies(conditionStateExpression);
 }
 
 template<typename StateType, typename ValueType>
 bool StateGeneration<StateType, ValueType>::isTargetState() const {
-    return generator.satisfies(targetStateExpression);
+    return generator->satisfies(targetStateExpression);
 }
 
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::computeInitialStates() {
-    stateStorage.initialStateIndices = generator.getInitialStates(stateToIdCallback);
+    stateStorage->initialStateIndices = generator->getInitialStates(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 StateType StateGeneration<StateType, ValueType>::getFirstInitialState() const {
-    return stateStorage.initialStateIndices.front();
+    return stateStorage->initialStateIndices.front();
 }
 
 template<typename StateType, typename ValueType>
 std::size_t StateGeneration<StateType, ValueType>::getNumberOfInitialStates() const {
-    return stateStorage.initialStateIndices.size();
+    return stateStorage->initialStateIndices.size();
 }
 
 template class StateGeneration<uint32_t, double>;
@@ -1,17 +1,16 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <memory>
+#include <mutex>
+
 #include "storm/generator/CompressedState.h"
-#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/NextStateGenerator.h"
 
+#include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/sparse/StateStorage.h"
 
 namespace storm {
-namespace generator {
-template<typename ValueType, typename StateType>
-class PrismNextStateGenerator;
-}
-
 namespace modelchecker {
 namespace exploration_detail {
 
@@ -21,9 +20,22 @@ class ExplorationInformation;
 template<typename StateType, typename ValueType>
 class StateGeneration {
    public:
-    StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation,
+    /*!
+     * Creates a state generation for the given PRISM program or JANI model.
+     */
+    StateGeneration(storm::storage::SymbolicModelDescription const& model, ExplorationInformation<StateType, ValueType>& explorationInformation,
                     storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
 
+    /*!
+     * Creates a state generation with its own next-state generator that shares the state storage and the exploration
+     * information with the given state generation. This way, several threads can expand states concurrently. All
+     * accesses to the shared structures are guarded by the given mutex, which must not be held while expanding.
+     */
+    StateGeneration(StateGeneration const& other, std::mutex& mutex);
+
+    StateGeneration(StateGeneration const&) = delete;
+    StateGeneration& operator=(StateGeneration const&) = delete;
+
     void load(storm::generator::CompressedState const& state);
 
     std::vector<StateType> getInitialStates();
@@ -41,10 +53,15 @@ class StateGeneration {
     bool isTargetState() const;
 
    private:
-    storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
+    void createStateToIdCallback(std::mutex* mutex);
+
+    storm::storage::SymbolicModelDescription const& model;
+    ExplorationInformation<StateType, ValueType>& explorationInformation;
+
+    std::unique_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
     std::function<StateType(storm::generator::CompressedState const&)> stateToIdCallback;
 
-    storm::storage::sparse::StateStorage<StateType> stateStorage;
+    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage;
 
     storm::expressions::Expression conditionStateExpression;
     storm::expressions::Expression targetStateExpression;
@@ -66,7 +66,17 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
         // Perform the matrix vector multiplication
         auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
         if (lowerBound == 0) {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound);
+            // If the hint contains the result for a smaller step bound, we only need to perform the remaining steps.
+            uint64_t remainingSteps = upperBound;
+            if (hint.isExplicitModelCheckerHint()) {
+                auto const& explicitHint = hint.template asExplicitModelCheckerHint<ValueType>();
+                if (explicitHint.hasResultHint() && explicitHint.hasResultHintStepBound() && explicitHint.getResultHintStepBound() <= upperBound &&
+                    explicitHint.getResultHint().size() == maybeStates.size()) {
+                    subresult = storm::utility::vector::filterVector(explicitHint.getResultHint(), maybeStates);
+                    remainingSteps -= explicitHint.getResultHintStepBound();
+                }
+            }
+            multiplier->repeatedMultiply(env, subresult, &b, remainingSteps);
         } else {
             multiplier->repeatedMultiply(env, subresult, &b, upperBound - lowerBound + 1);
             submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
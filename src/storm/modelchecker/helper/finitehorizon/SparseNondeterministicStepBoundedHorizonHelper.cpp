@@ -65,7 +65,17 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
 
         auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
         if (lowerBound == 0) {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound);
+            // If the hint contains the result for a smaller step bound, we only need to perform the remaining steps.
+            uint64_t remainingSteps = upperBound;
+            if (hint.isExplicitModelCheckerHint()) {
+                auto const& explicitHint = hint.template asExplicitModelCheckerHint<ValueType>();
+                if (explicitHint.hasResultHint() && explicitHint.hasResultHintStepBound() && explicitHint.getResultHintStepBound() <= upperBound &&
+                    explicitHint.getResultHint().size() == maybeStates.size()) {
+                    subresult = storm::utility::vector::filterVector(explicitHint.getResultHint(), maybeStates);
+                    remainingSteps -= explicitHint.getResultHintStepBound();
+                }
+            }
+            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, remainingSteps);
         } else {
             multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound - lowerBound + 1);
             storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
@@ -9,6 +9,7 @@
 #include "storm/storage/Scheduler.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/sparse/AnalysisCache.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 
@@ -43,9 +44,13 @@ SparseDeterministicInfiniteHorizonHelper<ValueType>::SparseDeterministicInfinite
 template<typename ValueType>
 void SparseDeterministicInfiniteHorizonHelper<ValueType>::createDecomposition() {
     if (this->_longRunComponentDecomposition == nullptr) {
-        // The decomposition has not been provided or computed, yet.
-        this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-            this->_transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+        // The decomposition has not been provided or computed, yet. It only depends on the transition matrix, so it is shared between properties.
+        this->_computedLongRunComponentDecomposition =
+            storm::storage::sparse::AnalysisCache::instance().getOrComputeDecomposition<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
+                storm::storage::sparse::AnalysisCache::Key(&this->_transitionMatrix, "bottom sccs"), [this]() {
+                    return storm::storage::StronglyConnectedComponentDecomposition<ValueType>(
+                        this->_transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+                });
         this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
     }
 }
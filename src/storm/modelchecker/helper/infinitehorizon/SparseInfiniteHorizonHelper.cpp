@@ -1,5 +1,9 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
@@ -18,9 +22,11 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
@@ -162,23 +168,91 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     createDecomposition();
 
     // Compute the long-run average for all components in isolation.
+    std::vector<ValueType> componentLraValues = computeComponentLraValues(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter);
+
+    // Solve the resulting SSP where end components are collapsed into single auxiliary states
+    STORM_LOG_INFO("Solving stochastic shortest path problem.");
+    return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeComponentLraValues(Environment const& env,
+                                                                                                           ValueGetter const& stateRewardsGetter,
+                                                                                                           ValueGetter const& actionRewardsGetter) {
     // Set up some logging
+    uint64_t const numberOfComponents = _longRunComponentDecomposition->size();
     std::string const componentString = (Nondeterministic ? std::string("Maximal end") : std::string("Bottom strongly connected")) +
-                                        (_longRunComponentDecomposition->size() == 1 ? std::string(" component") : std::string(" components"));
+                                        (numberOfComponents == 1 ? std::string(" component") : std::string(" components"));
     storm::utility::ProgressMeasurement progress(componentString);
-    progress.setMaxCount(_longRunComponentDecomposition->size());
+    progress.setMaxCount(numberOfComponents);
     progress.startNewMeasurement(0);
-    STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-    std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    STORM_LOG_INFO("Computing long run average values for " << numberOfComponents << " " << componentString << " individually...");
+    std::vector<ValueType> componentLraValues(numberOfComponents);
+
+    uint64_t numberOfThreads = 1;
+    if (storm::utility::parallel::isThreadSafeValueType<ValueType> && numberOfComponents > 1 && isConcurrentComponentComputationSupported(env)) {
+        numberOfThreads = std::min(storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfThreads()), numberOfComponents);
+    }
+    if (numberOfThreads == 1) {
+        for (uint64_t component = 0; component < numberOfComponents; ++component) {
+            componentLraValues[component] =
+                computeLraForComponent(env, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[component]);
+            progress.updateProgress(component + 1);
+        }
+        return componentLraValues;
     }
 
-    // Solve the resulting SSP where end components are collapsed into single auxiliary states
-    STORM_LOG_INFO("Solving stochastic shortest path problem.");
-    return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
+    // Components of very different sizes are common, e.g., many single-state components and a few huge ones. The nontrivial components are processed
+    // first (largest first) such that a huge component is not started last. The single-state components are cheap and are processed in batches.
+    std::vector<uint64_t> nontrivialComponents;
+    std::vector<uint64_t> trivialComponents;
+    for (uint64_t component = 0; component < numberOfComponents; ++component) {
+        if ((*_longRunComponentDecomposition)[component].size() == 1) {
+            trivialComponents.push_back(component);
+        } else {
+            nontrivialComponents.push_back(component);
+        }
+    }
+    std::stable_sort(nontrivialComponents.begin(), nontrivialComponents.end(), [this](uint64_t const& first, uint64_t const& second) {
+        return (*_longRunComponentDecomposition)[first].size() > (*_longRunComponentDecomposition)[second].size();
+    });
+    uint64_t const batchSize = std::max<uint64_t>(64, trivialComponents.size() / (8 * numberOfThreads) + 1);
+    uint64_t const numberOfBatches = (trivialComponents.size() + batchSize - 1) / batchSize;
+
+    // The row grouping of the transition matrix might be created on-the-fly, which is not thread-safe. Hence, we make sure that it exists.
+    _transitionMatrix.getRowGroupIndices();
+
+    STORM_LOG_INFO("Using " << numberOfThreads << " threads for " << nontrivialComponents.size() << " nontrivial and " << trivialComponents.size()
+                            << " trivial components.");
+    std::atomic<uint64_t> numberOfProcessedComponents(0);
+    storm::utility::parallel::executeTasks(numberOfThreads, nontrivialComponents.size() + numberOfBatches, [&](uint64_t task, uint64_t thread) {
+        uint64_t processed;
+        if (task < nontrivialComponents.size()) {
+            uint64_t const component = nontrivialComponents[task];
+            componentLraValues[component] =
+                computeLraForComponent(env, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[component]);
+            processed = ++numberOfProcessedComponents;
+        } else {
+            uint64_t const batchStart = (task - nontrivialComponents.size()) * batchSize;
+            uint64_t const batchEnd = std::min<uint64_t>(batchStart + batchSize, trivialComponents.size());
+            for (uint64_t index = batchStart; index < batchEnd; ++index) {
+                uint64_t const component = trivialComponents[index];
+                componentLraValues[component] =
+                    computeLraForComponent(env, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[component]);
+            }
+            processed = numberOfProcessedComponents += batchEnd - batchStart;
+        }
+        // The progress measurement is not thread-safe, so only one thread reports the progress.
+        if (thread == 0) {
+            progress.updateProgress(processed);
+        }
+    });
+    return componentLraValues;
+}
+
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isConcurrentComponentComputationSupported(Environment const&) const {
+    return true;
 }
 
 template<typename ValueType, bool Nondeterministic>
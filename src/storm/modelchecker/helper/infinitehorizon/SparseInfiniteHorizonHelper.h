@@ -123,6 +123,19 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     virtual void createDecomposition() = 0;
 
+    /*!
+     * @return true iff computeLraForComponent can be invoked concurrently for different components when using the given environment.
+     */
+    virtual bool isConcurrentComponentComputationSupported(Environment const& env) const;
+
+    /*!
+     * Computes the LRA value of each component of the decomposition by invoking computeLraForComponent.
+     * If multiple threads are available, the components are processed concurrently: Nontrivial components are handled first (largest first) and
+     * the remaining single-state components are handled in batches.
+     * @return the LRA value for each component (in the order of the decomposition)
+     */
+    std::vector<ValueType> computeComponentLraValues(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter);
+
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
      * optimal values w.r.t. the individual components.
@@ -139,7 +152,7 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
     storm::storage::SparseMatrix<ValueType> const* _backwardTransitions;
     storm::storage::Decomposition<LongRunComponentType> const* _longRunComponentDecomposition;
     std::unique_ptr<storm::storage::SparseMatrix<ValueType>> _computedBackwardTransitions;
-    std::unique_ptr<storm::storage::Decomposition<LongRunComponentType>> _computedLongRunComponentDecomposition;
+    std::shared_ptr<storm::storage::Decomposition<LongRunComponentType> const> _computedLongRunComponentDecomposition;
 
     boost::optional<std::vector<uint64_t>> _producedOptimalChoices;
 };
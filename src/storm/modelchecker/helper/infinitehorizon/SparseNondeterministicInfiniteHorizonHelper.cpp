@@ -7,6 +7,7 @@
 #include "storm/storage/Scheduler.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/AnalysisCache.h"
 
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
@@ -24,6 +25,24 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+/*!
+ * Retrieves the method that is used for nontrivial MECs. Unless a method is set explicitly, exact (sound) computations use linear programming (value
+ * iteration).
+ */
+template<typename ValueType>
+storm::solver::LraMethod getNontrivialMecLraMethod(Environment const& env) {
+    storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
+    if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
+        method != storm::solver::LraMethod::LinearProgramming) {
+        method = storm::solver::LraMethod::LinearProgramming;
+    } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
+        method = storm::solver::LraMethod::ValueIteration;
+    }
+    return method;
+}
+}  // namespace
+
 template<typename ValueType>
 SparseNondeterministicInfiniteHorizonHelper<ValueType>::SparseNondeterministicInfiniteHorizonHelper(
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix)
@@ -67,10 +86,13 @@ storm::storage::Scheduler<ValueType> SparseNondeterministicInfiniteHorizonHelper
 template<typename ValueType>
 void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition() {
     if (this->_longRunComponentDecomposition == nullptr) {
-        // The decomposition has not been provided or computed, yet.
+        // The decomposition has not been provided or computed, yet. It only depends on the transition matrix, so it is shared between properties.
         this->createBackwardTransitions();
         this->_computedLongRunComponentDecomposition =
-            std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(this->_transitionMatrix, *this->_backwardTransitions);
+            storm::storage::sparse::AnalysisCache::instance().getOrComputeDecomposition<storm::storage::MaximalEndComponentDecomposition<ValueType>>(
+                storm::storage::sparse::AnalysisCache::Key(&this->_transitionMatrix, "maximal end components"), [this]() {
+                    return storm::storage::MaximalEndComponentDecomposition<ValueType>(this->_transitionMatrix, *this->_backwardTransitions);
+                });
         this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
     }
 }
@@ -81,8 +103,9 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
                                                                                          storm::storage::MaximalEndComponent const& component) {
     // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
 
-    // Allocate memory for the nondeterministic choices.
-    if (this->isProduceSchedulerSet()) {
+    // Allocate memory for the nondeterministic choices. Usually, this has already been done so that components can be handled concurrently.
+    if (this->isProduceSchedulerSet() &&
+        (!this->_producedOptimalChoices.is_initialized() || this->_producedOptimalChoices->size() != this->_transitionMatrix.getRowGroupCount())) {
         if (!this->_producedOptimalChoices.is_initialized()) {
             this->_producedOptimalChoices.emplace();
         }
@@ -95,18 +118,17 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
-    storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
-    if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
-        method != storm::solver::LraMethod::LinearProgramming) {
-        STORM_LOG_INFO(
-            "Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please explicitly "
-            "specify a different LRA method.");
-        method = storm::solver::LraMethod::LinearProgramming;
-    } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
-        STORM_LOG_INFO(
-            "Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please explicitly "
-            "specify a different LRA method.");
-        method = storm::solver::LraMethod::ValueIteration;
+    storm::solver::LraMethod method = getNontrivialMecLraMethod<ValueType>(env);
+    if (method != env.solver().lra().getNondetLraMethod()) {
+        if (method == storm::solver::LraMethod::LinearProgramming) {
+            STORM_LOG_INFO(
+                "Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please "
+                "explicitly specify a different LRA method.");
+        } else {
+            STORM_LOG_INFO(
+                "Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please "
+                "explicitly specify a different LRA method.");
+        }
     }
     STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
                          "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
@@ -119,6 +141,12 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 }
 
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isConcurrentComponentComputationSupported(Environment const& env) const {
+    // The LP solvers are not guaranteed to be thread-safe.
+    return getNontrivialMecLraMethod<ValueType>(env) != storm::solver::LraMethod::LinearProgramming;
+}
+
 template<typename ValueType>
 std::pair<bool, ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForTrivialMec(
     Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter,
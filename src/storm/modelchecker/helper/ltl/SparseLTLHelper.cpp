@@ -1,5 +1,7 @@
 #include "SparseLTLHelper.h"
 
+#include <optional>
+
 #include "storm/automata/DeterministicAutomaton.h"
 #include "storm/automata/LTL2DeterministicAutomaton.h"
 
@@ -14,6 +16,8 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/Metrics.h"
+#include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 
@@ -219,15 +223,36 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
         statesOfInterest = storm::storage::BitVector(this->_transitionMatrix.getRowGroupCount(), true);
     }
 
+    if (!this->isProduceSchedulerSet()) {
+        // If the acceptance condition is trivial, the result does not depend on the product.
+        // Note that (as in computeAcceptingECs) we assume that the model does not have deadlocks.
+        auto const& acceptanceExpression = da.getAcceptance()->getAcceptanceExpression();
+        if (acceptanceExpression->isTRUE() || acceptanceExpression->isFALSE()) {
+            STORM_LOG_INFO("Acceptance condition is " << *acceptanceExpression << ", skipping product construction.");
+            std::vector<ValueType> numericResult(this->_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+            if (acceptanceExpression->isTRUE()) {
+                storm::utility::vector::setVectorValues(numericResult, statesOfInterest, storm::utility::one<ValueType>());
+            }
+            return numericResult;
+        }
+    }
+
     STORM_LOG_INFO("Building " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " product with deterministic automaton, starting from "
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
+    // The phases of the product analysis are recorded one after another
+    std::optional<storm::utility::metrics::ScopedTimer> phase;
+    phase.emplace("LTL product construction");
     transformer::DAProductBuilder productBuilder(da, statesForAP);
+    // Once the automaton is in a sink, the acceptance of a run is fixed. Hence, we do not need to explore the product any further.
+    // The scheduler construction, however, requires the full product.
+    productBuilder.setTruncateAtAutomatonSinks(!this->isProduceSchedulerSet());
 
     auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest);
 
     STORM_LOG_INFO("Product " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " has "
                    << product->getProductModel().getNumberOfStates() << " states and " << product->getProductModel().getNumberOfTransitions()
                    << " transitions.");
+    storm::utility::metrics::addToCounter("LTL product states", product->getProductModel().getNumberOfStates());
 
     // Prepare scheduler
     if (this->isProduceSchedulerSet()) {
@@ -236,6 +261,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     }
 
     // Compute accepting states
+    phase.emplace("LTL accepting components");
     storm::storage::BitVector acceptingStates;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
@@ -257,6 +283,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     }
 
     STORM_LOG_INFO("Computing probabilities for reaching accepting components...");
+    phase.emplace("LTL product probabilities");
 
     storm::storage::BitVector bvTrue(product->getProductModel().getNumberOfStates(), true);
     storm::storage::BitVector soiProduct(product->getStatesOfInterest());
@@ -317,14 +344,18 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
 
     // Convert LTL formula to a deterministic automaton
     std::shared_ptr<storm::automata::DeterministicAutomaton> da;
-    if (env.modelchecker().isLtl2daToolSet()) {
-        // Use the external tool given via ltl2da
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
-    } else {
-        // Use the internal tool (Spot)
-        // For nondeterministic models the acceptance condition is transformed into DNF
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
+    {
+        storm::utility::metrics::ScopedTimer automatonPhase("LTL automaton construction");
+        if (env.modelchecker().isLtl2daToolSet()) {
+            // Use the external tool given via ltl2da
+            da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
+        } else {
+            // Use the internal tool (Spot)
+            // For nondeterministic models the acceptance condition is transformed into DNF
+            da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
+        }
     }
+    storm::utility::metrics::updateCounterMaximum("LTL automaton states", da->getNumberOfStates());
 
     STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, " << da->getAPSet().size()
                                                                   << " atomic propositions and " << *da->getAcceptance()->getAcceptanceExpression()
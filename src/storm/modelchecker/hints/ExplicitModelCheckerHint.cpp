@@ -43,6 +43,21 @@ void ExplicitModelCheckerHint<ValueType>::setResultHint(boost::optional<std::vec
     this->resultHint = resultHint;
 }
 
+template<typename ValueType>
+bool ExplicitModelCheckerHint<ValueType>::hasResultHintStepBound() const {
+    return resultHintStepBound.is_initialized();
+}
+
+template<typename ValueType>
+uint64_t ExplicitModelCheckerHint<ValueType>::getResultHintStepBound() const {
+    return *resultHintStepBound;
+}
+
+template<typename ValueType>
+void ExplicitModelCheckerHint<ValueType>::setResultHintStepBound(boost::optional<uint64_t> const& stepBound) {
+    this->resultHintStepBound = stepBound;
+}
+
 template<typename ValueType>
 bool ExplicitModelCheckerHint<ValueType>::getComputeOnlyMaybeStates() const {
     STORM_LOG_THROW(!computeOnlyMaybeStates || (hasMaybeStates() && hasResultHint()), storm::exceptions::InvalidOperationException,
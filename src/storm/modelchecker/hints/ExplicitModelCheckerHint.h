@@ -33,6 +33,12 @@ class ExplicitModelCheckerHint : public ModelCheckerHint {
     void setResultHint(boost::optional<std::vector<ValueType>> const& resultHint);
     void setResultHint(boost::optional<std::vector<ValueType>>&& resultHint);
 
+    // If set, the result hint is the solution of the same step-bounded property with the given (smaller or equal) step bound.
+    // Step-bounded computations can then continue from the result hint instead of starting from scratch.
+    bool hasResultHintStepBound() const;
+    uint64_t getResultHintStepBound() const;
+    void setResultHintStepBound(boost::optional<uint64_t> const& stepBound);
+
     // Set whether only the maybestates need to be computed, i.e., skips the qualitative check.
     // The result for non-maybe states is taken from the result hint.
     // Hence, this option may only be enabled iff a resultHint and a set of maybestates are given.
@@ -57,6 +63,7 @@ class ExplicitModelCheckerHint : public ModelCheckerHint {
 
    private:
     boost::optional<std::vector<ValueType>> resultHint;
+    boost::optional<uint64_t> resultHintStepBound;
     boost::optional<storm::storage::Scheduler<ValueType>> schedulerHint;
 
     bool computeOnlyMaybeStates;
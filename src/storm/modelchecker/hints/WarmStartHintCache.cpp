@@ -0,0 +1,143 @@
+#include "storm/modelchecker/hints/WarmStartHintCache.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ValueType>
+bool WarmStartHintCache<ValueType>::isSupported(storm::logic::Formula const& formula) {
+    return getKey(formula).is_initialized();
+}
+
+template<typename ValueType>
+bool WarmStartHintCache<ValueType>::isStepBounded(storm::logic::Formula const& formula) {
+    auto key = getKey(formula);
+    return key && key->second;
+}
+
+template<typename ValueType>
+std::shared_ptr<ExplicitModelCheckerHint<ValueType>> WarmStartHintCache<ValueType>::getHint(storm::logic::Formula const& formula, bool useValueHints) const {
+    auto key = getKey(formula);
+    if (!key) {
+        return nullptr;
+    }
+    auto storedResultIt = storedResults.find(key->first);
+    if (storedResultIt == storedResults.end()) {
+        return nullptr;
+    }
+    StoredResult const& storedResult = storedResultIt->second;
+
+    auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+    if (key->second) {
+        // The previous result can only be continued if it was obtained for a smaller step bound.
+        if (!storedResult.values || *storedResult.stepBound > *key->second) {
+            return nullptr;
+        }
+        hint->setResultHint(storedResult.values);
+        hint->setResultHintStepBound(storedResult.stepBound);
+    } else {
+        if (useValueHints && storedResult.values) {
+            hint->setResultHint(storedResult.values);
+        }
+        hint->setSchedulerHint(storedResult.scheduler);
+    }
+    return hint->isEmpty() ? nullptr : hint;
+}
+
+template<typename ValueType>
+void WarmStartHintCache<ValueType>::storeResult(storm::logic::Formula const& formula, CheckResult const& result) {
+    auto key = getKey(formula);
+    if (!key || !result.isExplicitQuantitativeCheckResult() || !result.isResultForAllStates()) {
+        return;
+    }
+    auto const& quantitativeResult = result.asExplicitQuantitativeCheckResult<ValueType>();
+
+    StoredResult storedResult;
+    storedResult.stepBound = key->second;
+    auto const& values = quantitativeResult.getValueVector();
+    // Infinite values (e.g. of reachability rewards) are not suited as a starting point.
+    if (std::none_of(values.begin(), values.end(), [](ValueType const& value) { return storm::utility::isInfinity(value); })) {
+        storedResult.values = values;
+    }
+    if (quantitativeResult.hasScheduler()) {
+        auto const& scheduler = quantitativeResult.getScheduler();
+        if (scheduler.isMemorylessScheduler() && scheduler.isDeterministicScheduler() && !scheduler.isPartialScheduler()) {
+            storedResult.scheduler = scheduler;
+        }
+    }
+    storedResults[key->first] = std::move(storedResult);
+}
+
+template<typename ValueType>
+void WarmStartHintCache<ValueType>::announceFormula(storm::logic::Formula const& formula) {
+    if (auto key = getKey(formula)) {
+        ++announcedFormulas[key->first];
+    }
+}
+
+template<typename ValueType>
+void WarmStartHintCache<ValueType>::withdrawFormula(storm::logic::Formula const& formula) {
+    if (auto key = getKey(formula)) {
+        auto announcedIt = announcedFormulas.find(key->first);
+        if (announcedIt != announcedFormulas.end() && --announcedIt->second == 0) {
+            announcedFormulas.erase(announcedIt);
+        }
+    }
+}
+
+template<typename ValueType>
+bool WarmStartHintCache<ValueType>::isRelatedToAnnouncedFormula(storm::logic::Formula const& formula) const {
+    auto key = getKey(formula);
+    return key && announcedFormulas.count(key->first) > 0;
+}
+
+template<typename ValueType>
+boost::optional<std::pair<std::string, boost::optional<uint64_t>>> WarmStartHintCache<ValueType>::getKey(storm::logic::Formula const& formula) {
+    if (!(formula.isProbabilityOperatorFormula() || formula.isRewardOperatorFormula()) || !formula.asOperatorFormula().hasQuantitativeResult()) {
+        return boost::none;
+    }
+    auto const& operatorFormula = formula.asOperatorFormula();
+    auto const& subformula = operatorFormula.getSubformula();
+
+    std::stringstream key;
+    if (operatorFormula.hasOptimalityType()) {
+        key << operatorFormula.getOptimalityType() << " ";
+    }
+    boost::optional<uint64_t> stepBound;
+    if (formula.isProbabilityOperatorFormula()) {
+        if (subformula.isBoundedUntilFormula()) {
+            auto const& boundedUntilFormula = subformula.asBoundedUntilFormula();
+            if (boundedUntilFormula.isMultiDimensional() || boundedUntilFormula.hasLowerBound() || !boundedUntilFormula.hasUpperBound() ||
+                !boundedUntilFormula.getTimeBoundReference().isStepBound() || !boundedUntilFormula.hasIntegerUpperBound()) {
+                return boost::none;
+            }
+            // The subformulas have to coincide, only the step bound may differ.
+            key << "P " << boundedUntilFormula.getLeftSubformula() << " U<=? " << boundedUntilFormula.getRightSubformula();
+            stepBound = boundedUntilFormula.getNonStrictUpperBound<uint64_t>();
+        } else if (subformula.isUntilFormula() || subformula.isReachabilityProbabilityFormula()) {
+            key << "P " << subformula;
+        } else {
+            return boost::none;
+        }
+    } else {
+        auto const& rewardOperatorFormula = formula.asRewardOperatorFormula();
+        if (!subformula.isReachabilityRewardFormula() || rewardOperatorFormula.getMeasureType() != storm::logic::RewardMeasureType::Expectation) {
+            return boost::none;
+        }
+        key << "R " << (rewardOperatorFormula.hasRewardModelName() ? rewardOperatorFormula.getRewardModelName() : "") << " " << subformula;
+    }
+    return std::make_pair(key.str(), stepBound);
+}
+
+template class WarmStartHintCache<double>;
+template class WarmStartHintCache<storm::RationalNumber>;
+
+}  // namespace modelchecker
+}  // namespace storm
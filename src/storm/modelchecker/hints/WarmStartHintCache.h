@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+
+namespace storm {
+namespace logic {
+class Formula;
+}
+
+namespace modelchecker {
+class CheckResult;
+
+/*!
+ * Stores the results of checked formulas on a fixed sparse model such that they can be used as hints for subsequently checked related formulas.
+ *
+ * Two formulas are related if they
+ *  - are quantitative reachability probability (or reachability reward) formulas with the same optimization direction, subformulas (and reward model), or
+ *  - are quantitative step-bounded until formulas with the same optimization direction and subformulas that only differ in the step bound.
+ * In the former case, the value vector and the scheduler of the previous result serve as a starting point for the solver. In the latter case,
+ * the computation continues from the previous result if its step bound is smaller.
+ */
+template<typename ValueType>
+class WarmStartHintCache {
+   public:
+    /*!
+     * Retrieves whether results of the given formula can be stored and whether hints can be provided for it.
+     */
+    static bool isSupported(storm::logic::Formula const& formula);
+
+    /*!
+     * Retrieves whether the given formula is a supported step-bounded formula, i.e., whether a hint only consists of a result for a smaller step bound.
+     */
+    static bool isStepBounded(storm::logic::Formula const& formula);
+
+    /*!
+     * Retrieves a hint for the given formula that is derived from the last result of a related formula.
+     *
+     * @param formula The formula to check.
+     * @param useValueHints If false, the values of unbounded reachability results are not used as a starting point (e.g. because this would
+     * compromise the soundness of the solver). The results of step-bounded formulas are always used as they are exact.
+     * @return The hint or nullptr if no applicable hint is available.
+     */
+    std::shared_ptr<ExplicitModelCheckerHint<ValueType>> getHint(storm::logic::Formula const& formula, bool useValueHints) const;
+
+    /*!
+     * Stores the result of the given formula such that it can serve as a hint for related formulas.
+     * Results that are not given for all states or not quantitative are ignored.
+     */
+    void storeResult(storm::logic::Formula const& formula, CheckResult const& result);
+
+    /*!
+     * Announces that the given formula is going to be checked later on.
+     */
+    void announceFormula(storm::logic::Formula const& formula);
+
+    /*!
+     * Withdraws a previous announcement of the given formula, e.g., because it is about to be checked.
+     */
+    void withdrawFormula(storm::logic::Formula const& formula);
+
+    /*!
+     * Retrieves whether the given formula is related to an announced formula, i.e., whether its result can serve as a hint later on.
+     */
+    bool isRelatedToAnnouncedFormula(storm::logic::Formula const& formula) const;
+
+   private:
+    struct StoredResult {
+        boost::optional<uint64_t> stepBound;
+        boost::optional<std::vector<ValueType>> values;
+        boost::optional<storm::storage::Scheduler<ValueType>> scheduler;
+    };
+
+    /*!
+     * Computes the key under which results for the given formula are stored (if it is supported) as well as its step bound (if any).
+     */
+    static boost::optional<std::pair<std::string, boost::optional<uint64_t>>> getKey(storm::logic::Formula const& formula);
+
+    std::unordered_map<std::string, StoredResult> storedResults;
+    // The number of announced formulas for each key.
+    std::unordered_map<std::string, uint64_t> announcedFormulas;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -785,8 +785,9 @@ typename DeterministicSchedsLpChecker<ModelType, GeometryValueType>::Point Deter
     }
 
     Point inducedPoint;
+    auto const inducedValues = DeterministicSchedsObjectiveHelper<ModelType>::evaluateScheduler(env, objectiveHelper, selectedChoices);
     for (uint64_t objIndex = 0; objIndex < objectiveHelper.size(); ++objIndex) {
-        ValueType inducedValue = objectiveHelper[objIndex].evaluateScheduler(env, selectedChoices);
+        ValueType const& inducedValue = inducedValues[objIndex];
         inducedPoint.push_back(storm::utility::convertNumber<GeometryValueType>(inducedValue));
         // If this objective has weight zero, the lp solution is not necessarily correct
         if (!storm::utility::isZero(currentWeightVector[objIndex])) {
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/deterministicScheds/DeterministicSchedsObjectiveHelper.h"
 
+#include <algorithm>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/multiobjective/deterministicScheds/VisitingTimesHelper.h"
@@ -12,12 +14,15 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/transformer/EndComponentEliminator.h"
 #include "storm/utility/Extremum.h"
 #include "storm/utility/FilteredRewardModel.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 
@@ -623,18 +628,12 @@ void DeterministicSchedsObjectiveHelper<ModelType>::computeLowerUpperBounds(Envi
 }
 
 template<typename ModelType>
-typename DeterministicSchedsObjectiveHelper<ModelType>::ValueType DeterministicSchedsObjectiveHelper<ModelType>::evaluateScheduler(
-    Environment const& env, storm::storage::BitVector const& selectedChoices) const {
-    STORM_LOG_ASSERT(model.getInitialStates().getNumberOfSetBits() == 1u, "Expected a single initial state.");
-    STORM_LOG_ASSERT(model.getInitialStates().isSubsetOf(getMaybeStates()), "Expected initial state to be maybestate.");
-    STORM_LOG_ASSERT(selectedChoices.getNumberOfSetBits() == model.getNumberOfStates(), "invalid choice selection.");
-    storm::storage::BitVector allStates(model.getNumberOfStates(), true);
-    auto selectedMatrix = model.getTransitionMatrix().getSubmatrix(false, selectedChoices, allStates);
-    assert(selectedMatrix.getRowCount() == selectedMatrix.getRowGroupCount());
-    selectedMatrix.makeRowGroupingTrivial();
+storm::storage::BitVector DeterministicSchedsObjectiveHelper<ModelType>::computeSchedulerMaybeStates(
+    storm::storage::BitVector const& selectedChoices, storm::storage::SparseMatrix<ValueType> const& selectedMatrix,
+    storm::storage::SparseMatrix<ValueType> const& selectedBackwardTransitions) const {
     auto subMaybeStates =
         getMaybeStates() & storm::utility::graph::getReachableStates(selectedMatrix, model.getInitialStates(), getMaybeStates(), ~getMaybeStates());
-    auto bsccCandidates = storm::utility::graph::performProbGreater0(selectedMatrix.transpose(true), subMaybeStates, ~subMaybeStates);
+    auto bsccCandidates = storm::utility::graph::performProbGreater0(selectedBackwardTransitions, subMaybeStates, ~subMaybeStates);
     bsccCandidates.complement();  // i.e. states that can not reach non-maybe states
     if (!bsccCandidates.empty()) {
         storm::storage::StronglyConnectedComponentDecompositionOptions bsccOptions;
@@ -646,6 +645,38 @@ typename DeterministicSchedsObjectiveHelper<ModelType>::ValueType DeterministicS
             }
         }
     }
+    STORM_LOG_ASSERT(std::all_of(bsccCandidates.begin(), bsccCandidates.end(),
+                                 [&](uint64_t state) {
+                                     return subMaybeStates.get(state) || storm::utility::isZero(getSelectedChoiceReward(selectedChoices, state));
+                                 }),
+                     "Strategy selected a bscc with rewards");
+    return subMaybeStates;
+}
+
+template<typename ModelType>
+typename DeterministicSchedsObjectiveHelper<ModelType>::ValueType DeterministicSchedsObjectiveHelper<ModelType>::getSelectedChoiceReward(
+    storm::storage::BitVector const& selectedChoices, uint64_t state) const {
+    auto choice = selectedChoices.getNextSetIndex(model.getTransitionMatrix().getRowGroupIndices()[state]);
+    STORM_LOG_ASSERT(choice < model.getTransitionMatrix().getRowGroupIndices()[state + 1], " no choice selected at state" << state);
+    auto const& allRewards = getChoiceRewards();
+    if (auto findRes = allRewards.find(choice); findRes != allRewards.end()) {
+        return findRes->second;
+    } else {
+        return storm::utility::zero<ValueType>();
+    }
+}
+
+template<typename ModelType>
+typename DeterministicSchedsObjectiveHelper<ModelType>::ValueType DeterministicSchedsObjectiveHelper<ModelType>::evaluateScheduler(
+    Environment const& env, storm::storage::BitVector const& selectedChoices) const {
+    STORM_LOG_ASSERT(model.getInitialStates().getNumberOfSetBits() == 1u, "Expected a single initial state.");
+    STORM_LOG_ASSERT(model.getInitialStates().isSubsetOf(getMaybeStates()), "Expected initial state to be maybestate.");
+    STORM_LOG_ASSERT(selectedChoices.getNumberOfSetBits() == model.getNumberOfStates(), "invalid choice selection.");
+    storm::storage::BitVector allStates(model.getNumberOfStates(), true);
+    auto selectedMatrix = model.getTransitionMatrix().getSubmatrix(false, selectedChoices, allStates);
+    assert(selectedMatrix.getRowCount() == selectedMatrix.getRowGroupCount());
+    selectedMatrix.makeRowGroupingTrivial();
+    auto subMaybeStates = computeSchedulerMaybeStates(selectedChoices, selectedMatrix, selectedMatrix.transpose(true));
 
     if (subMaybeStates.get(*model.getInitialStates().begin())) {
         storm::solver::GeneralLinearEquationSolverFactory<ValueType> factory;
@@ -655,19 +686,8 @@ typename DeterministicSchedsObjectiveHelper<ModelType>::ValueType DeterministicS
         auto exitProbs = selectedMatrix.getConstrainedRowSumVector(subMaybeStates, ~subMaybeStates);
         std::vector<ValueType> rewards;
         rewards.reserve(exitProbs.size());
-        auto const& allRewards = getChoiceRewards();
-        for (auto const& state : getMaybeStates()) {
-            auto choice = selectedChoices.getNextSetIndex(model.getTransitionMatrix().getRowGroupIndices()[state]);
-            STORM_LOG_ASSERT(choice < model.getTransitionMatrix().getRowGroupIndices()[state + 1], " no choice selected at state" << state);
-            if (subMaybeStates.get(state)) {
-                if (auto findRes = allRewards.find(choice); findRes != allRewards.end()) {
-                    rewards.push_back(findRes->second);
-                } else {
-                    rewards.push_back(storm::utility::zero<ValueType>());
-                }
-            } else {
-                STORM_LOG_ASSERT(!bsccCandidates.get(state) || allRewards.count(choice) == 0, "Strategy selected a bscc with rewards");
-            }
+        for (auto const& state : subMaybeStates) {
+            rewards.push_back(getSelectedChoiceReward(selectedChoices, state));
         }
         if (useEqSysFormat) {
             eqSysMatrix.convertToEquationSystem();
@@ -695,6 +715,78 @@ typename DeterministicSchedsObjectiveHelper<ModelType>::ValueType DeterministicS
     }
 }
 
+template<typename ModelType>
+std::vector<typename DeterministicSchedsObjectiveHelper<ModelType>::ValueType> DeterministicSchedsObjectiveHelper<ModelType>::evaluateScheduler(
+    Environment const& env, std::vector<DeterministicSchedsObjectiveHelper<ModelType>> const& objectiveHelpers,
+    storm::storage::BitVector const& selectedChoices) {
+    std::vector<ValueType> result;
+    result.reserve(objectiveHelpers.size());
+    if (storm::NumberTraits<ValueType>::IsExact || objectiveHelpers.size() < 2 || !storm::solver::helper::isInterleavedValueIterationApplicable(env)) {
+        for (auto const& objectiveHelper : objectiveHelpers) {
+            result.push_back(objectiveHelper.evaluateScheduler(env, selectedChoices));
+        }
+        return result;
+    }
+
+    auto const& model = objectiveHelpers.front().model;
+    STORM_LOG_ASSERT(model.getInitialStates().getNumberOfSetBits() == 1u, "Expected a single initial state.");
+    STORM_LOG_ASSERT(selectedChoices.getNumberOfSetBits() == model.getNumberOfStates(), "invalid choice selection.");
+    storm::storage::BitVector allStates(model.getNumberOfStates(), true);
+    auto selectedMatrix = model.getTransitionMatrix().getSubmatrix(false, selectedChoices, allStates);
+    assert(selectedMatrix.getRowCount() == selectedMatrix.getRowGroupCount());
+    selectedMatrix.makeRowGroupingTrivial();
+    auto selectedBackwardTransitions = selectedMatrix.transpose(true);
+
+    // Collect the objectives for which the initial state is a (relevant) maybestate. The remaining objectives have value zero.
+    result.assign(objectiveHelpers.size(), storm::utility::zero<ValueType>());
+    std::vector<uint64_t> laneToObjective;
+    std::vector<storm::storage::BitVector> laneMaybeStates;
+    storm::storage::BitVector jointMaybeStates(model.getNumberOfStates(), false);
+    for (uint64_t objIndex = 0; objIndex < objectiveHelpers.size(); ++objIndex) {
+        auto const& objectiveHelper = objectiveHelpers[objIndex];
+        STORM_LOG_ASSERT(&objectiveHelper.model == &model, "Objective helpers consider different models.");
+        STORM_LOG_ASSERT(model.getInitialStates().isSubsetOf(objectiveHelper.getMaybeStates()), "Expected initial state to be maybestate.");
+        auto subMaybeStates = objectiveHelper.computeSchedulerMaybeStates(selectedChoices, selectedMatrix, selectedBackwardTransitions);
+        if (subMaybeStates.get(*model.getInitialStates().begin())) {
+            jointMaybeStates |= subMaybeStates;
+            laneToObjective.push_back(objIndex);
+            laneMaybeStates.push_back(std::move(subMaybeStates));
+        }
+    }
+    if (laneToObjective.empty()) {
+        return result;
+    }
+
+    // Set up the interleaved equation systems. Entries of states that are not a maybestate for the corresponding objective keep the value zero.
+    uint64_t const numLanes = laneToObjective.size();
+    uint64_t const numJointMaybeStates = jointMaybeStates.getNumberOfSetBits();
+    std::vector<ValueType> x(numJointMaybeStates * numLanes, storm::utility::zero<ValueType>());
+    std::vector<ValueType> rewards(numJointMaybeStates * numLanes, storm::utility::zero<ValueType>());
+    storm::storage::BitVector fixedEntries(numJointMaybeStates * numLanes, false);
+    for (uint64_t lane = 0; lane < numLanes; ++lane) {
+        auto const& objectiveHelper = objectiveHelpers[laneToObjective[lane]];
+        uint64_t entry = lane;
+        for (auto const& state : jointMaybeStates) {
+            if (laneMaybeStates[lane].get(state)) {
+                rewards[entry] = objectiveHelper.getSelectedChoiceReward(selectedChoices, state);
+            } else {
+                fixedEntries.set(entry, true);
+            }
+            entry += numLanes;
+        }
+    }
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<ValueType, true>>();
+    viOperator->setMatrixBackwards(selectedMatrix.getSubmatrix(true, jointMaybeStates, jointMaybeStates));
+    storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
+    viHelper.interleavedVI(env, x, rewards, numLanes, {}, &fixedEntries);
+
+    auto const initState = *(model.getInitialStates() % jointMaybeStates).begin();
+    for (uint64_t lane = 0; lane < numLanes; ++lane) {
+        result[laneToObjective[lane]] = x[initState * numLanes + lane];
+    }
+    return result;
+}
+
 template class DeterministicSchedsObjectiveHelper<storm::models::sparse::Mdp<double>>;
 template class DeterministicSchedsObjectiveHelper<storm::models::sparse::Mdp<storm::RationalNumber>>;
 template class DeterministicSchedsObjectiveHelper<storm::models::sparse::MarkovAutomaton<double>>;
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <optional>
+#include <vector>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/storage/BitVector.h"
@@ -11,6 +12,8 @@ namespace storm {
 namespace storage {
 template<typename ValueType>
 class MaximalEndComponentDecomposition;
+template<typename ValueType>
+class SparseMatrix;
 }
 
 class Environment;
@@ -91,9 +94,31 @@ class DeterministicSchedsObjectiveHelper {
      */
     ValueType evaluateScheduler(Environment const& env, storm::storage::BitVector const& selectedChoices) const;
 
+    /*!
+     * Computes the values at the initial state under the given scheduler for all given objectives (that need to consider the same model).
+     * If the equation systems are solved using value iteration anyway, all objectives are considered at once.
+     */
+    static std::vector<ValueType> evaluateScheduler(Environment const& env, std::vector<DeterministicSchedsObjectiveHelper<ModelType>> const& objectiveHelpers,
+                                                    storm::storage::BitVector const& selectedChoices);
+
    private:
     void initialize();
 
+    /*!
+     * Computes the maybestates that are relevant under the given scheduler, i.e., the maybestates that are reachable from the initial state and that do not
+     * lie on a bottom SCC.
+     * @param selectedMatrix The transition matrix induced by the selected choices
+     * @param selectedBackwardTransitions The transposed of the selected matrix
+     */
+    storm::storage::BitVector computeSchedulerMaybeStates(storm::storage::BitVector const& selectedChoices,
+                                                          storm::storage::SparseMatrix<ValueType> const& selectedMatrix,
+                                                          storm::storage::SparseMatrix<ValueType> const& selectedBackwardTransitions) const;
+
+    /*!
+     * Returns the reward of the choice that is selected at the given state.
+     */
+    ValueType getSelectedChoiceReward(storm::storage::BitVector const& selectedChoices, uint64_t state) const;
+
     storm::storage::BitVector maybeStates;         // S_?^j
     storm::storage::BitVector rewMinusInfEStates;  // S_{-infty}^j
     std::optional<ValueType> constantInitialStateValue;
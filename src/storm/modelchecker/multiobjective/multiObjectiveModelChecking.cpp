@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 
+#include <optional>
+
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/constraintbased/SparseCbAchievabilityQuery.h"
 #include "storm/modelchecker/multiobjective/deterministicScheds/DeterministicSchedsAchievabilityChecker.h"
@@ -13,6 +15,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/Metrics.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
 
@@ -38,6 +41,8 @@ std::unique_ptr<CheckResult> performMultiObjectiveModelChecking(Environment cons
     }
 
     // Preprocess the model
+    std::optional<storm::utility::metrics::ScopedTimer> phase;
+    phase.emplace("multi-objective preprocessing");
     auto preprocessorResult = preprocessing::SparseMultiObjectivePreprocessor<SparseModelType>::preprocess(env, model, formula);
     swPreprocessing.stop();
     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
@@ -49,6 +54,7 @@ std::unique_ptr<CheckResult> performMultiObjectiveModelChecking(Environment cons
     }
 
     // Invoke the analysis
+    phase.emplace("multi-objective analysis");
     storm::utility::Stopwatch swAnalysis(true);
     std::unique_ptr<CheckResult> result;
     MultiObjectiveMethod method = env.modelchecker().multi().getMethod();
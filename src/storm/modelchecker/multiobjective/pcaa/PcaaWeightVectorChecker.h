@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
@@ -69,6 +70,13 @@ class PcaaWeightVectorChecker {
      */
     virtual storm::storage::Scheduler<ValueType> computeScheduler() const;
 
+    /*!
+     * Creates an independent copy of this checker that can be invoked concurrently to this checker.
+     * The copy might reuse the results of the most recent call of check(..) to speed up subsequent checks.
+     * @return the copy or nullptr if this checker can not be copied.
+     */
+    virtual std::unique_ptr<PcaaWeightVectorChecker<ModelType>> clone() const;
+
    protected:
     /*!
      * Computes the weighted lower or upper bounds for the provided set of objectives.
@@ -1,6 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/RewardBoundedMdpPcaaWeightVectorChecker.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -20,9 +21,13 @@
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -88,8 +93,7 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        computeEpochSolution(newEnv, epoch, weightVector, cachedData);
+    auto addCdfEntry = [&](typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -104,10 +108,32 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
             cdfEntry.insert(cdfEntry.end(), solutionIt, solution.end());
             cdfData.push_back(std::move(cdfEntry));
         }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    };
+    uint64_t numberOfThreads = helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::getNumberOfEpochAnalysisThreads(
+        env.modelchecker().getNumberOfThreads());
+    if (numberOfThreads > 1) {
+        // The cached solvers and vectors are tied to the epoch model they were created for, so every thread needs its own checking data.
+        std::vector<EpochCheckingData> threadCachedData(numberOfThreads);
+        swEpochModelAnalysis.start();
+        rewardUnfolding.analyzeEpochsInParallel(
+            epochOrder, numberOfThreads,
+            [&](auto& epochModel, auto const&, uint64_t thread) { return analyzeEpochModel(newEnv, epochModel, weightVector, threadCachedData[thread]); },
+            [&](auto const& epoch) {
+                addCdfEntry(epoch);
+                ++this->numCheckedEpochs;
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+            });
+        swEpochModelAnalysis.stop();
+    } else {
+        for (auto const& epoch : epochOrder) {
+            computeEpochSolution(newEnv, epoch, weightVector, cachedData);
+            addCdfEntry(epoch);
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
         }
     }
 
@@ -140,6 +166,16 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
     auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
     swEpochModelBuild.stop();
     swEpochModelAnalysis.start();
+    rewardUnfolding.setSolutionForCurrentEpoch(analyzeEpochModel(env, epochModel, weightVector, cachedData));
+    swEpochModelAnalysis.stop();
+}
+
+template<class SparseMdpModelType>
+std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<typename SparseMdpModelType::ValueType, false>::SolutionType>
+RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::analyzeEpochModel(Environment const& env,
+                                                                               helper::rewardbounded::EpochModel<ValueType, false>& epochModel,
+                                                                               std::vector<ValueType> const& weightVector,
+                                                                               EpochCheckingData& cachedData) const {
     std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> result;
     result.reserve(epochModel.epochInStates.getNumberOfSetBits());
     uint64_t solutionSize = this->objectives.size() + 1;
@@ -253,13 +289,21 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             cachedData.minMaxSolver->setInitialScheduler(std::move(choicesTmp));
             cachedData.schedulerChoices = choices;
             storm::solver::GeneralLinearEquationSolverFactory<ValueType> linEqSolverFactory;
-            bool needEquationSystem = linEqSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+            bool const interleaved = useInterleavedValueIteration(env);
+            bool needEquationSystem =
+                !interleaved && linEqSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> subMatrix = epochModel.epochMatrix.selectRowsFromRowGroups(choices, needEquationSystem);
             if (needEquationSystem) {
                 subMatrix.convertToEquationSystem();
             }
-            cachedData.linEqSolver = linEqSolverFactory.create(env, std::move(subMatrix));
-            cachedData.linEqSolver->setCachingEnabled(true);
+            if (interleaved) {
+                // The equation systems of all objectives are solved at once by applying the (fixpoint) matrix to interleaved operands
+                cachedData.linEqViOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<ValueType, true>>();
+                cachedData.linEqViOperator->setMatrixBackwards(subMatrix);
+            } else {
+                cachedData.linEqSolver = linEqSolverFactory.create(env, std::move(subMatrix));
+                cachedData.linEqSolver->setCachingEnabled(true);
+            }
         }
 
         // Formulate for each objective the linear equation system induced by the performed choices
@@ -299,6 +343,10 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
                 ++choiceIt;
             }
             assert(x.size() == choices.size());
+            if (cachedData.linEqViOperator) {
+                storm::utility::vector::setVectorValuesInterleaved(cachedData.bLinEqInterleaved, cachedData.bLinEq, objIndex, this->objectives.size());
+                continue;
+            }
             auto req = cachedData.linEqSolver->getRequirements(env);
             cachedData.linEqSolver->clearBounds();
             if (obj.lowerResultBound) {
@@ -318,15 +366,44 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
                 ++resultIt;
             }
         }
+        if (cachedData.linEqViOperator) {
+            solveInterleaved(env, epochModel, cachedData, result);
+        }
     }
-    rewardUnfolding.setSolutionForCurrentEpoch(std::move(result));
-    swEpochModelAnalysis.stop();
+    return result;
+}
+
+template<class SparseMdpModelType>
+void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::solveInterleaved(
+    Environment const& env, helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, EpochCheckingData& cachedData,
+    std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType>& result) const {
+    uint64_t const numObjectives = this->objectives.size();
+    for (uint64_t objIndex = 0; objIndex < numObjectives; ++objIndex) {
+        storm::utility::vector::setVectorValuesInterleaved(cachedData.xLinEqInterleaved, cachedData.xLinEq[objIndex], objIndex, numObjectives);
+    }
+    storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(cachedData.linEqViOperator);
+    viHelper.interleavedVI(env, cachedData.xLinEqInterleaved, cachedData.bLinEqInterleaved, numObjectives);
+    for (uint64_t objIndex = 0; objIndex < numObjectives; ++objIndex) {
+        auto& x = cachedData.xLinEq[objIndex];
+        storm::utility::vector::getVectorValuesInterleaved(x, cachedData.xLinEqInterleaved, objIndex, numObjectives);
+        auto resultIt = result.begin();
+        for (auto state : epochModel.epochInStates) {
+            resultIt->push_back(x[state]);
+            ++resultIt;
+        }
+    }
+}
+
+template<class SparseMdpModelType>
+bool RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::useInterleavedValueIteration(Environment const& env) const {
+    return !storm::NumberTraits<ValueType>::IsExact && this->objectives.size() > 1 && storm::solver::helper::isInterleavedValueIterationApplicable(env);
 }
 
 template<class SparseMdpModelType>
 void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::updateCachedData(Environment const& env,
                                                                                    helper::rewardbounded::EpochModel<ValueType, false> const& epochModel,
-                                                                                   EpochCheckingData& cachedData, std::vector<ValueType> const& weightVector) {
+                                                                                   EpochCheckingData& cachedData,
+                                                                                   std::vector<ValueType> const& weightVector) const {
     if (epochModel.epochMatrixChanged) {
         // Update the cached MinMaxSolver data
         cachedData.bMinMax.resize(epochModel.epochMatrix.getRowCount());
@@ -363,6 +440,11 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::updateCachedDa
         for (auto& x_o : cachedData.xLinEq) {
             x_o.assign(epochModel.epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
         }
+        cachedData.linEqViOperator.reset();
+        if (useInterleavedValueIteration(env)) {
+            cachedData.bLinEqInterleaved.resize(epochModel.epochMatrix.getRowGroupCount() * this->objectives.size());
+            cachedData.xLinEqInterleaved.resize(epochModel.epochMatrix.getRowGroupCount() * this->objectives.size());
+        }
     }
 }
 
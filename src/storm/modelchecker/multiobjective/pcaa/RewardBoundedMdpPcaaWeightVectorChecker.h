@@ -6,6 +6,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/ValueIterationOperatorForward.h"
 
 #include "storm/utility/Stopwatch.h"
 
@@ -57,14 +58,37 @@ class RewardBoundedMdpPcaaWeightVectorChecker : public PcaaWeightVectorChecker<S
         std::vector<std::vector<ValueType>> xLinEq;
         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
 
+        // Only used if the equation systems of all objectives are solved at once using interleaved value iteration
+        std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, true>> linEqViOperator;
+        std::vector<ValueType> bLinEqInterleaved;
+        std::vector<ValueType> xLinEqInterleaved;
+
         std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> solutions;
     };
 
     void computeEpochSolution(Environment const& env, typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch,
                               std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData);
 
+    /*!
+     * Computes the solution of the given epoch model w.r.t. the given weight vector. Only the given cached data is modified, allowing concurrent invocations.
+     */
+    std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> analyzeEpochModel(
+        Environment const& env, helper::rewardbounded::EpochModel<ValueType, false>& epochModel, std::vector<ValueType> const& weightVector,
+        EpochCheckingData& cachedData) const;
+
     void updateCachedData(Environment const& env, typename helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, EpochCheckingData& cachedData,
-                          std::vector<ValueType> const& weightVector);
+                          std::vector<ValueType> const& weightVector) const;
+
+    /*!
+     * Solves the equation systems of all objectives (whose right-hand sides are stored in the cached data) at once and appends the results.
+     */
+    void solveInterleaved(Environment const& env, helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, EpochCheckingData& cachedData,
+                          std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType>& result) const;
+
+    /*!
+     * Retrieves whether the equation systems of the individual objectives are solved at once using interleaved value iteration.
+     */
+    bool useInterleavedValueIteration(Environment const& env) const;
 
     storm::utility::Stopwatch swAll, swEpochModelBuild, swEpochModelAnalysis;
     uint64_t numCheckedEpochs, numChecks;
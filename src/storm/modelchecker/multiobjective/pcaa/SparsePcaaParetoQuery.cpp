@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
@@ -64,37 +66,52 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    uint_fast64_t objIndex = 0;
+    while (objIndex < this->objectives.size() && !this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
+        std::vector<WeightVector> directions;
+        for (uint64_t batchSize = this->getRefinementBatchSize(env); objIndex < this->objectives.size() && directions.size() < batchSize; ++objIndex) {
+            WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            direction[objIndex] = storm::utility::one<GeometryValueType>();
+            directions.push_back(std::move(direction));
         }
+        this->performRefinementSteps(env, std::move(directions));
     }
 
+    GeometryValueType const precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // For each halfspace of the underApproximation, get the maximal distance to a vertex of the overApproximation.
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        std::vector<std::pair<GeometryValueType, uint_fast64_t>> distanceHalfspacePairs;
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
             for (auto const& vertex : overApproxVertices) {
-                GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
-                }
+                farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
+            }
+            if (!storm::utility::isZero(farestDistance)) {
+                distanceHalfspacePairs.emplace_back(farestDistance, halfspaceIndex);
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        // Sort the halfspaces in descending order of their distances. Halfspaces with the same distance remain in their original order.
+        std::stable_sort(distanceHalfspacePairs.begin(), distanceHalfspacePairs.end(),
+                         [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+        if (distanceHalfspacePairs.empty() || distanceHalfspacePairs.front().first < precision) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~"
+                       << storm::utility::convertNumber<double>(distanceHalfspacePairs.front().first));
+
+        // Refine in the direction of the halfspaces with the largest distances.
+        std::vector<WeightVector> directions;
+        uint64_t batchSize = this->getRefinementBatchSize(env);
+        for (auto const& distanceHalfspacePair : distanceHalfspacePairs) {
+            if (directions.size() >= batchSize || distanceHalfspacePair.first < precision) {
+                break;
+            }
+            directions.push_back(underApproxHalfspaces[distanceHalfspacePair.second].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
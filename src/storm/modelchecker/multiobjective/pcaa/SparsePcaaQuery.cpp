@@ -1,6 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
@@ -11,7 +12,9 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
+#include "storm/utility/Metrics.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -31,6 +34,8 @@ template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
     : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
+    this->lastCheckedWeightVectors.emplace_back();
+    this->weightVectorCheckerNotCloneable = false;
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
     this->overApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createUniversalPolytope();
@@ -89,47 +94,137 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
 
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
-    // Normalize the direction vector so that the entries sum up to one
-    storm::utility::vector::scaleVectorInPlace(
-        direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-    STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
-    RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
-    // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-            step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-            step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+    std::vector<WeightVector> directions;
+    directions.push_back(std::move(direction));
+    performRefinementSteps(env, std::move(directions));
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    STORM_LOG_ASSERT(!directions.empty(), "No direction given.");
+    STORM_LOG_ASSERT(directions.size() <= 1 + additionalWeightVectorCheckers.size(), "Not enough weight vector checkers to process the given directions.");
+    std::vector<PcaaWeightVectorChecker<SparseModelType>*> checkers;
+    checkers.push_back(weightVectorChecker.get());
+    for (auto const& checker : additionalWeightVectorCheckers) {
+        checker->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+        checkers.push_back(checker.get());
+    }
+
+    // Assign to each direction the checker whose most recently checked weight vector has the smallest angle to the direction.
+    // This way, the checkers can reuse the results of their previous check.
+    std::vector<uint64_t> directionToCheckerMap;
+    directionToCheckerMap.reserve(directions.size());
+    storm::storage::BitVector availableCheckers(checkers.size(), true);
+    for (auto& direction : directions) {
+        // Normalize the direction vector so that the entries sum up to one
+        GeometryValueType directionSum = std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>());
+        storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / directionSum);
+        std::vector<double> directionAsDouble = storm::utility::vector::convertNumericVector<double>(direction);
+        uint64_t closestChecker = availableCheckers.getNextSetIndex(0);
+        double closestCosine = -2.0;
+        for (auto checkerIndex : availableCheckers) {
+            if (lastCheckedWeightVectors[checkerIndex].empty()) {
+                continue;
+            }
+            std::vector<double> lastWeightVector = storm::utility::vector::convertNumericVector<double>(lastCheckedWeightVectors[checkerIndex]);
+            double cosine = storm::utility::vector::dotProduct(directionAsDouble, lastWeightVector) /
+                            std::sqrt(storm::utility::vector::dotProduct(directionAsDouble, directionAsDouble) *
+                                      storm::utility::vector::dotProduct(lastWeightVector, lastWeightVector));
+            if (cosine > closestCosine) {
+                closestChecker = checkerIndex;
+                closestCosine = cosine;
+            }
+        }
+        directionToCheckerMap.push_back(closestChecker);
+        availableCheckers.set(closestChecker, false);
+    }
+
+    // The worker threads only run the checks. Values of the geometry value type are only handled on this thread, as they are not thread-safe.
+    std::vector<std::vector<typename SparseModelType::ValueType>> weightVectors;
+    weightVectors.reserve(directions.size());
+    for (auto const& direction : directions) {
+        weightVectors.push_back(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+    }
+    // The checks run on worker threads, so we attach their phases explicitly to the phase of this thread
+    auto const parentPhase = storm::utility::metrics::MetricsRecorder::instance().getRunningPhase();
+    storm::utility::parallel::executeTasks(directions.size(), directions.size(), [&](uint64_t directionIndex, uint64_t) {
+        storm::utility::metrics::ScopedTimer checkPhase("weight vector check", parentPhase);
+        storm::utility::metrics::addToCounter("weight vector checks");
+        checkers[directionToCheckerMap[directionIndex]]->check(env, weightVectors[directionIndex]);
+    });
+
+    std::vector<RefinementStep> newSteps(directions.size());
+    for (uint64_t directionIndex = 0; directionIndex < directions.size(); ++directionIndex) {
+        auto const& checker = *checkers[directionToCheckerMap[directionIndex]];
+        STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
+                            storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
+        RefinementStep& step = newSteps[directionIndex];
+        step.weightVector = directions[directionIndex];
+        step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+        step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
+        // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
+        for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+            if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+            }
         }
     }
-    refinementSteps.push_back(std::move(step));
 
-    updateOverApproximation();
+    for (uint64_t directionIndex = 0; directionIndex < directions.size(); ++directionIndex) {
+        lastCheckedWeightVectors[directionToCheckerMap[directionIndex]] = std::move(directions[directionIndex]);
+        refinementSteps.push_back(std::move(newSteps[directionIndex]));
+    }
+
+    updateOverApproximation(newSteps.size());
     updateUnderApproximation();
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
-    storm::storage::geometry::Halfspace<GeometryValueType> h(
-        refinementSteps.back().weightVector, storm::utility::vector::dotProduct(refinementSteps.back().weightVector, refinementSteps.back().upperBoundPoint));
-
-    // Due to numerical issues, it might be the case that the updated overapproximation does not contain the underapproximation,
-    // e.g., when the new point is strictly contained in the underapproximation. Check if this is the case.
-    GeometryValueType maximumOffset = h.offset();
-    for (auto const& step : refinementSteps) {
-        maximumOffset = std::max(maximumOffset, storm::utility::vector::dotProduct(h.normalVector(), step.lowerBoundPoint));
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getRefinementBatchSize(Environment const& env) {
+    if constexpr (!storm::utility::parallel::isThreadSafeValueType<typename SparseModelType::ValueType>) {
+        // Copies of values that are not thread-safe share their data, so the checkers (and their clones) can not run concurrently.
+        return 1;
+    }
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfThreads());
+    while (additionalWeightVectorCheckers.size() + 1 < numberOfThreads && !weightVectorCheckerNotCloneable) {
+        auto clonedChecker = weightVectorChecker->clone();
+        if (clonedChecker) {
+            additionalWeightVectorCheckers.push_back(std::move(clonedChecker));
+            lastCheckedWeightVectors.push_back(lastCheckedWeightVectors.front());
+        } else {
+            STORM_LOG_INFO("The weight vector checker for this query does not support concurrent checks. Weight vectors are checked sequentially.");
+            weightVectorCheckerNotCloneable = true;
+        }
+    }
+    uint64_t result = std::min<uint64_t>(numberOfThreads, 1 + additionalWeightVectorCheckers.size());
+    if (env.modelchecker().multi().isMaxStepsSet() && this->refinementSteps.size() < env.modelchecker().multi().getMaxSteps()) {
+        result = std::min<uint64_t>(result, env.modelchecker().multi().getMaxSteps() - this->refinementSteps.size());
     }
-    if (maximumOffset > h.offset()) {
-        // We correct the issue by shifting the halfspace such that it contains the underapproximation
-        h.offset() = maximumOffset;
-        STORM_LOG_WARN("Numerical issues: The overapproximation would not contain the underapproximation. Hence, a halfspace is shifted by "
-                       << storm::utility::convertNumber<double>(h.invert().euclideanDistance(refinementSteps.back().upperBoundPoint)) << ".");
+    return result;
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation(uint64_t numberOfNewSteps) {
+    STORM_LOG_ASSERT(numberOfNewSteps <= refinementSteps.size(), "Invalid number of new refinement steps.");
+    for (auto newStepIt = refinementSteps.end() - numberOfNewSteps; newStepIt != refinementSteps.end(); ++newStepIt) {
+        storm::storage::geometry::Halfspace<GeometryValueType> h(newStepIt->weightVector,
+                                                                 storm::utility::vector::dotProduct(newStepIt->weightVector, newStepIt->upperBoundPoint));
+
+        // Due to numerical issues, it might be the case that the updated overapproximation does not contain the underapproximation,
+        // e.g., when the new point is strictly contained in the underapproximation. Check if this is the case.
+        GeometryValueType maximumOffset = h.offset();
+        for (auto const& step : refinementSteps) {
+            maximumOffset = std::max(maximumOffset, storm::utility::vector::dotProduct(h.normalVector(), step.lowerBoundPoint));
+        }
+        if (maximumOffset > h.offset()) {
+            // We correct the issue by shifting the halfspace such that it contains the underapproximation
+            h.offset() = maximumOffset;
+            STORM_LOG_WARN("Numerical issues: The overapproximation would not contain the underapproximation. Hence, a halfspace is shifted by "
+                           << storm::utility::convertNumber<double>(h.invert().euclideanDistance(newStepIt->upperBoundPoint)) << ".");
+        }
+        overApproximation = overApproximation->intersection(h);
     }
-    overApproximation = overApproximation->intersection(h);
     STORM_LOG_DEBUG("Updated OverApproximation to " << overApproximation->toString(true));
 }
 
@@ -69,11 +69,27 @@ class SparsePcaaQuery {
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
     /*
-     * Updates the overapproximation after a refinement step has been performed
+     * Refines the current result w.r.t. the given direction vectors.
+     * The directions are checked concurrently (using copies of the weight vector checker) and the approximations are updated once all directions have been
+     * checked. Each direction is assigned to the checker whose most recently checked weight vector is closest to the direction.
      *
-     * @note The last entry of this->refinementSteps should be the newest step whose information is not yet included in the approximation.
+     * @pre the number of directions does not exceed the value returned by getRefinementBatchSize(..)
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the maximal number of directions that can be processed in a single call of performRefinementSteps(..).
+     * This takes the number of threads and the maximal number of refinement steps (as possibly specified in the settings) into account.
+     */
+    uint64_t getRefinementBatchSize(Environment const& env);
+
+    /*
+     * Updates the overapproximation after refinement steps have been performed
+     *
+     * @param numberOfNewSteps the number of steps whose information is not yet included in the approximation.
+     * @note The last numberOfNewSteps entries of this->refinementSteps should be the newest steps whose information is not yet included in the approximation.
      */
-    void updateOverApproximation();
+    void updateOverApproximation(uint64_t numberOfNewSteps = 1);
 
     /*
      * Updates the underapproximation after a refinement step has been performed
@@ -94,6 +110,12 @@ class SparsePcaaQuery {
 
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+    // Copies of the weight vector checker that are used to check multiple weight vectors concurrently
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+    // For the weight vector checker and each of its copies, the most recently checked weight vector (or an empty vector if there is none)
+    std::vector<WeightVector> lastCheckedWeightVectors;
+    // True if the weight vector checker can not be copied
+    bool weightVectorCheckerNotCloneable;
 
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
@@ -33,34 +33,34 @@ StandardMaPcaaWeightVectorChecker<SparseMaModelType>::StandardMaPcaaWeightVector
 }
 
 template<class SparseMaModelType>
-void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initializeModelTypeSpecificData(SparseMaModelType const& model) {
+void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initializeModelTypeSpecificData(SparseMaModelType const& model, ModelData& data) {
     markovianStates = model.getMarkovianStates();
     exitRates = model.getExitRates();
 
     // Set the (discretized) state action rewards.
-    this->actionRewards.assign(this->objectives.size(), {});
-    this->stateRewards.assign(this->objectives.size(), {});
+    data.actionRewards.assign(this->objectives.size(), {});
+    data.stateRewards.assign(this->objectives.size(), {});
     for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         auto const& formula = *this->objectives[objIndex].formula;
         STORM_LOG_THROW(formula.isRewardOperatorFormula() && formula.asRewardOperatorFormula().hasRewardModelName(), storm::exceptions::UnexpectedException,
                         "Unexpected type of operator formula: " << formula);
         typename SparseMaModelType::RewardModelType const& rewModel = model.getRewardModel(formula.asRewardOperatorFormula().getRewardModelName());
         STORM_LOG_ASSERT(!rewModel.hasTransitionRewards(), "Preprocessed Reward model has transition rewards which is not expected.");
-        this->actionRewards[objIndex] = rewModel.hasStateActionRewards()
+        data.actionRewards[objIndex] = rewModel.hasStateActionRewards()
                                             ? rewModel.getStateActionRewardVector()
                                             : std::vector<ValueType>(model.getTransitionMatrix().getRowCount(), storm::utility::zero<ValueType>());
         if (formula.getSubformula().isTotalRewardFormula()) {
             if (rewModel.hasStateRewards()) {
                 // Note that state rewards are earned over time and thus play no role for probabilistic states
                 for (auto markovianState : markovianStates) {
-                    this->actionRewards[objIndex][model.getTransitionMatrix().getRowGroupIndices()[markovianState]] +=
+                    data.actionRewards[objIndex][model.getTransitionMatrix().getRowGroupIndices()[markovianState]] +=
                         rewModel.getStateReward(markovianState) / exitRates[markovianState];
                 }
             }
         } else if (formula.getSubformula().isLongRunAverageRewardFormula()) {
             // The LRA methods for MA require keeping track of state- and action rewards separately
             if (rewModel.hasStateRewards()) {
-                this->stateRewards[objIndex] = rewModel.getStateRewardVector();
+                data.stateRewards[objIndex] = rewModel.getStateRewardVector();
             }
         } else {
             STORM_LOG_THROW(formula.getSubformula().isCumulativeRewardFormula() &&
@@ -84,14 +84,14 @@ void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initializeModelTypeSp
 template<class SparseMdpModelType>
 storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<typename SparseMdpModelType::ValueType>
 StandardMaPcaaWeightVectorChecker<SparseMdpModelType>::createNondetInfiniteHorizonHelper(storm::storage::SparseMatrix<ValueType> const& transitions) const {
-    STORM_LOG_ASSERT(transitions.getRowGroupCount() == this->transitionMatrix.getRowGroupCount(), "Unexpected size of given matrix.");
+    STORM_LOG_ASSERT(transitions.getRowGroupCount() == this->modelData->transitionMatrix.getRowGroupCount(), "Unexpected size of given matrix.");
     return storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType>(transitions, this->markovianStates, this->exitRates);
 }
 
 template<class SparseMdpModelType>
 storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<typename SparseMdpModelType::ValueType>
 StandardMaPcaaWeightVectorChecker<SparseMdpModelType>::createDetInfiniteHorizonHelper(storm::storage::SparseMatrix<ValueType> const& transitions) const {
-    STORM_LOG_ASSERT(transitions.getRowGroupCount() == this->transitionMatrix.getRowGroupCount(), "Unexpected size of given matrix.");
+    STORM_LOG_ASSERT(transitions.getRowGroupCount() == this->modelData->transitionMatrix.getRowGroupCount(), "Unexpected size of given matrix.");
     // TODO: Right now, there is no dedicated support for "deterministic" Markov automata so we have to pick the nondeterministic one.
     auto result = storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType>(transitions, this->markovianStates, this->exitRates);
     result.setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
@@ -128,7 +128,7 @@ void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::boundedPhase(Environm
     std::vector<uint_fast64_t> optimalChoicesAtCurrentEpoch(PS.getNumberOfStates(), std::numeric_limits<uint_fast64_t>::max());
 
     // Stores the objectives for which we need to compute values in the current time epoch.
-    storm::storage::BitVector consideredObjectives = this->objectivesWithNoUpperTimeBound & ~this->lraObjectives;
+    storm::storage::BitVector consideredObjectives = this->modelData->objectivesWithNoUpperTimeBound & ~this->modelData->lraObjectives;
 
     auto upperTimeBoundIt = upperTimeBounds.begin();
     uint_fast64_t currentEpoch = upperTimeBounds.empty() ? 0 : upperTimeBoundIt->first;
@@ -166,13 +166,13 @@ typename StandardMaPcaaWeightVectorChecker<SparseMaModelType>::SubModel Standard
 
     storm::storage::BitVector probabilisticStates = ~markovianStates;
     result.states = createMS ? markovianStates : probabilisticStates;
-    result.choices = this->transitionMatrix.getRowFilter(result.states);
+    result.choices = this->modelData->transitionMatrix.getRowFilter(result.states);
     STORM_LOG_ASSERT(!createMS || result.states.getNumberOfSetBits() == result.choices.getNumberOfSetBits(),
                      "row groups for Markovian states should consist of exactly one row");
 
     // We need to add diagonal entries for selfloops on Markovian states.
-    result.toMS = this->transitionMatrix.getSubmatrix(true, result.states, markovianStates, createMS);
-    result.toPS = this->transitionMatrix.getSubmatrix(true, result.states, probabilisticStates, false);
+    result.toMS = this->modelData->transitionMatrix.getSubmatrix(true, result.states, markovianStates, createMS);
+    result.toPS = this->modelData->transitionMatrix.getSubmatrix(true, result.states, probabilisticStates, false);
     STORM_LOG_ASSERT(result.getNumberOfStates() == result.states.getNumberOfSetBits() && result.getNumberOfStates() == result.toMS.getRowGroupCount() &&
                          result.getNumberOfStates() == result.toPS.getRowGroupCount(),
                      "Invalid state count for subsystem");
@@ -183,7 +183,7 @@ typename StandardMaPcaaWeightVectorChecker<SparseMaModelType>::SubModel Standard
     result.weightedRewardVector.resize(result.getNumberOfChoices());
     storm::utility::vector::selectVectorValues(result.weightedRewardVector, result.choices, weightedRewardVector);
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        std::vector<ValueType> const& objRewards = this->actionRewards[objIndex];
+        std::vector<ValueType> const& objRewards = this->modelData->actionRewards[objIndex];
         std::vector<ValueType> subModelObjRewards;
         subModelObjRewards.reserve(result.getNumberOfChoices());
         for (auto choice : result.choices) {
@@ -244,7 +244,7 @@ VT StandardMaPcaaWeightVectorChecker<SparseMaModelType>::getDigitizationConstant
     // We brute-force a delta, since a direct computation is apparently not easy.
     // Also note that the number of times this loop runs is a lower bound for the number of minMaxSolver invocations.
     // Hence, this brute-force approach will most likely not be a bottleneck.
-    storm::storage::BitVector objectivesWithTimeBound = ~this->objectivesWithNoUpperTimeBound;
+    storm::storage::BitVector objectivesWithTimeBound = ~this->modelData->objectivesWithNoUpperTimeBound;
     uint_fast64_t smallestStepBound = 1;
     VT delta = smallestNonZeroBound / smallestStepBound;
     while (true) {
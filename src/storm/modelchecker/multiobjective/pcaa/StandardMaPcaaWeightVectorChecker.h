@@ -29,7 +29,9 @@ class StandardMaPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecker
     virtual ~StandardMaPcaaWeightVectorChecker() = default;
 
    protected:
-    virtual void initializeModelTypeSpecificData(SparseMaModelType const& model) override;
+    using typename StandardPcaaWeightVectorChecker<SparseMaModelType>::ModelData;
+
+    virtual void initializeModelTypeSpecificData(SparseMaModelType const& model, ModelData& data) override;
     virtual storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> createNondetInfiniteHorizonHelper(
         storm::storage::SparseMatrix<ValueType> const& transitions) const override;
     virtual storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> createDetInfiniteHorizonHelper(
@@ -26,9 +26,15 @@ StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::StandardMdpPcaaWeightVec
 }
 
 template<class SparseMdpModelType>
-void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::initializeModelTypeSpecificData(SparseMdpModelType const& model) {
+std::unique_ptr<PcaaWeightVectorChecker<SparseMdpModelType>> StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::clone() const {
+    // The copy shares the (immutable) model data with this checker and only copies the state of the most recent check.
+    return std::make_unique<StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>>(*this);
+}
+
+template<class SparseMdpModelType>
+void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::initializeModelTypeSpecificData(SparseMdpModelType const& model, ModelData& data) {
     // set the state action rewards. Also do some sanity checks on the objectives.
-    this->actionRewards.resize(this->objectives.size());
+    data.actionRewards.resize(this->objectives.size());
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         auto const& formula = *this->objectives[objIndex].formula;
         STORM_LOG_THROW(formula.isRewardOperatorFormula() && formula.asRewardOperatorFormula().hasRewardModelName(), storm::exceptions::UnexpectedException,
@@ -44,21 +50,21 @@ void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::initializeModelType
         typename SparseMdpModelType::RewardModelType const& rewModel = model.getRewardModel(formula.asRewardOperatorFormula().getRewardModelName());
         STORM_LOG_THROW(!rewModel.hasTransitionRewards(), storm::exceptions::NotSupportedException,
                         "Reward model has transition rewards which is not expected.");
-        this->actionRewards[objIndex] = rewModel.getTotalRewardVector(model.getTransitionMatrix());
+        data.actionRewards[objIndex] = rewModel.getTotalRewardVector(model.getTransitionMatrix());
     }
 }
 
 template<class SparseMdpModelType>
 storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<typename SparseMdpModelType::ValueType>
 StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::createNondetInfiniteHorizonHelper(storm::storage::SparseMatrix<ValueType> const& transitions) const {
-    STORM_LOG_ASSERT(transitions.getRowGroupCount() == this->transitionMatrix.getRowGroupCount(), "Unexpected size of given matrix.");
+    STORM_LOG_ASSERT(transitions.getRowGroupCount() == this->modelData->transitionMatrix.getRowGroupCount(), "Unexpected size of given matrix.");
     return storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType>(transitions);
 }
 
 template<class SparseMdpModelType>
 storm::modelchecker::helper::SparseDeterministicInfiniteHorizonHelper<typename SparseMdpModelType::ValueType>
 StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::createDetInfiniteHorizonHelper(storm::storage::SparseMatrix<ValueType> const& transitions) const {
-    STORM_LOG_ASSERT(transitions.getRowGroupCount() == this->transitionMatrix.getRowGroupCount(), "Unexpected size of given matrix.");
+    STORM_LOG_ASSERT(transitions.getRowGroupCount() == this->modelData->transitionMatrix.getRowGroupCount(), "Unexpected size of given matrix.");
     return storm::modelchecker::helper::SparseDeterministicInfiniteHorizonHelper<ValueType>(transitions);
 }
 
@@ -66,9 +72,9 @@ template<class SparseMdpModelType>
 void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::boundedPhase(Environment const& env, std::vector<ValueType> const& weightVector,
                                                                           std::vector<ValueType>& weightedRewardVector) {
     // Allocate some memory so this does not need to happen for each time epoch
-    std::vector<uint_fast64_t> optimalChoicesInCurrentEpoch(this->transitionMatrix.getRowGroupCount());
+    std::vector<uint_fast64_t> optimalChoicesInCurrentEpoch(this->modelData->transitionMatrix.getRowGroupCount());
     std::vector<ValueType> choiceValues(weightedRewardVector.size());
-    std::vector<ValueType> temporaryResult(this->transitionMatrix.getRowGroupCount());
+    std::vector<ValueType> temporaryResult(this->modelData->transitionMatrix.getRowGroupCount());
     // Get for each occurring timeBound the indices of the objectives with that bound.
     std::map<uint_fast64_t, storm::storage::BitVector, std::greater<uint_fast64_t>> stepBounds;
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
@@ -88,7 +94,7 @@ void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::boundedPhase(Enviro
     }
 
     // Stores the objectives for which we need to compute values in the current time epoch.
-    storm::storage::BitVector consideredObjectives = this->objectivesWithNoUpperTimeBound & ~this->lraObjectives;
+    storm::storage::BitVector consideredObjectives = this->modelData->objectivesWithNoUpperTimeBound & ~this->modelData->lraObjectives;
 
     auto stepBoundIt = stepBounds.begin();
     uint_fast64_t currentEpoch = stepBounds.empty() ? 0 : stepBoundIt->first;
@@ -100,28 +106,29 @@ void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::boundedPhase(Enviro
                 // This objective now plays a role in the weighted sum
                 ValueType factor =
                     storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType()) ? -weightVector[objIndex] : weightVector[objIndex];
-                storm::utility::vector::addScaledVector(weightedRewardVector, this->actionRewards[objIndex], factor);
+                storm::utility::vector::addScaledVector(weightedRewardVector, this->modelData->actionRewards[objIndex], factor);
             }
             ++stepBoundIt;
         }
 
         // Get values and scheduler for weighted sum of objectives
-        this->transitionMatrix.multiplyWithVector(this->weightedResult, choiceValues);
+        this->modelData->transitionMatrix.multiplyWithVector(this->weightedResult, choiceValues);
         storm::utility::vector::addVectors(choiceValues, weightedRewardVector, choiceValues);
-        storm::utility::vector::reduceVectorMax(choiceValues, this->weightedResult, this->transitionMatrix.getRowGroupIndices(), &optimalChoicesInCurrentEpoch);
+        storm::utility::vector::reduceVectorMax(choiceValues, this->weightedResult, this->modelData->transitionMatrix.getRowGroupIndices(),
+                                                &optimalChoicesInCurrentEpoch);
 
         // get values for individual objectives
         for (auto objIndex : consideredObjectives) {
             std::vector<ValueType>& objectiveResult = this->objectiveResults[objIndex];
-            std::vector<ValueType> const& objectiveRewards = this->actionRewards[objIndex];
-            auto rowGroupIndexIt = this->transitionMatrix.getRowGroupIndices().begin();
+            std::vector<ValueType> const& objectiveRewards = this->modelData->actionRewards[objIndex];
+            auto rowGroupIndexIt = this->modelData->transitionMatrix.getRowGroupIndices().begin();
             auto optimalChoiceIt = optimalChoicesInCurrentEpoch.begin();
             for (ValueType& stateValue : temporaryResult) {
                 uint_fast64_t row = (*rowGroupIndexIt) + (*optimalChoiceIt);
                 ++rowGroupIndexIt;
                 ++optimalChoiceIt;
                 stateValue = objectiveRewards[row];
-                for (auto const& entry : this->transitionMatrix.getRow(row)) {
+                for (auto const& entry : this->modelData->transitionMatrix.getRow(row)) {
                     stateValue += entry.getValue() * objectiveResult[entry.getColumn()];
                 }
             }
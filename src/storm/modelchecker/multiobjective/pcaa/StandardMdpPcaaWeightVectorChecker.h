@@ -36,8 +36,12 @@ class StandardMdpPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecke
 
     virtual ~StandardMdpPcaaWeightVectorChecker() = default;
 
+    virtual std::unique_ptr<PcaaWeightVectorChecker<SparseMdpModelType>> clone() const override;
+
    protected:
-    virtual void initializeModelTypeSpecificData(SparseMdpModelType const& model) override;
+    using typename StandardPcaaWeightVectorChecker<SparseMdpModelType>::ModelData;
+
+    virtual void initializeModelTypeSpecificData(SparseMdpModelType const& model, ModelData& data) override;
     virtual storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> createNondetInfiniteHorizonHelper(
         storm::storage::SparseMatrix<ValueType> const& transitions) const override;
     virtual storm::modelchecker::helper::SparseDeterministicInfiniteHorizonHelper<ValueType> createDetInfiniteHorizonHelper(
@@ -15,8 +15,11 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/transformer/GoalStateMerger.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -66,68 +69,72 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::initialize(
                                         std::vector<std::string>(relevantRewardModels.begin(), relevantRewardModels.end()), finiteTotalRewardChoices);
 
     // Initialize data specific for the considered model type
-    initializeModelTypeSpecificData(*mergerResult.model);
+    auto data = std::make_shared<ModelData>();
+    initializeModelTypeSpecificData(*mergerResult.model, *data);
 
     // Initilize general data of the model
-    transitionMatrix = std::move(mergerResult.model->getTransitionMatrix());
-    initialState = *mergerResult.model->getInitialStates().begin();
-    totalReward0EStates = rewardAnalysis.totalReward0EStates % maybeStates;
+    data->transitionMatrix = std::move(mergerResult.model->getTransitionMatrix());
+    auto const& transitionMatrix = data->transitionMatrix;
+    data->initialState = *mergerResult.model->getInitialStates().begin();
+    data->totalReward0EStates = rewardAnalysis.totalReward0EStates % maybeStates;
     if (mergerResult.targetState) {
         // There is an additional state in the result
-        totalReward0EStates.resize(totalReward0EStates.size() + 1, true);
+        data->totalReward0EStates.resize(data->totalReward0EStates.size() + 1, true);
 
         // The overapproximation for the possible ec choices consists of the states that can reach the target states with prob. 0 and the target state itself.
         storm::storage::BitVector targetStateAsVector(transitionMatrix.getRowGroupCount(), false);
         targetStateAsVector.set(*mergerResult.targetState, true);
-        ecChoicesHint = transitionMatrix.getRowFilter(
+        data->ecChoicesHint = transitionMatrix.getRowFilter(
             storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), transitionMatrix.transpose(true),
                                                  storm::storage::BitVector(targetStateAsVector.size(), true), targetStateAsVector));
-        ecChoicesHint.set(transitionMatrix.getRowGroupIndices()[*mergerResult.targetState], true);
+        data->ecChoicesHint.set(transitionMatrix.getRowGroupIndices()[*mergerResult.targetState], true);
     } else {
-        ecChoicesHint = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
+        data->ecChoicesHint = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
     }
 
     // set data for unbounded objectives
-    lraObjectives = storm::storage::BitVector(this->objectives.size(), false);
-    objectivesWithNoUpperTimeBound = storm::storage::BitVector(this->objectives.size(), false);
-    actionsWithoutRewardInUnboundedPhase = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
+    data->lraObjectives = storm::storage::BitVector(this->objectives.size(), false);
+    data->objectivesWithNoUpperTimeBound = storm::storage::BitVector(this->objectives.size(), false);
+    data->actionsWithoutRewardInUnboundedPhase = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         auto const& formula = *this->objectives[objIndex].formula;
         if (formula.getSubformula().isTotalRewardFormula()) {
-            objectivesWithNoUpperTimeBound.set(objIndex, true);
-            actionsWithoutRewardInUnboundedPhase &= storm::utility::vector::filterZero(actionRewards[objIndex]);
+            data->objectivesWithNoUpperTimeBound.set(objIndex, true);
+            data->actionsWithoutRewardInUnboundedPhase &= storm::utility::vector::filterZero(data->actionRewards[objIndex]);
         }
         if (formula.getSubformula().isLongRunAverageRewardFormula()) {
-            lraObjectives.set(objIndex, true);
-            objectivesWithNoUpperTimeBound.set(objIndex, true);
+            data->lraObjectives.set(objIndex, true);
+            data->objectivesWithNoUpperTimeBound.set(objIndex, true);
         }
     }
 
     // Set data for LRA objectives (if available)
-    if (!lraObjectives.empty()) {
+    if (!data->lraObjectives.empty()) {
+        data->lraMecs = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, transitionMatrix.transpose(true),
+                                                                                    storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true),
+                                                                                    data->actionsWithoutRewardInUnboundedPhase);
         lraMecDecomposition = LraMecDecomposition();
-        lraMecDecomposition->mecs = storm::storage::MaximalEndComponentDecomposition<ValueType>(
-            transitionMatrix, transitionMatrix.transpose(true), storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true),
-            actionsWithoutRewardInUnboundedPhase);
-        lraMecDecomposition->auxMecValues.resize(lraMecDecomposition->mecs.size());
+        lraMecDecomposition->auxMecValues.resize(data->lraMecs.size());
     }
+    modelData = std::move(data);
 
     // initialize data for the results
     checkHasBeenCalled = false;
+    hasWarmStartValues = false;
     objectiveResults.resize(this->objectives.size());
     offsetsToUnderApproximation.resize(this->objectives.size(), storm::utility::zero<ValueType>());
     offsetsToOverApproximation.resize(this->objectives.size(), storm::utility::zero<ValueType>());
-    optimalChoices.resize(transitionMatrix.getRowGroupCount(), 0);
+    optimalChoices.resize(modelData->transitionMatrix.getRowGroupCount(), 0);
 
     // Print some statistics (if requested)
     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
         STORM_PRINT_AND_LOG("Weight Vector Checker Statistics:\n");
-        STORM_PRINT_AND_LOG("Final preprocessed model has " << transitionMatrix.getRowGroupCount() << " states.\n");
-        STORM_PRINT_AND_LOG("Final preprocessed model has " << transitionMatrix.getRowCount() << " actions.\n");
+        STORM_PRINT_AND_LOG("Final preprocessed model has " << modelData->transitionMatrix.getRowGroupCount() << " states.\n");
+        STORM_PRINT_AND_LOG("Final preprocessed model has " << modelData->transitionMatrix.getRowCount() << " actions.\n");
         if (lraMecDecomposition) {
-            STORM_PRINT_AND_LOG("Found " << lraMecDecomposition->mecs.size() << " end components that are relevant for LRA-analysis.\n");
+            STORM_PRINT_AND_LOG("Found " << modelData->lraMecs.size() << " end components that are relevant for LRA-analysis.\n");
             uint64_t numLraMecStates = 0;
-            for (auto const& mec : this->lraMecDecomposition->mecs) {
+            for (auto const& mec : modelData->lraMecs) {
                 numLraMecStates += mec.size();
             }
             STORM_PRINT_AND_LOG(numLraMecStates << " states lie on such an end component.\n");
@@ -143,18 +150,18 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::check(Environment const&
                    << "\t" << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVector)));
 
     // Prepare and invoke weighted infinite horizon (long run average) phase
-    std::vector<ValueType> weightedRewardVector(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
-    if (!lraObjectives.empty()) {
+    std::vector<ValueType> weightedRewardVector(modelData->transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+    if (!modelData->lraObjectives.empty()) {
         boost::optional<std::vector<ValueType>> weightedStateRewardVector;
-        for (auto objIndex : lraObjectives) {
+        for (auto objIndex : modelData->lraObjectives) {
             ValueType weight =
                 storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType()) ? -weightVector[objIndex] : weightVector[objIndex];
-            storm::utility::vector::addScaledVector(weightedRewardVector, actionRewards[objIndex], weight);
-            if (!stateRewards.empty() && !stateRewards[objIndex].empty()) {
+            storm::utility::vector::addScaledVector(weightedRewardVector, modelData->actionRewards[objIndex], weight);
+            if (!modelData->stateRewards.empty() && !modelData->stateRewards[objIndex].empty()) {
                 if (!weightedStateRewardVector) {
-                    weightedStateRewardVector = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                    weightedStateRewardVector = std::vector<ValueType>(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
                 }
-                storm::utility::vector::addScaledVector(weightedStateRewardVector.get(), stateRewards[objIndex], weight);
+                storm::utility::vector::addScaledVector(weightedStateRewardVector.get(), modelData->stateRewards[objIndex], weight);
             }
         }
         infiniteHorizonWeightedPhase(env, weightedRewardVector, weightedStateRewardVector);
@@ -163,12 +170,12 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::check(Environment const&
     }
 
     // Prepare and invoke weighted indefinite horizon (unbounded total reward) phase
-    auto totalRewardObjectives = objectivesWithNoUpperTimeBound & ~lraObjectives;
+    auto totalRewardObjectives = modelData->objectivesWithNoUpperTimeBound & ~modelData->lraObjectives;
     for (auto objIndex : totalRewardObjectives) {
         if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-            storm::utility::vector::addScaledVector(weightedRewardVector, actionRewards[objIndex], -weightVector[objIndex]);
+            storm::utility::vector::addScaledVector(weightedRewardVector, modelData->actionRewards[objIndex], -weightVector[objIndex]);
         } else {
-            storm::utility::vector::addScaledVector(weightedRewardVector, actionRewards[objIndex], weightVector[objIndex]);
+            storm::utility::vector::addScaledVector(weightedRewardVector, modelData->actionRewards[objIndex], weightVector[objIndex]);
         }
     }
     unboundedWeightedPhase(env, weightedRewardVector, weightVector);
@@ -183,6 +190,8 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::check(Environment const&
     }
     STORM_LOG_INFO("Weight vector check done. Lower bounds for results in initial state: "
                    << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(getUnderApproximationOfInitialStateResults())));
+    // The objective results are the values induced by the (memoryless) optimal choices iff there are only total reward objectives.
+    hasWarmStartValues = modelData->lraObjectives.empty() && modelData->objectivesWithNoUpperTimeBound.full();
     // Validate that the results are sufficiently precise
     ValueType resultingWeightedPrecision =
         storm::utility::abs<ValueType>(storm::utility::vector::dotProduct(getOverApproximationOfInitialStateResults(), weightVector) -
@@ -199,7 +208,7 @@ StandardPcaaWeightVectorChecker<SparseModelType>::getUnderApproximationOfInitial
     std::vector<ValueType> res;
     res.reserve(this->objectives.size());
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        res.push_back(this->objectiveResults[objIndex][initialState] + this->offsetsToUnderApproximation[objIndex]);
+        res.push_back(this->objectiveResults[objIndex][modelData->initialState] + this->offsetsToUnderApproximation[objIndex]);
     }
     return res;
 }
@@ -211,7 +220,7 @@ StandardPcaaWeightVectorChecker<SparseModelType>::getOverApproximationOfInitialS
     std::vector<ValueType> res;
     res.reserve(this->objectives.size());
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        res.push_back(this->objectiveResults[objIndex][initialState] + this->offsetsToOverApproximation[objIndex]);
+        res.push_back(this->objectiveResults[objIndex][modelData->initialState] + this->offsetsToOverApproximation[objIndex]);
     }
     return res;
 }
@@ -351,12 +360,12 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::infiniteHorizonWeightedPh
                                                                                     boost::optional<std::vector<ValueType>> const& weightedStateRewardVector) {
     // Compute the optimal (weighted) lra value for each mec, keeping track of the optimal choices
     STORM_LOG_ASSERT(lraMecDecomposition, "Mec decomposition for lra computations not initialized.");
-    storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper = createNondetInfiniteHorizonHelper(this->transitionMatrix);
-    helper.provideLongRunComponentDecomposition(lraMecDecomposition->mecs);
+    storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper = createNondetInfiniteHorizonHelper(modelData->transitionMatrix);
+    helper.provideLongRunComponentDecomposition(modelData->lraMecs);
     helper.setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
     helper.setProduceScheduler(true);
-    for (uint64_t mecIndex = 0; mecIndex < lraMecDecomposition->mecs.size(); ++mecIndex) {
-        auto const& mec = lraMecDecomposition->mecs[mecIndex];
+    for (uint64_t mecIndex = 0; mecIndex < modelData->lraMecs.size(); ++mecIndex) {
+        auto const& mec = modelData->lraMecs[mecIndex];
         auto actionValueGetter = [&weightedActionRewardVector](uint64_t const& a) { return weightedActionRewardVector[a]; };
         typename storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType>::ValueGetter stateValueGetter;
         if (weightedStateRewardVector) {
@@ -374,20 +383,21 @@ template<class SparseModelType>
 void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(Environment const& env, std::vector<ValueType> const& weightedRewardVector,
                                                                               std::vector<ValueType> const& weightVector) {
     // Catch the case where all values on the RHS of the MinMax equation system are zero.
-    if (this->objectivesWithNoUpperTimeBound.empty() ||
-        ((this->lraObjectives.empty() || !storm::utility::vector::hasNonZeroEntry(lraMecDecomposition->auxMecValues)) &&
+    if (modelData->objectivesWithNoUpperTimeBound.empty() ||
+        ((modelData->lraObjectives.empty() || !storm::utility::vector::hasNonZeroEntry(lraMecDecomposition->auxMecValues)) &&
          !storm::utility::vector::hasNonZeroEntry(weightedRewardVector))) {
-        this->weightedResult.assign(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-        storm::storage::BitVector statesInLraMec(transitionMatrix.getRowGroupCount(), false);
+        this->weightedResult.assign(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+        storm::storage::BitVector statesInLraMec(modelData->transitionMatrix.getRowGroupCount(), false);
         if (this->lraMecDecomposition) {
-            for (auto const& mec : this->lraMecDecomposition->mecs) {
+            for (auto const& mec : modelData->lraMecs) {
                 for (auto const& sc : mec) {
                     statesInLraMec.set(sc.first, true);
                 }
             }
         }
         // Get an arbitrary scheduler that yields finite reward for all objectives
-        computeSchedulerFinitelyOften(transitionMatrix, transitionMatrix.transpose(true), ~actionsWithoutRewardInUnboundedPhase, statesInLraMec,
+        auto const& transitionMatrix = modelData->transitionMatrix;
+        computeSchedulerFinitelyOften(transitionMatrix, transitionMatrix.transpose(true), ~modelData->actionsWithoutRewardInUnboundedPhase, statesInLraMec,
                                       this->optimalChoices);
         return;
     }
@@ -397,13 +407,13 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
     // Set up the choice values
     storm::utility::vector::selectVectorValues(ecQuotient->auxChoiceValues, ecQuotient->ecqToOriginalChoiceMapping, weightedRewardVector);
     std::map<uint64_t, uint64_t> ecqStateToOptimalMecMap;
-    if (!lraObjectives.empty()) {
+    if (!modelData->lraObjectives.empty()) {
         // We also need to assign a value for each ecQuotientChoice that corresponds to "staying" in the eliminated EC. (at this point these choices should all
         // have a value of zero). Since each of the eliminated ECs has to contain *at least* one LRA EC, we need to find the largest value among the contained
         // LRA ECs
         storm::storage::BitVector foundEcqChoices(ecQuotient->matrix.getRowCount(), false);  // keeps track of choices we have already seen before
-        for (uint64_t mecIndex = 0; mecIndex < lraMecDecomposition->mecs.size(); ++mecIndex) {
-            auto const& mec = lraMecDecomposition->mecs[mecIndex];
+        for (uint64_t mecIndex = 0; mecIndex < modelData->lraMecs.size(); ++mecIndex) {
+            auto const& mec = modelData->lraMecs[mecIndex];
             auto const& mecValue = lraMecDecomposition->auxMecValues[mecIndex];
             uint64_t ecqState = ecQuotient->originalToEcqStateMapping[mec.begin()->first];
             if (ecqState >= ecQuotient->matrix.getRowGroupCount()) {
@@ -436,7 +446,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
     solver->setHasUniqueSolution(true);
     solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
     auto req = solver->getRequirements(env, storm::solver::OptimizationDirection::Maximize);
-    setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), weightVector, objectivesWithNoUpperTimeBound, ecQuotient->matrix,
+    setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), weightVector, modelData->objectivesWithNoUpperTimeBound, ecQuotient->matrix,
                       ecQuotient->rowsWithSumLessOne, ecQuotient->auxChoiceValues);
     if (solver->hasLowerBound()) {
         req.clearLowerBounds();
@@ -452,11 +462,37 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
     solver->setRequirementsChecked(true);
 
-    // Use the (0...0) vector as initial guess for the solution.
-    std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    if (hasWarmStartValues) {
+        // The scheduler obtained in the most recent call of check(..) induces the objective results of that call.
+        // We use the value of this scheduler w.r.t. the current weight vector as initial guess for the solution.
+        std::vector<ValueType> weightedSchedulerValues(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+        for (auto objIndex : modelData->objectivesWithNoUpperTimeBound) {
+            STORM_LOG_ASSERT(objectiveResults[objIndex].size() == weightedSchedulerValues.size(), "Unexpected size of objective result.");
+            if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                storm::utility::vector::addScaledVector(weightedSchedulerValues, objectiveResults[objIndex], -weightVector[objIndex]);
+            } else {
+                storm::utility::vector::addScaledVector(weightedSchedulerValues, objectiveResults[objIndex], weightVector[objIndex]);
+            }
+        }
+        // For the states of an eliminated end component, we take the maximal value within the end component.
+        for (uint64_t ecqState = 0; ecqState < ecQuotient->auxStateValues.size(); ++ecqState) {
+            auto const& origStates = ecQuotient->ecqToOriginalStateMapping[ecqState];
+            STORM_LOG_ASSERT(!origStates.empty(), "Unexpected empty set of original states.");
+            auto& ecqValue = ecQuotient->auxStateValues[ecqState];
+            ecqValue = weightedSchedulerValues[*origStates.begin()];
+            for (auto const& origState : origStates) {
+                ecqValue = std::max(ecqValue, weightedSchedulerValues[origState]);
+            }
+        }
+        // The objective results will be overwritten in this check.
+        hasWarmStartValues = false;
+    } else {
+        // Use the (0...0) vector as initial guess for the solution.
+        std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    }
 
     solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
-    this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
+    this->weightedResult = std::vector<ValueType>(modelData->transitionMatrix.getRowGroupCount());
 
     transformEcqSolutionToOriginalModel(ecQuotient->auxStateValues, solver->getSchedulerChoices(), ecqStateToOptimalMecMap, this->weightedResult,
                                         this->optimalChoices);
@@ -464,19 +500,20 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
 
 template<class SparseModelType>
 void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(Environment const& env, std::vector<ValueType> const& weightVector) {
-    if (objectivesWithNoUpperTimeBound.getNumberOfSetBits() == 1 && storm::utility::isOne(weightVector[*objectivesWithNoUpperTimeBound.begin()])) {
-        uint_fast64_t objIndex = *objectivesWithNoUpperTimeBound.begin();
+    if (modelData->objectivesWithNoUpperTimeBound.getNumberOfSetBits() == 1 &&
+        storm::utility::isOne(weightVector[*modelData->objectivesWithNoUpperTimeBound.begin()])) {
+        uint_fast64_t objIndex = *modelData->objectivesWithNoUpperTimeBound.begin();
         objectiveResults[objIndex] = weightedResult;
         if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
             storm::utility::vector::scaleVectorInPlace(objectiveResults[objIndex], -storm::utility::one<ValueType>());
         }
         for (uint_fast64_t objIndex2 = 0; objIndex2 < this->objectives.size(); ++objIndex2) {
             if (objIndex != objIndex2) {
-                objectiveResults[objIndex2] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                objectiveResults[objIndex2] = std::vector<ValueType>(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
             }
         }
     } else {
-        storm::storage::SparseMatrix<ValueType> deterministicMatrix = transitionMatrix.selectRowsFromRowGroups(this->optimalChoices, false);
+        storm::storage::SparseMatrix<ValueType> deterministicMatrix = modelData->transitionMatrix.selectRowsFromRowGroups(this->optimalChoices, false);
         storm::storage::SparseMatrix<ValueType> deterministicBackwardTransitions = deterministicMatrix.transpose();
         std::vector<ValueType> deterministicStateRewards(deterministicMatrix.getRowCount());  // allocate here
         storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
@@ -487,27 +524,41 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
         // We compute an estimate for the results of the individual objectives which is obtained from the weighted result and the result of the objectives
         // computed so far. Note that weightedResult = Sum_{i=1}^{n} w_i * objectiveResult_i.
         std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
-        ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
+        ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, modelData->objectivesWithNoUpperTimeBound);
+
+        // If the equation systems are solved using value iteration anyway, the total reward objectives are all considered at once.
+        storm::storage::BitVector interleavedObjectives(this->objectives.size(), false);
+        if (!storm::NumberTraits<ValueType>::IsExact && storm::solver::helper::isInterleavedValueIterationApplicable(env)) {
+            interleavedObjectives = modelData->objectivesWithNoUpperTimeBound & ~modelData->lraObjectives;
+            if (interleavedObjectives.getNumberOfSetBits() > 1) {
+                unboundedIndividualPhaseInterleaved(env, deterministicMatrix, deterministicBackwardTransitions, interleavedObjectives, weightVector,
+                                                    weightedSumOfUncheckedObjectives, sumOfWeightsOfUncheckedObjectives);
+            } else {
+                interleavedObjectives.clear();
+            }
+        }
 
         for (uint_fast64_t const& objIndex : storm::utility::vector::getSortedIndices(weightVector)) {
             auto const& obj = this->objectives[objIndex];
-            if (objectivesWithNoUpperTimeBound.get(objIndex)) {
+            if (modelData->objectivesWithNoUpperTimeBound.get(objIndex)) {
                 offsetsToUnderApproximation[objIndex] = storm::utility::zero<ValueType>();
                 offsetsToOverApproximation[objIndex] = storm::utility::zero<ValueType>();
-                if (lraObjectives.get(objIndex)) {
+                if (modelData->lraObjectives.get(objIndex)) {
                     auto actionValueGetter = [&](uint64_t const& a) {
-                        return actionRewards[objIndex][transitionMatrix.getRowGroupIndices()[a] + this->optimalChoices[a]];
+                        return modelData->actionRewards[objIndex][modelData->transitionMatrix.getRowGroupIndices()[a] + this->optimalChoices[a]];
                     };
                     typename storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType>::ValueGetter stateValueGetter;
-                    if (stateRewards.empty() || stateRewards[objIndex].empty()) {
+                    if (modelData->stateRewards.empty() || modelData->stateRewards[objIndex].empty()) {
                         stateValueGetter = [](uint64_t const&) { return storm::utility::zero<ValueType>(); };
                     } else {
-                        stateValueGetter = [&](uint64_t const& s) { return stateRewards[objIndex][s]; };
+                        stateValueGetter = [&](uint64_t const& s) { return modelData->stateRewards[objIndex][s]; };
                     }
                     objectiveResults[objIndex] = infiniteHorizonHelper.computeLongRunAverageValues(env, stateValueGetter, actionValueGetter);
+                } else if (interleavedObjectives.get(objIndex)) {
+                    // The result has already been computed
                 } else {  // i.e. a total reward objective
-                    storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(),
-                                                               actionRewards[objIndex]);
+                    storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices,
+                                                               modelData->transitionMatrix.getRowGroupIndices(), modelData->actionRewards[objIndex]);
                     storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
                     // As maybestates we pick the states from which a state with reward is reachable
                     storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(
@@ -524,7 +575,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                         storm::utility::vector::clip(objectiveResults[objIndex], obj.lowerResultBound, obj.upperResultBound);
                     }
                     // Make sure that the objectiveResult is initialized correctly
-                    objectiveResults[objIndex].resize(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                    objectiveResults[objIndex].resize(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
 
                     if (!maybeStates.empty()) {
                         bool needEquationSystem =
@@ -568,22 +619,93 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                     sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
                 }
             } else {
-                objectiveResults[objIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                objectiveResults[objIndex] = std::vector<ValueType>(modelData->transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
             }
         }
     }
 }
 
+template<class SparseModelType>
+void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhaseInterleaved(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+    storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions, storm::storage::BitVector const& totalRewardObjectives,
+    std::vector<ValueType> const& weightVector, std::vector<ValueType> const& weightedSumOfUncheckedObjectives,
+    ValueType const& sumOfWeightsOfUncheckedObjectives) {
+    uint64_t const numberOfStates = deterministicMatrix.getRowCount();
+    uint64_t const numberOfObjectives = totalRewardObjectives.getNumberOfSetBits();
+
+    // As maybestates we pick the states from which a state with reward is reachable for at least one objective.
+    // For each objective, the remaining maybestates can only reach states without reward (of that objective) and thus keep the initial value zero.
+    std::vector<std::vector<ValueType>> deterministicStateRewards;
+    deterministicStateRewards.reserve(numberOfObjectives);
+    std::vector<storm::storage::BitVector> objectiveMaybeStates;
+    objectiveMaybeStates.reserve(numberOfObjectives);
+    storm::storage::BitVector maybeStates(numberOfStates, false);
+    for (auto objIndex : totalRewardObjectives) {
+        auto& objectiveStateRewards = deterministicStateRewards.emplace_back(numberOfStates);
+        storm::utility::vector::selectVectorValues(objectiveStateRewards, this->optimalChoices, modelData->transitionMatrix.getRowGroupIndices(),
+                                                   modelData->actionRewards[objIndex]);
+        storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(objectiveStateRewards);
+        maybeStates |= objectiveMaybeStates.emplace_back(storm::utility::graph::performProbGreater0(
+            deterministicBackwardTransitions, storm::storage::BitVector(numberOfStates, true), statesWithRewards));
+    }
+    for (auto objIndex : totalRewardObjectives) {
+        objectiveResults[objIndex].assign(numberOfStates, storm::utility::zero<ValueType>());
+    }
+    if (maybeStates.empty()) {
+        return;
+    }
+
+    // Prepare the interleaved solution vector and rhs of the equation systems.
+    // As for a single objective, the solution vector is initialized with an estimate that is obtained from the weighted result.
+    uint64_t const numberOfMaybeStates = maybeStates.getNumberOfSetBits();
+    std::vector<ValueType> x(numberOfMaybeStates * numberOfObjectives, storm::utility::zero<ValueType>());
+    std::vector<ValueType> b(numberOfMaybeStates * numberOfObjectives);
+    uint64_t lane = 0;
+    for (auto objIndex : totalRewardObjectives) {
+        storm::utility::vector::setVectorValuesInterleaved(b, storm::utility::vector::filterVector(deterministicStateRewards[lane], maybeStates), lane,
+                                                           numberOfObjectives);
+        if (!storm::utility::isZero(weightVector[objIndex])) {
+            auto const& obj = this->objectives[objIndex];
+            std::vector<ValueType> estimate = weightedSumOfUncheckedObjectives;
+            ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsOfUncheckedObjectives;
+            if (storm::solver::minimize(obj.formula->getOptimalityType())) {
+                scalingFactor *= -storm::utility::one<ValueType>();
+            }
+            storm::utility::vector::scaleVectorInPlace(estimate, scalingFactor);
+            storm::utility::vector::clip(estimate, obj.lowerResultBound, obj.upperResultBound);
+            // States that can not reach a state with reward (of this objective) have value zero.
+            storm::utility::vector::setVectorValues<ValueType>(estimate, ~objectiveMaybeStates[lane], storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValuesInterleaved(x, storm::utility::vector::filterVector(estimate, maybeStates), lane, numberOfObjectives);
+        }
+        ++lane;
+    }
+
+    // Now solve the equation systems.
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<ValueType, true>>();
+    viOperator->setMatrixBackwards(deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, false));
+    storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
+    viHelper.interleavedVI(env, x, b, numberOfObjectives);
+
+    // Set the results accordingly
+    std::vector<ValueType> objectiveX(numberOfMaybeStates);
+    lane = 0;
+    for (auto objIndex : totalRewardObjectives) {
+        storm::utility::vector::getVectorValuesInterleaved(objectiveX, x, lane++, numberOfObjectives);
+        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, objectiveX);
+    }
+}
+
 template<class SparseModelType>
 void StandardPcaaWeightVectorChecker<SparseModelType>::updateEcQuotient(std::vector<ValueType> const& weightedRewardVector) {
     // Check whether we need to update the currently cached ecElimResult
     storm::storage::BitVector newTotalReward0Choices = storm::utility::vector::filterZero(weightedRewardVector);
     storm::storage::BitVector zeroLraRewardChoices(weightedRewardVector.size(), true);
     if (lraMecDecomposition) {
-        for (uint64_t mecIndex = 0; mecIndex < lraMecDecomposition->mecs.size(); ++mecIndex) {
+        for (uint64_t mecIndex = 0; mecIndex < modelData->lraMecs.size(); ++mecIndex) {
             if (!storm::utility::isZero(lraMecDecomposition->auxMecValues[mecIndex])) {
                 // The mec has a non-zero value, so flag all its choices as non-zero
-                auto const& mec = lraMecDecomposition->mecs[mecIndex];
+                auto const& mec = modelData->lraMecs[mecIndex];
                 for (auto const& stateChoices : mec) {
                     for (auto const& choice : stateChoices.second) {
                         zeroLraRewardChoices.set(choice, false);
@@ -595,22 +717,23 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::updateEcQuotient(std::vec
     storm::storage::BitVector newReward0Choices = newTotalReward0Choices & zeroLraRewardChoices;
     if (!ecQuotient || ecQuotient->origReward0Choices != newReward0Choices) {
         // It is sufficient to consider the states from which a transition with non-zero reward is reachable. (The remaining states always have reward zero).
-        auto nonZeroRewardStates = transitionMatrix.getRowGroupFilter(newReward0Choices, true);
+        auto nonZeroRewardStates = modelData->transitionMatrix.getRowGroupFilter(newReward0Choices, true);
         nonZeroRewardStates.complement();
         storm::storage::BitVector subsystemStates = storm::utility::graph::performProbGreater0E(
-            transitionMatrix.transpose(true), storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), nonZeroRewardStates);
+            modelData->transitionMatrix.transpose(true), storm::storage::BitVector(modelData->transitionMatrix.getRowGroupCount(), true), nonZeroRewardStates);
 
         // Remove neutral end components, i.e., ECs in which no total reward is earned.
         // Note that such ECs contain one (or maybe more) LRA ECs.
-        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(transitionMatrix, subsystemStates,
-                                                                                             ecChoicesHint & newTotalReward0Choices, totalReward0EStates);
+        auto ecElimResult =
+            storm::transformer::EndComponentEliminator<ValueType>::transform(modelData->transitionMatrix, subsystemStates,
+                                                                             modelData->ecChoicesHint & newTotalReward0Choices, modelData->totalReward0EStates);
 
         storm::storage::BitVector rowsWithSumLessOne(ecElimResult.matrix.getRowCount(), false);
         for (uint64_t row = 0; row < rowsWithSumLessOne.size(); ++row) {
             if (ecElimResult.matrix.getRow(row).getNumberOfEntries() == 0) {
                 rowsWithSumLessOne.set(row, true);
             } else {
-                for (auto const& entry : transitionMatrix.getRow(ecElimResult.newToOldRowMapping[row])) {
+                for (auto const& entry : modelData->transitionMatrix.getRow(ecElimResult.newToOldRowMapping[row])) {
                     if (!subsystemStates.get(entry.getColumn())) {
                         rowsWithSumLessOne.set(row, true);
                         break;
@@ -666,9 +789,9 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::setBoundsToSolver(storm::
                                                                          storm::storage::BitVector const& rowsWithSumLessOne,
                                                                          std::vector<ValueType> const& rewards) const {
     // Check whether bounds are already available
-    boost::optional<ValueType> lowerBound = this->computeWeightedResultBound(true, weightVector, objectiveFilter & ~lraObjectives);
+    boost::optional<ValueType> lowerBound = this->computeWeightedResultBound(true, weightVector, objectiveFilter & ~modelData->lraObjectives);
     if (lowerBound) {
-        if (!lraObjectives.empty()) {
+        if (!modelData->lraObjectives.empty()) {
             auto min = std::min_element(lraMecDecomposition->auxMecValues.begin(), lraMecDecomposition->auxMecValues.end());
             if (min != lraMecDecomposition->auxMecValues.end()) {
                 lowerBound.get() += *min;
@@ -678,7 +801,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::setBoundsToSolver(storm::
     }
     boost::optional<ValueType> upperBound = this->computeWeightedResultBound(false, weightVector, objectiveFilter);
     if (upperBound) {
-        if (!lraObjectives.empty()) {
+        if (!modelData->lraObjectives.empty()) {
             auto max = std::max_element(lraMecDecomposition->auxMecValues.begin(), lraMecDecomposition->auxMecValues.end());
             if (max != lraMecDecomposition->auxMecValues.end()) {
                 upperBound.get() += *max;
@@ -756,15 +879,15 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
                                                                                            std::map<uint64_t, uint64_t> const& ecqStateToOptimalMecMap,
                                                                                            std::vector<ValueType>& originalSolution,
                                                                                            std::vector<uint_fast64_t>& originalOptimalChoices) const {
-    auto backwardsTransitions = transitionMatrix.transpose(true);
+    auto backwardsTransitions = modelData->transitionMatrix.transpose(true);
 
     // Keep track of states for which no choice has been set yet.
-    storm::storage::BitVector unprocessedStates(transitionMatrix.getRowGroupCount(), true);
+    storm::storage::BitVector unprocessedStates(modelData->transitionMatrix.getRowGroupCount(), true);
 
     // For each eliminated ec, keep track of the states (within the ec) that we want to reach and the states for which a choice needs to be set
     // (Declared already at this point to avoid expensive allocations in each loop iteration)
-    storm::storage::BitVector ecStatesToReach(transitionMatrix.getRowGroupCount(), false);
-    storm::storage::BitVector ecStatesToProcess(transitionMatrix.getRowGroupCount(), false);
+    storm::storage::BitVector ecStatesToReach(modelData->transitionMatrix.getRowGroupCount(), false);
+    storm::storage::BitVector ecStatesToProcess(modelData->transitionMatrix.getRowGroupCount(), false);
 
     // Run through each state of the ec quotient as well as the associated state(s) of the original model
     for (uint64_t ecqState = 0; ecqState < ecqSolution.size(); ++ecqState) {
@@ -779,7 +902,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
                 // The current ecqState represents an elimnated EC and we need to stay in this EC and we need to make sure that optimal MEC decisions are
                 // performed within this EC.
                 STORM_LOG_ASSERT(ecqStateToOptimalMecMap.count(ecqState) > 0, "No Lra Mec associated to given eliminated EC");
-                auto const& lraMec = lraMecDecomposition->mecs[ecqStateToOptimalMecMap.at(ecqState)];
+                auto const& lraMec = modelData->lraMecs[ecqStateToOptimalMecMap.at(ecqState)];
                 if (lraMec.size() == origStates.size()) {
                     // LRA mec and eliminated EC coincide
                     for (auto const& state : origStates) {
@@ -803,7 +926,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
                         unprocessedStates.set(state, false);
                         originalSolution[state] = ecqSolution[ecqState];
                     }
-                    computeSchedulerProb1(transitionMatrix, backwardsTransitions, ecStatesToProcess, ecStatesToReach, originalOptimalChoices,
+                    computeSchedulerProb1(modelData->transitionMatrix, backwardsTransitions, ecStatesToProcess, ecStatesToReach, originalOptimalChoices,
                                           &ecQuotient->origTotalReward0Choices);
                     // Clear bitvectors for next ecqState.
                     ecStatesToProcess.clear();
@@ -820,11 +943,11 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
                     originalSolution[state] = storm::utility::zero<ValueType>();  // i.e. ecqSolution[ecqState];
                     ecStatesToProcess.set(state, true);
                 }
-                auto validChoices = transitionMatrix.getRowFilter(ecStatesToProcess, ecStatesToProcess);
-                auto valid0RewardChoices = validChoices & actionsWithoutRewardInUnboundedPhase;
+                auto validChoices = modelData->transitionMatrix.getRowFilter(ecStatesToProcess, ecStatesToProcess);
+                auto valid0RewardChoices = validChoices & modelData->actionsWithoutRewardInUnboundedPhase;
                 for (auto const& state : origStates) {
-                    auto groupStart = transitionMatrix.getRowGroupIndices()[state];
-                    auto groupEnd = transitionMatrix.getRowGroupIndices()[state + 1];
+                    auto groupStart = modelData->transitionMatrix.getRowGroupIndices()[state];
+                    auto groupEnd = modelData->transitionMatrix.getRowGroupIndices()[state + 1];
                     auto nextValidChoice = valid0RewardChoices.getNextSetIndex(groupStart);
                     if (nextValidChoice < groupEnd) {
                         originalOptimalChoices[state] = nextValidChoice - groupStart;
@@ -837,15 +960,15 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
                 if (needSchedulerComputation) {
                     // There are ec states which we should not visit infinitely often
                     auto ecStatesThatCanAvoid =
-                        storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardsTransitions,
-                                                                    ecStatesToProcess, ecStatesToAvoid, false, 0, valid0RewardChoices);
+                        storm::utility::graph::performProbGreater0A(modelData->transitionMatrix, modelData->transitionMatrix.getRowGroupIndices(),
+                                                                    backwardsTransitions, ecStatesToProcess, ecStatesToAvoid, false, 0, valid0RewardChoices);
                     ecStatesThatCanAvoid.complement();
                     // Set the choice for all states that can achieve value 0
-                    computeSchedulerProb0(transitionMatrix, backwardsTransitions, ecStatesThatCanAvoid, ecStatesToAvoid, valid0RewardChoices,
+                    computeSchedulerProb0(modelData->transitionMatrix, backwardsTransitions, ecStatesThatCanAvoid, ecStatesToAvoid, valid0RewardChoices,
                                           originalOptimalChoices);
                     // Set the choice for all remaining states
-                    computeSchedulerProb1(transitionMatrix, backwardsTransitions, ecStatesToProcess & ~ecStatesToAvoid, ecStatesToAvoid, originalOptimalChoices,
-                                          &validChoices);
+                    computeSchedulerProb1(modelData->transitionMatrix, backwardsTransitions, ecStatesToProcess & ~ecStatesToAvoid, ecStatesToAvoid,
+                                          originalOptimalChoices, &validChoices);
                 }
                 ecStatesToAvoid.clear();
                 ecStatesToProcess.clear();
@@ -857,8 +980,8 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
             if (origStates.size() > 1) {
                 for (auto const& state : origStates) {
                     // Check if the orig choice originates from this state
-                    auto groupStart = transitionMatrix.getRowGroupIndices()[state];
-                    auto groupEnd = transitionMatrix.getRowGroupIndices()[state + 1];
+                    auto groupStart = modelData->transitionMatrix.getRowGroupIndices()[state];
+                    auto groupEnd = modelData->transitionMatrix.getRowGroupIndices()[state + 1];
                     if (origChoice >= groupStart && origChoice < groupEnd) {
                         originalOptimalChoices[state] = origChoice - groupStart;
                         ecStatesToReach.set(state, true);
@@ -869,18 +992,20 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
                     unprocessedStates.set(state, false);
                     originalSolution[state] = ecqSolution[ecqState];
                 }
-                auto validChoices = transitionMatrix.getRowFilter(ecStatesToProcess, ecStatesToProcess | ecStatesToReach);
-                computeSchedulerProb1(transitionMatrix, backwardsTransitions, ecStatesToProcess, ecStatesToReach, originalOptimalChoices, &validChoices);
+                auto validChoices = modelData->transitionMatrix.getRowFilter(ecStatesToProcess, ecStatesToProcess | ecStatesToReach);
+                computeSchedulerProb1(modelData->transitionMatrix, backwardsTransitions, ecStatesToProcess, ecStatesToReach, originalOptimalChoices,
+                                      &validChoices);
                 // Clear bitvectors for next ecqState.
                 ecStatesToProcess.clear();
                 ecStatesToReach.clear();
             } else {
                 // There is just one state so we take the associated choice.
                 auto state = *origStates.begin();
-                auto groupStart = transitionMatrix.getRowGroupIndices()[state];
+                auto groupStart = modelData->transitionMatrix.getRowGroupIndices()[state];
                 STORM_LOG_ASSERT(
-                    origChoice >= groupStart && origChoice < transitionMatrix.getRowGroupIndices()[state + 1],
-                    "Invalid choice: " << originalOptimalChoices[state] << " at a state with " << transitionMatrix.getRowGroupSize(state) << " choices.");
+                    origChoice >= groupStart && origChoice < modelData->transitionMatrix.getRowGroupIndices()[state + 1],
+                    "Invalid choice: " << originalOptimalChoices[state] << " at a state with " << modelData->transitionMatrix.getRowGroupSize(state)
+                                       << " choices.");
                 originalOptimalChoices[state] = origChoice - groupStart;
                 originalSolution[state] = ecqSolution[ecqState];
                 unprocessedStates.set(state, false);
@@ -894,7 +1019,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
     // Get a set of states for which we know that no reward (for all objectives) will be collected
     if (this->lraMecDecomposition) {
         // In this case, all unprocessed non-lra mec states should reach an (unprocessed) lra mec
-        for (auto const& mec : this->lraMecDecomposition->mecs) {
+        for (auto const& mec : modelData->lraMecs) {
             for (auto const& sc : mec) {
                 if (unprocessedStates.get(sc.first)) {
                     ecStatesToReach.set(sc.first, true);
@@ -902,14 +1027,14 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::transformEcqSolutionToOri
             }
         }
     } else {
-        ecStatesToReach = unprocessedStates & totalReward0EStates;
+        ecStatesToReach = unprocessedStates & modelData->totalReward0EStates;
         // Set a scheduler for the ecStates that we want to reach
-        computeSchedulerProb0(transitionMatrix, backwardsTransitions, ecStatesToReach, ~unprocessedStates | ~totalReward0EStates,
-                              actionsWithoutRewardInUnboundedPhase, originalOptimalChoices);
+        computeSchedulerProb0(modelData->transitionMatrix, backwardsTransitions, ecStatesToReach, ~unprocessedStates | ~modelData->totalReward0EStates,
+                              modelData->actionsWithoutRewardInUnboundedPhase, originalOptimalChoices);
     }
     unprocessedStates &= ~ecStatesToReach;
     // Set a scheduler for the remaining states
-    computeSchedulerProb1(transitionMatrix, backwardsTransitions, unprocessedStates, ecStatesToReach, originalOptimalChoices);
+    computeSchedulerProb1(modelData->transitionMatrix, backwardsTransitions, unprocessedStates, ecStatesToReach, originalOptimalChoices);
 }
 
 template class StandardPcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "storm/modelchecker/helper/infinitehorizon/SparseDeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/multiobjective/Objective.h"
@@ -68,8 +70,35 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
     virtual storm::storage::Scheduler<ValueType> computeScheduler() const override;
 
    protected:
+    // Data regarding the given model. It is not changed by checks and thus shared among the clones of a checker.
+    struct ModelData {
+        // The transition matrix of the considered model
+        storm::storage::SparseMatrix<ValueType> transitionMatrix;
+        // The initial state of the considered model
+        uint64_t initialState;
+        // Overapproximation of the set of choices that are part of an end component.
+        storm::storage::BitVector ecChoicesHint;
+        // The actions that have reward assigned for at least one objective without upper timeBound
+        storm::storage::BitVector actionsWithoutRewardInUnboundedPhase;
+        // The states for which there is a scheduler yielding reward 0 for each total reward objective
+        storm::storage::BitVector totalReward0EStates;
+        // stores the state action rewards for each objective.
+        std::vector<std::vector<ValueType>> actionRewards;
+        // stores the state rewards for each objective.
+        // These are only relevant for LRA objectives for MAs (otherwise, they appear within the action rewards). For other objectives/models, the
+        // corresponding vector will be empty.
+        std::vector<std::vector<ValueType>> stateRewards;
+
+        // stores the indices of the objectives for which we need to compute the long run average values
+        storm::storage::BitVector lraObjectives;
+        // stores the indices of the objectives for which there is no upper time bound
+        storm::storage::BitVector objectivesWithNoUpperTimeBound;
+        // The end components that are relevant for the LRA objectives (empty if there are none).
+        storm::storage::MaximalEndComponentDecomposition<ValueType> lraMecs;
+    };
+
     void initialize(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult);
-    virtual void initializeModelTypeSpecificData(SparseModelType const& model) = 0;
+    virtual void initializeModelTypeSpecificData(SparseModelType const& model, ModelData& data) = 0;
     virtual storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> createNondetInfiniteHorizonHelper(
         storm::storage::SparseMatrix<ValueType> const& transitions) const = 0;
     virtual DeterministicInfiniteHorizonHelperType createDetInfiniteHorizonHelper(storm::storage::SparseMatrix<ValueType> const& transitions) const = 0;
@@ -90,6 +119,23 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
      */
     void unboundedIndividualPhase(Environment const& env, std::vector<ValueType> const& weightVector);
 
+    /*!
+     * Computes the values of the given total reward objectives w.r.t. the scheduler computed in the unboundedWeightedPhase.
+     * All objectives are considered at once, i.e., the matrix is only traversed once per value iteration step.
+     *
+     * @param deterministicMatrix the transition matrix induced by the optimal choices
+     * @param deterministicBackwardTransitions the backward transitions of the deterministic matrix
+     * @param totalRewardObjectives the (total reward) objectives to check
+     * @param weightVector the weight vector of the current check
+     * @param weightedSumOfUncheckedObjectives the weighted sum of the results of all objectives that are not checked, yet
+     * @param sumOfWeightsOfUncheckedObjectives the sum of the weights of all objectives that are not checked, yet
+     */
+    void unboundedIndividualPhaseInterleaved(Environment const& env, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+                                             storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions,
+                                             storm::storage::BitVector const& totalRewardObjectives, std::vector<ValueType> const& weightVector,
+                                             std::vector<ValueType> const& weightedSumOfUncheckedObjectives,
+                                             ValueType const& sumOfWeightsOfUncheckedObjectives);
+
     /*!
      * For each time epoch (starting with the maximal stepBound occurring in the objectives), this method
      * - determines the objectives that are relevant in the current time epoch
@@ -121,32 +167,15 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
                                              std::map<uint64_t, uint64_t> const& ecqStateToOptimalMecMap, std::vector<ValueType>& originalSolution,
                                              std::vector<uint_fast64_t>& originalOptimalChoices) const;
 
-    // Data regarding the given model
-    // The transition matrix of the considered model
-    storm::storage::SparseMatrix<ValueType> transitionMatrix;
-    // The initial state of the considered model
-    uint64_t initialState;
-    // Overapproximation of the set of choices that are part of an end component.
-    storm::storage::BitVector ecChoicesHint;
-    // The actions that have reward assigned for at least one objective without upper timeBound
-    storm::storage::BitVector actionsWithoutRewardInUnboundedPhase;
-    // The states for which there is a scheduler yielding reward 0 for each total reward objective
-    storm::storage::BitVector totalReward0EStates;
-    // stores the state action rewards for each objective.
-    std::vector<std::vector<ValueType>> actionRewards;
-    // stores the state rewards for each objective.
-    // These are only relevant for LRA objectives for MAs (otherwise, they appear within the action rewards). For other objectives/models, the corresponding
-    // vector will be empty.
-    std::vector<std::vector<ValueType>> stateRewards;
-
-    // stores the indices of the objectives for which we need to compute the long run average values
-    storm::storage::BitVector lraObjectives;
-    // stores the indices of the objectives for which there is no upper time bound
-    storm::storage::BitVector objectivesWithNoUpperTimeBound;
+    // The data regarding the given model (shared among the clones of this checker)
+    std::shared_ptr<ModelData const> modelData;
 
     // Memory for the solution of the most recent call of check(..)
     // becomes true after the first call of check(..)
     bool checkHasBeenCalled;
+    // True if the objective results of the most recent call of check(..) are the values induced by the current optimal choices.
+    // In this case, they are used to compute an initial guess for the next call of check(..).
+    bool hasWarmStartValues;
     // The result for the weighted reward vector (for all states of the model)
     std::vector<ValueType> weightedResult;
     // The results for the individual objectives (w.r.t. all states of the model)
@@ -174,7 +203,7 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
     boost::optional<EcQuotient> ecQuotient;
 
     struct LraMecDecomposition {
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs;
+        // The values of the end components in modelData->lraMecs
         std::vector<ValueType> auxMecValues;
     };
     boost::optional<LraMecDecomposition> lraMecDecomposition;
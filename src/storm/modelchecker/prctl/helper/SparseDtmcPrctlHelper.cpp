@@ -10,6 +10,7 @@
 #include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
 #include "storm/storage/DynamicPriorityQueue.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/sparse/AnalysisCache.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
@@ -19,6 +20,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -31,6 +33,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/macros.h"
@@ -88,13 +91,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto addCdfEntry = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -106,10 +103,39 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
             cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
             cdfData.push_back(std::move(cdfEntry));
         }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    };
+    uint64_t numberOfThreads = rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::getNumberOfEpochAnalysisThreads(
+        env.modelchecker().getNumberOfThreads());
+    if (numberOfThreads > 1) {
+        // Each thread keeps the solver for the epoch matrix of its own workspace, which is reused while the thread stays in the same epoch class.
+        std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> threadLinEqSolvers(numberOfThreads);
+        swCheck.start();
+        rewardUnfolding.analyzeEpochsInParallel(
+            epochOrder, numberOfThreads,
+            [&](auto& epochModel, auto const&, uint64_t thread) {
+                return epochModel.analyzeSingleObjective(preciseEnv, threadX[thread], threadB[thread], threadLinEqSolvers[thread], lowerBound, upperBound);
+            },
+            [&](auto const& epoch) {
+                addCdfEntry(epoch);
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+            });
+        swCheck.stop();
+    } else {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            addCdfEntry(epoch);
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
         }
     }
 
@@ -176,10 +202,12 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
                                          << " states remaining).");
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
-        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
-        storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
-        statesWithProbability1 = std::move(statesWithProbability01.second);
+        // As these sets only depend on the graph of the model, they are shared between properties with the same phi and psi states.
+        auto statesWithProbability01 = storm::storage::sparse::AnalysisCache::instance().getOrComputeStateSets(
+            storm::storage::sparse::AnalysisCache::Key(&transitionMatrix, "prob01", {phiStates, psiStates}),
+            [&]() { return storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates); });
+        storm::storage::BitVector statesWithProbability0 = statesWithProbability01->first;
+        statesWithProbability1 = statesWithProbability01->second;
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
 
         STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
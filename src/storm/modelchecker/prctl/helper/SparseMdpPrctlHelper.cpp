@@ -21,6 +21,7 @@
 #include "storm/storage/Scheduler.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/Variable.h"
+#include "storm/storage/sparse/AnalysisCache.h"
 
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
@@ -37,9 +38,11 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -87,13 +90,7 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         progress.setMaxCount(epochOrder.size());
         progress.startNewMeasurement(0);
         uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
-            swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-            swCheck.stop();
+        auto addCdfEntry = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
             if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
                 !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                 std::vector<ValueType> cdfEntry;
@@ -105,10 +102,40 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
                 cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
                 cdfData.push_back(std::move(cdfEntry));
             }
-            ++numCheckedEpochs;
-            progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
+        };
+        uint64_t numberOfThreads = rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::getNumberOfEpochAnalysisThreads(
+            env.modelchecker().getNumberOfThreads());
+        if (numberOfThreads > 1) {
+            // Each thread keeps its own min-max solver, as the solver is bound to the epoch matrix and the scheduler of the thread's previous epoch.
+            std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+            std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> threadMinMaxSolvers(numberOfThreads);
+            swCheck.start();
+            rewardUnfolding.analyzeEpochsInParallel(
+                epochOrder, numberOfThreads,
+                [&](auto& epochModel, auto const&, uint64_t thread) {
+                    return epochModel.analyzeSingleObjective(preciseEnv, dir, threadX[thread], threadB[thread], threadMinMaxSolvers[thread], lowerBound,
+                                                             upperBound);
+                },
+                [&](auto const& epoch) {
+                    addCdfEntry(epoch);
+                    ++numCheckedEpochs;
+                    progress.updateProgress(numCheckedEpochs);
+                });
+            swCheck.stop();
+        } else {
+            for (auto const& epoch : epochOrder) {
+                swBuild.start();
+                auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                swBuild.stop();
+                swCheck.start();
+                rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+                swCheck.stop();
+                addCdfEntry(epoch);
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+                if (storm::utility::resources::isTerminate()) {
+                    break;
+                }
             }
         }
 
@@ -529,16 +556,20 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
-    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
-    } else {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
-    }
-    result.statesWithProbability0 = std::move(statesWithProbability01.first);
-    result.statesWithProbability1 = std::move(statesWithProbability01.second);
+    // As these sets only depend on the graph of the model, they are shared between properties with the same phi and psi states.
+    bool minimize = goal.minimize();
+    auto statesWithProbability01 = storm::storage::sparse::AnalysisCache::instance().getOrComputeStateSets(
+        storm::storage::sparse::AnalysisCache::Key(&transitionMatrix, minimize ? "prob01min" : "prob01max", {phiStates, psiStates}), [&]() {
+            if (minimize) {
+                return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates,
+                                                               psiStates);
+            } else {
+                return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates,
+                                                               psiStates);
+            }
+        });
+    result.statesWithProbability0 = statesWithProbability01->first;
+    result.statesWithProbability1 = statesWithProbability01->second;
     result.maybeStates = ~(result.statesWithProbability0 | result.statesWithProbability1);
 
     return result;
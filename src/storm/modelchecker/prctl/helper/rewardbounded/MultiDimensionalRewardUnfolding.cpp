@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
 #include <functional>
 #include <set>
 #include <string>
@@ -17,6 +18,7 @@
 #include "storm/storage/expressions/Expressions.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -397,13 +399,84 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<uint64_t>> MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochDependencies(
+    std::vector<Epoch> const& epochOrder) const {
+    std::map<Epoch, uint64_t> epochToPositionMap;
+    for (uint64_t position = 0; position < epochOrder.size(); ++position) {
+        epochToPositionMap.emplace(epochOrder[position], position);
+    }
+    std::vector<std::vector<uint64_t>> dependencies(epochOrder.size());
+    for (uint64_t position = 0; position < epochOrder.size(); ++position) {
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epochOrder[position], step);
+            if (successorEpoch != epochOrder[position]) {
+                auto successorIt = epochToPositionMap.find(successorEpoch);
+                if (successorIt != epochToPositionMap.end()) {
+                    STORM_LOG_ASSERT(successorIt->second < position, "Epoch order is not consistent with the epoch dependencies.");
+                    dependencies[position].push_back(successorIt->second);
+                }
+            }
+        }
+        std::sort(dependencies[position].begin(), dependencies[position].end());
+        dependencies[position].erase(std::unique(dependencies[position].begin(), dependencies[position].end()), dependencies[position].end());
+    }
+    return dependencies;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getNumberOfEpochAnalysisThreads(uint64_t requestedNumberOfThreads) {
+    if constexpr (storm::utility::parallel::isThreadSafeValueType<ValueType>) {
+        return storm::utility::parallel::getNumberOfThreads(requestedNumberOfThreads);
+    } else {
+        STORM_LOG_INFO_COND(requestedNumberOfThreads == 1, "Epochs are analyzed sequentially as the value type does not support concurrent computations.");
+        return 1;
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+bool MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochsInParallel(
+    std::vector<Epoch> const& epochOrder, uint64_t numberOfThreads,
+    std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, Epoch const&, uint64_t)> const& analyzeEpoch,
+    std::function<void(Epoch const&)> const& epochSolvedCallback) {
+    STORM_LOG_ASSERT(storm::utility::parallel::isThreadSafeValueType<ValueType>, "Epochs with this value type can not be analyzed concurrently.");
+    numberOfThreads = storm::utility::parallel::getNumberOfThreads(numberOfThreads);
+    STORM_LOG_INFO("Analyzing " << epochOrder.size() << " epochs using " << numberOfThreads << " threads.");
+
+    // Each thread gets its own workspace. Epoch models of the same epoch class share the same matrix, so keeping workspaces alive across epochs
+    // avoids rebuilding the matrix whenever a thread continues with an epoch of its previous epoch class.
+    std::vector<EpochModelWorkspace> workspaces(numberOfThreads);
+    for (auto& threadWorkspace : workspaces) {
+        threadWorkspace.epochModel.equationSolverProblemFormat = sequentialWorkspace.epochModel.equationSolverProblemFormat;
+    }
+
+    return storm::utility::parallel::executeTaskGraph(numberOfThreads, getEpochDependencies(epochOrder), [&](uint64_t epochIndex, uint64_t thread) {
+        Epoch const& epoch = epochOrder[epochIndex];
+        EpochModelWorkspace& threadWorkspace = workspaces[thread];
+        auto& epochModel = setCurrentEpoch(threadWorkspace, epoch);
+        setSolutionForCurrentEpoch(threadWorkspace, analyzeEpoch(epochModel, epoch, thread));
+        if (epochSolvedCallback) {
+            std::lock_guard<std::mutex> lock(epochSolutionsMutex);
+            epochSolvedCallback(epoch);
+        }
+    });
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+    return setCurrentEpoch(sequentialWorkspace, epoch);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(EpochModelWorkspace& workspace,
+                                                                                                                          Epoch const& epoch) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
+    auto& epochModel = workspace.epochModel;
+    auto const& epochModelToProductChoiceMap = workspace.epochModelToProductChoiceMap;
 
     // Check if we need to update the current epoch class
-    if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
+    if (!workspace.currentEpoch || !epochManager.compareEpochClass(epoch, workspace.currentEpoch.get())) {
+        setCurrentEpochClass(workspace, epoch);
         epochModel.epochMatrixChanged = true;
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
@@ -422,12 +495,16 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         }
     }
     std::map<Epoch, EpochSolution const*> subSolutions;
-    for (auto const& step : possibleEpochSteps) {
-        Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
-        if (successorEpoch != epoch) {
-            auto successorSolIt = epochSolutions.find(successorEpoch);
-            STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-            subSolutions.emplace(successorEpoch, &successorSolIt->second);
+    {
+        // Successor solutions are only erased after the solution of the current epoch has been set, so the collected pointers remain valid.
+        std::lock_guard<std::mutex> lock(epochSolutionsMutex);
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch) {
+                auto successorSolIt = epochSolutions.find(successorEpoch);
+                STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
+                subSolutions.emplace(successorEpoch, &successorSolIt->second);
+            }
         }
     }
     epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
@@ -495,7 +572,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
     assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
 
-    currentEpoch = epoch;
+    workspace.currentEpoch = epoch;
     /*
     std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
     std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
@@ -511,7 +588,9 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(EpochModelWorkspace& workspace, Epoch const& epoch) {
+    auto& epochModel = workspace.epochModel;
+    auto& epochModelToProductChoiceMap = workspace.epochModelToProductChoiceMap;
     EpochClass epochClass = epochManager.getEpochClass(epoch);
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -655,7 +734,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     for (auto productState : productInStates) {
         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
     }
-    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+    workspace.productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
 
     epochModel.objectiveRewardFilter.clear();
     for (auto const& objRewards : epochModel.objectiveRewards) {
@@ -668,7 +747,7 @@ template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(
     storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-    epochModel.equationSolverProblemFormat = eqSysFormat;
+    sequentialWorkspace.epochModel.equationSolverProblemFormat = eqSysFormat;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -859,8 +938,15 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
+    setSolutionForCurrentEpoch(sequentialWorkspace, std::move(inStateSolutions));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(EpochModelWorkspace& workspace,
+                                                                                                 std::vector<SolutionType>&& inStateSolutions) {
+    auto const& currentEpoch = workspace.currentEpoch;
     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == workspace.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
@@ -870,6 +956,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     predecessorEpochs.erase(currentEpoch.get());
     successorEpochs.erase(currentEpoch.get());
 
+    std::lock_guard<std::mutex> lock(epochSolutionsMutex);
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
         auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
@@ -883,7 +970,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     // add the new solution
     EpochSolution solution;
     solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+    solution.productStateToSolutionVectorMap = workspace.productStateToEpochModelInStateMap;
     solution.solutions = std::move(inStateSolutions);
     epochSolutions[currentEpoch.get()] = std::move(solution);
 }
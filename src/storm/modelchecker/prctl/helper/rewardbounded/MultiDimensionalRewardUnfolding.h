@@ -1,6 +1,8 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
+#include <mutex>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -62,8 +64,39 @@ class MultiDimensionalRewardUnfolding {
      */
     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
 
+    /*!
+     * Computes the dependencies between the epochs of the given computation order.
+     * The i-th entry of the result contains the positions (within the given order) of the epochs whose solution is required to analyze the i-th epoch.
+     * Epochs that do not occur in the given order (e.g. because they have been computed earlier) are not considered.
+     * Each epoch only depends on epochs that occur earlier in the order, i.e., the dependencies form a DAG.
+     */
+    std::vector<std::vector<uint64_t>> getEpochDependencies(std::vector<Epoch> const& epochOrder) const;
+
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
+    /*!
+     * Retrieves the number of threads with which epochs are analyzed if the given number of threads is requested.
+     * The result is one (i.e., a sequential analysis) if the value type does not allow concurrent copies of shared numbers.
+     */
+    static uint64_t getNumberOfEpochAnalysisThreads(uint64_t requestedNumberOfThreads);
+
+    /*!
+     * Analyzes the given epochs using multiple threads. An epoch is analyzed as soon as the solutions of all the epochs it depends on are available.
+     * Each thread operates on its own epoch model. Solutions that are not needed anymore by a pending epoch are freed.
+     *
+     * @param epochOrder The epochs to analyze, e.g., as obtained via getEpochComputationOrder.
+     * @param numberOfThreads The number of threads to use (zero means 'auto-detect').
+     * @param analyzeEpoch Computes the solution of the given epoch model. The last argument is the index of the executing thread which allows to
+     * maintain thread local data (such as solvers).
+     * @param epochSolvedCallback If given, this is invoked after the solution of an epoch has been set. At this point, the result for that epoch can be
+     * obtained via getInitialStateResult. Invocations of this callback do not run concurrently.
+     * @return True iff all epochs have been analyzed (analysis stops prematurely if termination is requested).
+     */
+    bool analyzeEpochsInParallel(
+        std::vector<Epoch> const& epochOrder, uint64_t numberOfThreads,
+        std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, Epoch const&, uint64_t)> const& analyzeEpoch,
+        std::function<void(Epoch const&)> const& epochSolvedCallback = {});
+
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
 
     /*!
@@ -85,7 +118,19 @@ class MultiDimensionalRewardUnfolding {
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
+    /*!
+     * The data that is required to analyze a single epoch model.
+     */
+    struct EpochModelWorkspace {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        boost::optional<Epoch> currentEpoch;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+    };
+
+    EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(EpochModelWorkspace& workspace, Epoch const& epoch);
+    void setCurrentEpochClass(EpochModelWorkspace& workspace, Epoch const& epoch);
+    void setSolutionForCurrentEpoch(EpochModelWorkspace& workspace, std::vector<SolutionType>&& inStateSolutions);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -121,6 +166,7 @@ class MultiDimensionalRewardUnfolding {
         std::vector<SolutionType> solutions;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
+    std::mutex epochSolutionsMutex;  // Guards epochSolutions when epochs are analyzed in parallel
     EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
     SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
 
@@ -129,12 +175,9 @@ class MultiDimensionalRewardUnfolding {
 
     std::unique_ptr<ProductModel<ValueType>> productModel;
 
-    std::vector<uint64_t> epochModelToProductChoiceMap;
-    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
     std::set<Epoch> possibleEpochSteps;
 
-    EpochModel<ValueType, SingleObjectiveMode> epochModel;
-    boost::optional<Epoch> currentEpoch;
+    EpochModelWorkspace sequentialWorkspace;
 
     EpochManager epochManager;
 
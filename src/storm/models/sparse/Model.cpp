@@ -26,6 +26,7 @@ template<typename ValueType, typename RewardModelType>
 Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType> const& components)
     : storm::models::Model<ValueType>(modelType),
       transitionMatrix(components.transitionMatrix),
+      analysisCacheRegistration(&transitionMatrix),
       stateLabeling(components.stateLabeling),
       rewardModels(components.rewardModels),
       choiceLabeling(components.choiceLabeling),
@@ -38,6 +39,7 @@ template<typename ValueType, typename RewardModelType>
 Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType>&& components)
     : storm::models::Model<ValueType>(modelType),
       transitionMatrix(std::move(components.transitionMatrix)),
+      analysisCacheRegistration(&transitionMatrix),
       stateLabeling(std::move(components.stateLabeling)),
       rewardModels(std::move(components.rewardModels)),
       choiceLabeling(std::move(components.choiceLabeling)),
@@ -153,6 +155,11 @@ storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBa
     return this->getTransitionMatrix().transpose(true);
 }
 
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> Model<ValueType, RewardModelType>::getCachedBackwardTransitions() const {
+    return storm::storage::sparse::AnalysisCache::instance().getBackwardTransitions(this->getTransitionMatrix());
+}
+
 template<typename ValueType, typename RewardModelType>
 typename storm::storage::SparseMatrix<ValueType>::const_rows Model<ValueType, RewardModelType>::getRows(storm::storage::sparse::state_type state) const {
     return this->getTransitionMatrix().getRowGroup(state);
@@ -200,6 +207,8 @@ storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType>& Model<ValueType, RewardModelType>::getTransitionMatrix() {
+    // The matrix might get modified, so structures derived from it can no longer be reused.
+    analysisCacheRegistration.invalidate();
     return transitionMatrix;
 }
 
@@ -620,11 +629,13 @@ std::set<std::string> Model<ValueType, RewardModelType>::getLabelsOfState(storm:
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    analysisCacheRegistration.invalidate();
 }
 
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
     this->transitionMatrix = std::move(transitionMatrix);
+    analysisCacheRegistration.invalidate();
 }
 
 template<typename ValueType, typename RewardModelType>
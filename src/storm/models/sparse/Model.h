@@ -9,6 +9,7 @@
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/AnalysisCache.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateType.h"
@@ -58,6 +59,14 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
 
+    /*!
+     * Retrieves the backward transition relation of the model. In contrast to getBackwardTransitions, the result is
+     * stored in the analysis cache, so that it can be reused until the transition matrix changes.
+     *
+     * @return A pointer to a sparse matrix that represents the backward transitions of this model.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getCachedBackwardTransitions() const;
+
     /*!
      * Returns an object representing the matrix rows associated with the given state.
      *
@@ -454,6 +463,9 @@ class Model : public storm::models::Model<CValueType> {
     //  A matrix representing transition relation.
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
 
+    // Registers the transition matrix with the cache for derived structures (such as the backward transitions).
+    storm::storage::sparse::AnalysisCache::Registration analysisCacheRegistration;
+
     // The labeling of the states.
     storm::models::sparse::StateLabeling stateLabeling;
 
@@ -675,6 +675,11 @@ storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
     return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
 }
 
+storm::settings::modules::ModelCheckerSettings& mutableModelCheckerSettings() {
+    return dynamic_cast<storm::settings::modules::ModelCheckerSettings&>(
+        mutableManager().getModule(storm::settings::modules::ModelCheckerSettings::moduleName));
+}
+
 void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::mutableManager().setName(name, executableName);
 
@@ -21,6 +21,7 @@ const std::string BisimulationSettings::signatureModeOptionName = "sigmode";
 const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
+const std::string BisimulationSettings::sparseRefinementModeOptionName = "sparserefine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
@@ -91,6 +92,17 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    std::vector<std::string> sparseRefinementModes = {"splitter", "signature"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementModeOptionName, true,
+                                                   "Sets which refinement mode to use for sparse models. The signature-based refinement uses the number of "
+                                                   "threads given by the model checker settings.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementModes))
+                                         .setDefaultValueString("splitter")
+                                         .build())
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -173,6 +185,14 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+BisimulationSettings::SparseRefinementMode BisimulationSettings::getSparseRefinementMode() const {
+    std::string sparseRefinementModeAsString = this->getOption(sparseRefinementModeOptionName).getArgumentByName("mode").getValueAsString();
+    if (sparseRefinementModeAsString == "signature") {
+        return SparseRefinementMode::Signature;
+    }
+    return SparseRefinementMode::Splitter;
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
@@ -22,6 +22,8 @@ const std::string explorationOrderOptionName = "explorder";
 const std::string explorationOrderOptionShortName = "eo";
 const std::string explorationChecksOptionName = "explchecks";
 const std::string explorationChecksOptionShortName = "ec";
+const std::string explorationQueueSpillOptionName = "explqueue-spill";
+const std::string ddVariableOrderOptionName = "ddorder";
 const std::string prismCompatibilityOptionName = "prismcompat";
 const std::string prismCompatibilityOptionShortName = "pc";
 const std::string dontFixDeadlockOptionName = "nofixdl";
@@ -36,7 +38,10 @@ const std::string buildObservationValuationsOptionName = "buildobsval";
 const std::string buildAllLabelsOptionName = "build-all-labels";
 const std::string buildOutOfBoundsStateOptionName = "build-out-of-bounds-state";
 const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
+const std::string cacheSynchronizationsOptionName = "cache-synchronizations";
+const std::string modelCacheOptionName = "model-cache";
 const std::string noSimplifyOptionName = "no-simplify";
+const std::string shareExpressionsOptionName = "share-expressions";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
 
@@ -80,10 +85,27 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("bfs")
                                          .build())
                         .build());
+    std::vector<std::string> ddVariableOrderHeuristics = {"declaration", "force", "clustered"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderOptionName, false,
+                                                   "Sets the heuristic used to statically order the variables when building symbolic models.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic to choose.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderHeuristics))
+                                         .setDefaultValueString("declaration")
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false,
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationQueueSpillOptionName, false,
+                                                   "Sets the number of unexplored states that are kept in memory before further states are spilled to disk.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "states", "The number of states. If zero, states are only spilled if the memory limit is close to being reached.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added")
                         .setIsAdvanced()
                         .build());
@@ -91,8 +113,21 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                                    "For states where multiple guards are enabled, we add a label (for debugging DTMCs)")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, cacheSynchronizationsOptionName, false,
+                                                   "If set, the synchronizing edges of JANI models are determined once for each reachable location vector.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modelCacheOptionName, false,
+                                                   "If set, sparse models are stored in (and loaded from) the given directory to avoid rebuilding them.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory of the model cache.").build())
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, shareExpressionsOptionName, false,
+                                                   "If set, equal expressions of the symbolic input are shared and their simplifications are cached.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false,
                                                    "Sets the number of bits that is used for unbounded integer variables.")
                         .setIsAdvanced()
@@ -173,6 +208,22 @@ bool BuildSettings::isBuildAllLabelsSet() const {
     return this->getOption(buildAllLabelsOptionName).getHasOptionBeenSet();
 }
 
+bool BuildSettings::isCacheSynchronizationsSet() const {
+    return this->getOption(cacheSynchronizationsOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isModelCacheSet() const {
+    return this->getOption(modelCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getModelCacheDirectory() const {
+    return this->getOption(modelCacheOptionName).getArgumentByName("dir").getValueAsString();
+}
+
+std::unique_ptr<storm::settings::SettingMemento> BuildSettings::overrideModelCacheSet(bool stateToSet) {
+    return this->overrideOption(modelCacheOptionName, stateToSet);
+}
+
 storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
     std::string explorationOrderAsString = this->getOption(explorationOrderOptionName).getArgumentByName("name").getValueAsString();
     if (explorationOrderAsString == "dfs") {
@@ -183,14 +234,38 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
 
+storm::builder::DdVariableOrderHeuristic BuildSettings::getDdVariableOrderHeuristic() const {
+    std::string heuristicAsString = this->getOption(ddVariableOrderOptionName).getArgumentByName("name").getValueAsString();
+    if (heuristicAsString == "declaration") {
+        return storm::builder::DdVariableOrderHeuristic::Declaration;
+    } else if (heuristicAsString == "force") {
+        return storm::builder::DdVariableOrderHeuristic::Force;
+    } else if (heuristicAsString == "clustered") {
+        return storm::builder::DdVariableOrderHeuristic::Clustered;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable order heuristic '" << heuristicAsString << "'.");
+}
+
 bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
 
+uint64_t BuildSettings::getExplorationQueueSpillThreshold() const {
+    return this->getOption(explorationQueueSpillOptionName).getArgumentByName("states").getValueAsUnsignedInteger();
+}
+
 bool BuildSettings::isNoSimplifySet() const {
     return this->getOption(noSimplifyOptionName).getHasOptionBeenSet();
 }
 
+bool BuildSettings::isShareExpressionsSet() const {
+    return this->getOption(shareExpressionsOptionName).getHasOptionBeenSet();
+}
+
+std::unique_ptr<storm::settings::SettingMemento> BuildSettings::overrideShareExpressionsSet(bool stateToSet) {
+    return this->overrideOption(shareExpressionsOptionName, stateToSet);
+}
+
 uint64_t BuildSettings::getBitsForUnboundedVariables() const {
     return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
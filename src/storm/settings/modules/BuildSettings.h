@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-config.h"
+#include "storm/builder/DdVariableOrder.h"
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
@@ -35,6 +36,21 @@ class BuildSettings : public ModuleSettings {
      */
     storm::builder::ExplorationOrder getExplorationOrder() const;
 
+    /*!
+     * Retrieves the number of unexplored states that the explicit model builder keeps in memory before spilling
+     * further states to disk.
+     *
+     * @return The number of states or zero if states are only to be spilled under memory pressure.
+     */
+    uint64_t getExplorationQueueSpillThreshold() const;
+
+    /*!
+     * Retrieves the heuristic that is used to statically order the variables when building symbolic models.
+     *
+     * @return The chosen variable order heuristic.
+     */
+    storm::builder::DdVariableOrderHeuristic getDdVariableOrderHeuristic() const;
+
     /*!
      * Retrieves whether the PRISM compatibility mode was enabled.
      *
@@ -113,6 +129,30 @@ class BuildSettings : public ModuleSettings {
      */
     bool isBuildAllLabelsSet() const;
 
+    /*!
+     * Retrieves whether the synchronizations of JANI models shall be cached per location vector
+     */
+    bool isCacheSynchronizationsSet() const;
+
+    /*!
+     * Retrieves whether built sparse models shall be cached on disk
+     */
+    bool isModelCacheSet() const;
+
+    /*!
+     * Retrieves the directory in which built sparse models are cached
+     */
+    std::string getModelCacheDirectory() const;
+
+    /*!
+     * Overrides the option to cache built sparse models by setting it to the specified value. As soon as the
+     * returned memento goes out of scope, the original value is restored.
+     *
+     * @param stateToSet The value that is to be set for the model-cache option.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overrideModelCacheSet(bool stateToSet);
+
     /*!
      * Retrieves the number of bits that should be used to represent unbounded integer variables
      * @return
@@ -124,6 +164,20 @@ class BuildSettings : public ModuleSettings {
      */
     bool isNoSimplifySet() const;
 
+    /*!
+     * Retrieves whether structurally equal expressions of symbolic inputs shall be shared
+     */
+    bool isShareExpressionsSet() const;
+
+    /*!
+     * Overrides the option to share expressions by setting it to the specified value. As soon as the
+     * returned memento goes out of scope, the original value is restored.
+     *
+     * @param stateToSet The value that is to be set for the share-expressions option.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overrideShareExpressionsSet(bool stateToSet);
+
     /*!
      * Retrieves whether location elimination is enabled
      */
@@ -20,6 +20,7 @@ const std::string IOSettings::moduleName = "io";
 const std::string IOSettings::exportDotOptionName = "exportdot";
 const std::string IOSettings::exportDotMaxWidthOptionName = "dot-maxwidth";
 const std::string IOSettings::exportBuildOptionName = "exportbuild";
+const std::string IOSettings::exportBuildStreamingOptionName = "exportbuild-streaming";
 const std::string IOSettings::exportExplicitOptionName = "exportexplicit";
 const std::string IOSettings::exportDdOptionName = "exportdd";
 const std::string IOSettings::exportJaniDotOptionName = "exportjanidot";
@@ -84,6 +85,11 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                              .makeOptional()
                              .build())
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportBuildStreamingOptionName, false,
+                                                   "If set, the model is written to the file given via --" + exportBuildOptionName +
+                                                       " (in drn format) while it is explored. The model is not kept in memory and can not be analyzed.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportJaniDotOptionName, false,
                                        "If given, the loaded jani model will be written to the specified file in the dot format.")
@@ -290,6 +296,10 @@ storm::exporter::ModelExportFormat IOSettings::getExportBuildFormat() const {
     }
 }
 
+bool IOSettings::isExportBuildStreamingSet() const {
+    return this->getOption(exportBuildStreamingOptionName).getHasOptionBeenSet();
+}
+
 bool IOSettings::isExportJaniDotSet() const {
     return this->getOption(exportJaniDotOptionName).getHasOptionBeenSet();
 }
@@ -533,6 +543,9 @@ bool IOSettings::check() const {
     STORM_LOG_THROW(!isPrismToJaniSet() || isPrismInputSet(), storm::exceptions::InvalidSettingsException,
                     "For the transformation from PRISM to JANI, the input model must be given in the prism format.");
 
+    STORM_LOG_THROW(!isExportBuildStreamingSet() || (isExportBuildSet() && getExportBuildFormat() == storm::exporter::ModelExportFormat::Drn),
+                    storm::exceptions::InvalidSettingsException, "Exporting the model during the exploration requires an export to a drn file.");
+
     return true;
 }
 
@@ -58,6 +58,11 @@ class IOSettings : public ModuleSettings {
      */
     storm::exporter::ModelExportFormat getExportBuildFormat() const;
 
+    /*!
+     * Retrieves whether the model is to be exported while it is explored (instead of building it).
+     */
+    bool isExportBuildStreamingSet() const;
+
     /*!
      * Retrieves whether the export-to-dot option for jani was set.
      *
@@ -379,6 +384,7 @@ class IOSettings : public ModuleSettings {
     static const std::string exportDotOptionName;
     static const std::string exportDotMaxWidthOptionName;
     static const std::string exportBuildOptionName;
+    static const std::string exportBuildStreamingOptionName;
     static const std::string exportJaniDotOptionName;
     static const std::string exportExplicitOptionName;
     static const std::string exportDdOptionName;
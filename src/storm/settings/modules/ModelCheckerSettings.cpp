@@ -14,6 +14,9 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::threadCountOptionName = "threads";
+const std::string ModelCheckerSettings::analysisCacheOptionName = "analysiscache";
+const std::string ModelCheckerSettings::warmStartOptionName = "warmstart";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +30,24 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true,
+                                                   "Sets the number of threads used by model checking algorithms that support parallelization.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, analysisCacheOptionName, true,
+                                                   "Sets the memory limit for structures that are reused across the properties checked on the same model.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory limit in megabytes (0 disables it).")
+                                         .setDefaultValueUnsignedInteger(512)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, warmStartOptionName, false,
+                                                   "If set, the results of previous properties are used as starting points for related properties.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +62,22 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+uint64_t ModelCheckerSettings::getNumberOfThreads() const {
+    return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+void ModelCheckerSettings::setNumberOfThreads(uint64_t value) {
+    this->getOption(threadCountOptionName).getArgumentByName("value").setFromStringValue(std::to_string(value));
+}
+
+uint64_t ModelCheckerSettings::getAnalysisCacheMemoryLimit() const {
+    return this->getOption(analysisCacheOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isWarmStartSet() const {
+    return this->getOption(warmStartOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
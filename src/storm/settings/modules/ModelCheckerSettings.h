@@ -35,6 +35,36 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves the number of threads that model checking algorithms with support for parallelization are allowed to use.
+     *
+     * @return The number of threads (zero means 'auto-detect').
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Sets the number of threads that model checking algorithms with support for parallelization are allowed to use.
+     *
+     * @param value The number of threads (zero means 'auto-detect').
+     */
+    void setNumberOfThreads(uint64_t value);
+
+    /*!
+     * Retrieves the maximal memory that may be occupied by the structures that are shared between the model checking
+     * queries on the same model (such as backward transitions and qualitative state sets).
+     *
+     * @return The memory limit in megabytes (zero disables the cache).
+     */
+    uint64_t getAnalysisCacheMemoryLimit() const;
+
+    /*!
+     * Retrieves whether the results of previously checked properties shall be used as hints for related properties,
+     * e.g. properties that only differ in a step bound.
+     *
+     * @return True iff warm starts are enabled.
+     */
+    bool isWarmStartSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +72,9 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string threadCountOptionName;
+    static const std::string analysisCacheOptionName;
+    static const std::string warmStartOptionName;
 };
 
 }  // namespace modules
@@ -2,9 +2,11 @@
 
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/utility/Metrics.h"
 
 namespace storm {
 namespace settings {
@@ -13,9 +15,11 @@ namespace modules {
 const std::string ResourceSettings::moduleName = "resources";
 const std::string ResourceSettings::timeoutOptionName = "timeout";
 const std::string ResourceSettings::timeoutOptionShortName = "t";
+const std::string ResourceSettings::memoryLimitOptionName = "memlimit";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::exportMetricsOptionName = "metrics";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -25,6 +29,13 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, memoryLimitOptionName, false,
+                                                   "If given, computation will free cached data or abort before the memory limit is exceeded.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory limit in megabytes.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.")
                         .setShortName(printTimeAndMemoryOptionShortName)
                         .build());
@@ -35,6 +46,19 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    std::vector<std::string> metricsFormats = {"json", "chrome"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportMetricsOptionName, false,
+                                                   "If given, the timings of the individual phases and further counters (e.g. explored states, matrix-vector "
+                                                   "multiplications, SCC sizes) are exported to the given file.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file to which the metrics are written.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "format", "The output format. 'chrome' yields a trace that can be loaded in chrome://tracing or Perfetto.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(metricsFormats))
+                                         .setDefaultValueString("json")
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -45,6 +69,14 @@ uint_fast64_t ResourceSettings::getTimeoutInSeconds() const {
     return this->getOption(timeoutOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isMemoryLimitSet() const {
+    return this->getOption(memoryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t ResourceSettings::getMemoryLimitInMegabytes() const {
+    return this->getOption(memoryLimitOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+}
+
 bool ResourceSettings::isPrintTimeAndMemorySet() const {
     return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
 }
@@ -53,6 +85,22 @@ uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isExportMetricsSet() const {
+    return this->getOption(exportMetricsOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getExportMetricsFilename() const {
+    return this->getOption(exportMetricsOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+storm::utility::metrics::MetricsFormat ResourceSettings::getExportMetricsFormat() const {
+    std::string format = this->getOption(exportMetricsOptionName).getArgumentByName("format").getValueAsString();
+    if (format == "chrome") {
+        return storm::utility::metrics::MetricsFormat::ChromeTrace;
+    }
+    return storm::utility::metrics::MetricsFormat::Json;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
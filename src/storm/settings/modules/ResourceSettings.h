@@ -4,6 +4,12 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 namespace storm {
+namespace utility {
+namespace metrics {
+enum class MetricsFormat;
+}  // namespace metrics
+}  // namespace utility
+
 namespace settings {
 namespace modules {
 
@@ -38,6 +44,20 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getTimeoutInSeconds() const;
 
+    /*!
+     * Retrieves whether the memory limit option was set.
+     *
+     * @return True if the memory limit option was set.
+     */
+    bool isMemoryLimitSet() const;
+
+    /*!
+     * Retrieves the amount of memory that the computation may use in case the memory limit option was set.
+     *
+     * @return The memory limit in megabytes.
+     */
+    uint_fast64_t getMemoryLimitInMegabytes() const;
+
     /*!
      * Retrieves the waiting time of the program after a signal.
      * If a signal to abort is handled, the program should terminate.
@@ -47,6 +67,23 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether the per-phase timings and counters of the run shall be exported.
+     *
+     * @return True iff the option was set.
+     */
+    bool isExportMetricsSet() const;
+
+    /*!
+     * Retrieves the file to which the metrics shall be exported.
+     */
+    std::string getExportMetricsFilename() const;
+
+    /*!
+     * Retrieves the format in which the metrics shall be exported.
+     */
+    storm::utility::metrics::MetricsFormat getExportMetricsFormat() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -54,9 +91,11 @@ class ResourceSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string timeoutOptionName;
     static const std::string timeoutOptionShortName;
+    static const std::string memoryLimitOptionName;
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string exportMetricsOptionName;
 };
 }  // namespace modules
 }  // namespace settings
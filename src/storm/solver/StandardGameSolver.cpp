@@ -5,6 +5,7 @@
 #include "storm/solver/GmmxxLinearEquationSolver.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -15,11 +16,14 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+using storm::utility::parallel::anyOfChunks;
+
 template<typename ValueType>
 StandardGameSolver<ValueType>::StandardGameSolver(storm::storage::SparseMatrix<storm::storage::sparse::state_type> const& player1Matrix,
                                                   storm::storage::SparseMatrix<ValueType> const& player2Matrix,
@@ -148,7 +152,7 @@ bool StandardGameSolver<ValueType>::solveGamePolicyIteration(Environment const&
         *player1Choices = std::vector<storm::storage::sparse::state_type>(this->getPlayer1Matrix().getRowGroupCount(), 0);
     } else {
         // Player 1 represented by grouping of player 2 states.
-        player1Choices->resize(player1Choices->size() - 1);
+        player1Choices->resize(this->getNumberOfPlayer1States());
     }
     if (this->hasSchedulerHints()) {
         *player2Choices = this->player2ChoicesHint.get();
@@ -472,81 +476,98 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
             : storm::utility::convertNumber<ValueType>(env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType()).first.get()),
         false);
 
-    // get the choices of player 2 and the corresponding values.
-    bool schedulerImproved = false;
-    auto currentValueIt = player2ChoiceValues.begin();
-    for (uint_fast64_t p2Group = 0; p2Group < this->player2Matrix.getRowGroupCount(); ++p2Group, ++currentValueIt) {
-        uint_fast64_t firstRowInGroup = this->player2Matrix.getRowGroupIndices()[p2Group];
-        uint_fast64_t rowGroupSize = this->player2Matrix.getRowGroupIndices()[p2Group + 1] - firstRowInGroup;
-
-        // We need to check whether the scheduler improved. Therefore, we first have to evaluate the current choice.
-        uint_fast64_t currentP2Choice = player2Choices[p2Group];
-        *currentValueIt = storm::utility::zero<ValueType>();
-        for (auto const& entry : this->player2Matrix.getRow(firstRowInGroup + currentP2Choice)) {
-            *currentValueIt += entry.getValue() * x[entry.getColumn()];
-        }
-        *currentValueIt += b[firstRowInGroup + currentP2Choice];
+    // The improvement steps of the individual states of a player are independent of each other, so they are
+    // performed in parallel if requested and if the value type permits it.
+    uint64_t const numberOfThreads = storm::utility::parallel::isThreadSafeValueType<ValueType>
+                                         ? storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfThreads())
+                                         : 1;
 
-        // Now check other choices improve the value.
-        for (uint_fast64_t p2Choice = 0; p2Choice < rowGroupSize; ++p2Choice) {
-            if (p2Choice == currentP2Choice) {
-                continue;
-            }
-            ValueType choiceValue = storm::utility::zero<ValueType>();
-            for (auto const& entry : this->player2Matrix.getRow(firstRowInGroup + p2Choice)) {
-                choiceValue += entry.getValue() * x[entry.getColumn()];
+    // get the choices of player 2 and the corresponding values.
+    bool schedulerImproved = anyOfChunks(numberOfThreads, this->player2Matrix.getRowGroupCount(), [&](uint64_t firstGroup, uint64_t lastGroup) {
+        bool improved = false;
+        auto currentValueIt = player2ChoiceValues.begin() + firstGroup;
+        for (uint_fast64_t p2Group = firstGroup; p2Group < lastGroup; ++p2Group, ++currentValueIt) {
+            uint_fast64_t firstRowInGroup = this->player2Matrix.getRowGroupIndices()[p2Group];
+            uint_fast64_t rowGroupSize = this->player2Matrix.getRowGroupIndices()[p2Group + 1] - firstRowInGroup;
+
+            // We need to check whether the scheduler improved. Therefore, we first have to evaluate the current choice.
+            uint_fast64_t currentP2Choice = player2Choices[p2Group];
+            *currentValueIt = storm::utility::zero<ValueType>();
+            for (auto const& entry : this->player2Matrix.getRow(firstRowInGroup + currentP2Choice)) {
+                *currentValueIt += entry.getValue() * x[entry.getColumn()];
             }
-            choiceValue += b[firstRowInGroup + p2Choice];
+            *currentValueIt += b[firstRowInGroup + currentP2Choice];
 
-            if (valueImproved(player2Dir, comparator, *currentValueIt, choiceValue)) {
-                schedulerImproved = true;
-                player2Choices[p2Group] = p2Choice;
-                *currentValueIt = std::move(choiceValue);
+            // Now check other choices improve the value.
+            for (uint_fast64_t p2Choice = 0; p2Choice < rowGroupSize; ++p2Choice) {
+                if (p2Choice == currentP2Choice) {
+                    continue;
+                }
+                ValueType choiceValue = storm::utility::zero<ValueType>();
+                for (auto const& entry : this->player2Matrix.getRow(firstRowInGroup + p2Choice)) {
+                    choiceValue += entry.getValue() * x[entry.getColumn()];
+                }
+                choiceValue += b[firstRowInGroup + p2Choice];
+
+                if (valueImproved(player2Dir, comparator, *currentValueIt, choiceValue)) {
+                    improved = true;
+                    player2Choices[p2Group] = p2Choice;
+                    *currentValueIt = std::move(choiceValue);
+                }
             }
         }
-    }
+        return improved;
+    });
 
-    // Now extract the choices of player 1.
+    // Now extract the choices of player 1. This requires the values of all player 2 states.
     if (this->player1RepresentedByMatrix()) {
         // Player 1 represented by matrix.
-        for (uint_fast64_t p1Group = 0; p1Group < this->getPlayer1Matrix().getRowGroupCount(); ++p1Group) {
-            uint_fast64_t firstRowInGroup = this->getPlayer1Matrix().getRowGroupIndices()[p1Group];
-            uint_fast64_t rowGroupSize = this->getPlayer1Matrix().getRowGroupIndices()[p1Group + 1] - firstRowInGroup;
-            uint_fast64_t currentChoice = player1Choices[p1Group];
-            ValueType currentValue = player2ChoiceValues[this->getPlayer1Matrix().getRow(firstRowInGroup + currentChoice).begin()->getColumn()];
-            for (uint_fast64_t p1Choice = 0; p1Choice < rowGroupSize; ++p1Choice) {
-                // If the choice is the currently selected one, we can skip it.
-                if (p1Choice == currentChoice) {
-                    continue;
-                }
-                ValueType const& choiceValue = player2ChoiceValues[this->getPlayer1Matrix().getRow(firstRowInGroup + p1Choice).begin()->getColumn()];
-                if (valueImproved(player1Dir, comparator, currentValue, choiceValue)) {
-                    schedulerImproved = true;
-                    player1Choices[p1Group] = p1Choice;
-                    currentValue = choiceValue;
+        schedulerImproved |= anyOfChunks(numberOfThreads, this->getPlayer1Matrix().getRowGroupCount(), [&](uint64_t firstGroup, uint64_t lastGroup) {
+            bool improved = false;
+            for (uint_fast64_t p1Group = firstGroup; p1Group < lastGroup; ++p1Group) {
+                uint_fast64_t firstRowInGroup = this->getPlayer1Matrix().getRowGroupIndices()[p1Group];
+                uint_fast64_t rowGroupSize = this->getPlayer1Matrix().getRowGroupIndices()[p1Group + 1] - firstRowInGroup;
+                uint_fast64_t currentChoice = player1Choices[p1Group];
+                ValueType currentValue = player2ChoiceValues[this->getPlayer1Matrix().getRow(firstRowInGroup + currentChoice).begin()->getColumn()];
+                for (uint_fast64_t p1Choice = 0; p1Choice < rowGroupSize; ++p1Choice) {
+                    // If the choice is the currently selected one, we can skip it.
+                    if (p1Choice == currentChoice) {
+                        continue;
+                    }
+                    ValueType const& choiceValue = player2ChoiceValues[this->getPlayer1Matrix().getRow(firstRowInGroup + p1Choice).begin()->getColumn()];
+                    if (valueImproved(player1Dir, comparator, currentValue, choiceValue)) {
+                        improved = true;
+                        player1Choices[p1Group] = p1Choice;
+                        currentValue = choiceValue;
+                    }
                 }
             }
-        }
+            return improved;
+        });
     } else {
         // Player 1 represented by grouping of player 2 states (vector).
-        for (uint64_t player1State = 0; player1State < this->getPlayer1Grouping().size() - 1; ++player1State) {
-            uint64_t currentChoice = player1Choices[player1State];
-            ValueType currentValue = player2ChoiceValues[this->getPlayer1Grouping()[player1State] + currentChoice];
-            uint64_t numberOfPlayer2Successors = this->getPlayer1Grouping()[player1State + 1] - this->getPlayer1Grouping()[player1State];
-            for (uint64_t player2State = 0; player2State < numberOfPlayer2Successors; ++player2State) {
-                // If the choice is the currently selected one, we can skip it.
-                if (currentChoice == player2State) {
-                    continue;
-                }
+        schedulerImproved |= anyOfChunks(numberOfThreads, this->getPlayer1Grouping().size() - 1, [&](uint64_t firstState, uint64_t lastState) {
+            bool improved = false;
+            for (uint64_t player1State = firstState; player1State < lastState; ++player1State) {
+                uint64_t currentChoice = player1Choices[player1State];
+                ValueType currentValue = player2ChoiceValues[this->getPlayer1Grouping()[player1State] + currentChoice];
+                uint64_t numberOfPlayer2Successors = this->getPlayer1Grouping()[player1State + 1] - this->getPlayer1Grouping()[player1State];
+                for (uint64_t player2State = 0; player2State < numberOfPlayer2Successors; ++player2State) {
+                    // If the choice is the currently selected one, we can skip it.
+                    if (currentChoice == player2State) {
+                        continue;
+                    }
 
-                ValueType const& choiceValue = player2ChoiceValues[this->getPlayer1Grouping()[player1State] + player2State];
-                if (valueImproved(player1Dir, comparator, currentValue, choiceValue)) {
-                    schedulerImproved = true;
-                    player1Choices[player1State] = player2State;
-                    currentValue = choiceValue;
+                    ValueType const& choiceValue = player2ChoiceValues[this->getPlayer1Grouping()[player1State] + player2State];
+                    if (valueImproved(player1Dir, comparator, currentValue, choiceValue)) {
+                        improved = true;
+                        player1Choices[player1State] = player2State;
+                        currentValue = choiceValue;
+                    }
                 }
             }
-        }
+            return improved;
+        });
     }
 
     return schedulerImproved;
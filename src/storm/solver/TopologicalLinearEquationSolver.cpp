@@ -6,6 +6,7 @@
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/Metrics.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -75,6 +76,15 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
                        << " states. Average SCC size is "
                        << static_cast<double>(this->getMatrixRowCount()) / static_cast<double>(this->sortedSccDecomposition->size()) << ".");
+        if (storm::utility::metrics::isEnabled()) {
+            uint64_t largestSccSize = 0;
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                largestSccSize = std::max<uint64_t>(largestSccSize, scc.size());
+            }
+            storm::utility::metrics::addToCounter("SCC decompositions");
+            storm::utility::metrics::addToCounter("SCCs", this->sortedSccDecomposition->size());
+            storm::utility::metrics::updateCounterMaximum("largest SCC size", largestSccSize);
+        }
     }
 
     // We do not need to adapt the precision if all SCCs are trivial (i.e., the system is acyclic)
@@ -1,8 +1,16 @@
 #include "storm/solver/helper/ValueIterationHelper.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/Extremum.h"
+#include "storm/utility/Metrics.h"
+#include "storm/utility/SignalHandler.h"
 
 namespace storm::solver::helper {
 
@@ -54,6 +62,67 @@ class VIOperatorBackend {
     bool isConverged{true};
 };
 
+template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
+class InterleavedVIOperatorBackend {
+   public:
+    InterleavedVIOperatorBackend(ValueType const& precision, uint64_t numberOfOperands, storm::storage::BitVector const* fixedEntries)
+        : precision{precision}, best(numberOfOperands), fixedEntries{fixedEntries} {
+        // intentionally empty
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+    }
+
+    void firstRow(ValueType const* values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        std::copy_n(values, best.size(), best.begin());
+    }
+
+    void nextRow(ValueType const* values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        for (uint64_t i = 0; i < best.size(); ++i) {
+            if constexpr (storm::solver::maximize(Dir)) {
+                best[i] = std::max(best[i], values[i]);
+            } else {
+                best[i] = std::min(best[i], values[i]);
+            }
+        }
+    }
+
+    void applyUpdate(ValueType* currValues, uint64_t rowGroup) {
+        for (uint64_t i = 0; i < best.size(); ++i) {
+            if (fixedEntries && fixedEntries->get(rowGroup * best.size() + i)) {
+                continue;
+            }
+            if (isConverged) {
+                if constexpr (Relative) {
+                    isConverged = storm::utility::abs<ValueType>(currValues[i] - best[i]) <= storm::utility::abs<ValueType>(precision * currValues[i]);
+                } else {
+                    isConverged = storm::utility::abs<ValueType>(currValues[i] - best[i]) <= precision;
+                }
+            }
+            currValues[i] = best[i];
+        }
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return isConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    ValueType const precision;
+    std::vector<ValueType> best;
+    storm::storage::BitVector const* fixedEntries;
+    bool isConverged{true};
+};
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::ValueIterationHelper(
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator)
@@ -74,10 +143,16 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
         operand2 = &viOperator->allocateAuxiliaryVector(operand.size());
     }
     bool resultInAuxVector{false};
+    // For interval models, the order of the successors is kept across the iterations (see ValueIterationOperator::RobustOrder)
+    typename ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::RobustOrder robustOrder;
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        robustOrder = viOperator->createRobustOrder();
+    }
+    uint64_t const initialNumIterations = numIterations;
     SolverStatus status{SolverStatus::InProgress};
     while (status == SolverStatus::InProgress) {
         ++numIterations;
-        bool applyResult = viOperator->template applyRobust<RobustDir>(*operand1, *operand2, offsets, backend);
+        bool applyResult = viOperator->template applyRobust<RobustDir>(*operand1, *operand2, offsets, backend, &robustOrder);
         if (applyResult) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
@@ -95,6 +170,7 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
         }
         viOperator->freeAuxiliaryVector();
     }
+    storm::utility::metrics::addToCounter("value iteration iterations", numIterations - initialNumIterations);
     return status;
 }
 
@@ -143,6 +219,91 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
     return VI(operand, offsets, numIterations, relative, precision, dir, iterationCallback, mult, robust);
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<storm::OptimizationDirection Dir, bool Relative>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::interleavedVI(
+    std::vector<SolutionType>& operands, std::vector<ValueType> const& offsets, uint64_t numberOfOperands, uint64_t& numIterations,
+    SolutionType const& precision, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+    storm::storage::BitVector const* fixedOperandEntries) const {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Value iteration with interleaved operands is not supported for interval models.");
+        return SolverStatus::Aborted;
+    } else {
+        InterleavedVIOperatorBackend<SolutionType, Dir, Relative> backend{precision, numberOfOperands, fixedOperandEntries};
+        uint64_t const initialNumIterations = numIterations;
+        SolverStatus status{SolverStatus::InProgress};
+        while (status == SolverStatus::InProgress) {
+            ++numIterations;
+            if (viOperator->applyInterleaved(operands, operands, offsets, numberOfOperands, backend)) {
+                status = SolverStatus::Converged;
+            } else if (iterationCallback) {
+                status = iterationCallback(status);
+            }
+        }
+        // Each sweep over the matrix performs one multiplication per operand
+        storm::utility::metrics::addToCounter("value iteration iterations", numIterations - initialNumIterations);
+        storm::utility::metrics::addToCounter("matrix-vector multiplications", (numIterations - initialNumIterations) * numberOfOperands);
+        return status;
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::interleavedVI(
+    std::vector<SolutionType>& operands, std::vector<ValueType> const& offsets, uint64_t numberOfOperands, uint64_t& numIterations, bool relative,
+    SolutionType const& precision, std::optional<storm::OptimizationDirection> const& dir,
+    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback, storm::storage::BitVector const* fixedOperandEntries) const {
+    STORM_LOG_ASSERT(TrivialRowGrouping || dir.has_value(), "no optimization direction given!");
+    if (!dir.has_value() || maximize(*dir)) {
+        if (relative) {
+            return interleavedVI<storm::OptimizationDirection::Maximize, true>(operands, offsets, numberOfOperands, numIterations, precision, iterationCallback,
+                                                                               fixedOperandEntries);
+        } else {
+            return interleavedVI<storm::OptimizationDirection::Maximize, false>(operands, offsets, numberOfOperands, numIterations, precision,
+                                                                                iterationCallback, fixedOperandEntries);
+        }
+    } else {
+        if (relative) {
+            return interleavedVI<storm::OptimizationDirection::Minimize, true>(operands, offsets, numberOfOperands, numIterations, precision, iterationCallback,
+                                                                               fixedOperandEntries);
+        } else {
+            return interleavedVI<storm::OptimizationDirection::Minimize, false>(operands, offsets, numberOfOperands, numIterations, precision,
+                                                                                iterationCallback, fixedOperandEntries);
+        }
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::interleavedVI(storm::Environment const& env,
+                                                                                              std::vector<SolutionType>& operands,
+                                                                                              std::vector<ValueType> const& offsets, uint64_t numberOfOperands,
+                                                                                              std::optional<storm::OptimizationDirection> const& dir,
+                                                                                              storm::storage::BitVector const* fixedOperandEntries) const {
+    auto const& nativeEnv = env.solver().native();
+    uint64_t numIterations{0};
+    auto iterationCallback = [&nativeEnv, &numIterations](SolverStatus const& current) {
+        if (numIterations >= nativeEnv.getMaximalNumberOfIterations()) {
+            return SolverStatus::MaximalIterationsExceeded;
+        }
+        return storm::utility::resources::isTerminate() ? SolverStatus::Aborted : current;
+    };
+    auto status = interleavedVI(operands, offsets, numberOfOperands, numIterations, nativeEnv.getRelativeTerminationCriterion(),
+                                storm::utility::convertNumber<SolutionType>(nativeEnv.getPrecision()), dir, iterationCallback,
+                                fixedOperandEntries);
+    STORM_LOG_WARN_COND(status == SolverStatus::Converged, "Value iteration for " << numberOfOperands << " interleaved operands did not converge after "
+                                                                                   << numIterations << " iterations.");
+    STORM_LOG_INFO("Value iteration for " << numberOfOperands << " interleaved operands terminated after " << numIterations << " iterations.");
+    return status;
+}
+
+bool isInterleavedValueIterationApplicable(storm::Environment const& env) {
+    auto solverType = env.solver().getLinearEquationSolverType();
+    if (solverType == storm::solver::EquationSolverType::Topological) {
+        solverType = env.solver().topological().getUnderlyingEquationSolverType();
+    }
+    return solverType == storm::solver::EquationSolverType::Native && env.solver().native().getMethod() == NativeLinearEquationSolverMethod::Power &&
+           !env.solver().isForceSoundness() && !env.solver().isForceExact();
+}
+
 template class ValueIterationHelper<double, true>;
 template class ValueIterationHelper<double, false>;
 template class ValueIterationHelper<storm::RationalNumber, true>;
@@ -10,6 +10,14 @@
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
 
+namespace storm {
+class Environment;
+
+namespace storage {
+class BitVector;
+}
+}  // namespace storm
+
 namespace storm::solver::helper {
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType = ValueType>
@@ -36,8 +44,40 @@ class ValueIterationHelper {
                     std::optional<storm::OptimizationDirection> const& dir = {}, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
                     MultiplicationStyle mult = MultiplicationStyle::GaussSeidel, bool robust = true) const;
 
+    /*!
+     * Performs value iteration for multiple operands at once, i.e., the operator is applied to all operands in a single sweep over the matrix.
+     * Operands and offsets are stored interleaved, i.e., the entries of all operands for the same row group (or row) are stored consecutively.
+     * Iteration stops as soon as all operands are converged. Updates are performed in Gauss-Seidel style.
+     * @param fixedOperandEntries if given, the (interleaved) operand entries whose bit is set keep their initial value. This allows to consider operands
+     * whose equation systems only differ in the set of states that are solved for.
+     * @note Not supported for interval models.
+     */
+    SolverStatus interleavedVI(std::vector<SolutionType>& operands, std::vector<ValueType> const& offsets, uint64_t numberOfOperands, uint64_t& numIterations,
+                               bool relative, SolutionType const& precision, std::optional<storm::OptimizationDirection> const& dir = {},
+                               std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
+                               storm::storage::BitVector const* fixedOperandEntries = nullptr) const;
+
+    /*!
+     * Performs value iteration for multiple (interleaved) operands at once using the precision, the termination criterion, and the maximal number of
+     * iterations of the native linear equation solver that is selected in the given environment.
+     */
+    SolverStatus interleavedVI(storm::Environment const& env, std::vector<SolutionType>& operands, std::vector<ValueType> const& offsets,
+                               uint64_t numberOfOperands, std::optional<storm::OptimizationDirection> const& dir = {},
+                               storm::storage::BitVector const* fixedOperandEntries = nullptr) const;
+
    private:
+    template<storm::OptimizationDirection Dir, bool Relative>
+    SolverStatus interleavedVI(std::vector<SolutionType>& operands, std::vector<ValueType> const& offsets, uint64_t numberOfOperands, uint64_t& numIterations,
+                               SolutionType const& precision, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+                               storm::storage::BitVector const* fixedOperandEntries) const;
+
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator;
 };
 
+/*!
+ * Retrieves whether the linear equation solver selected in the given environment performs (unsound) power iteration on the fixpoint system.
+ * In this case, multiple equation systems with the same matrix can equivalently be solved at once using ValueIterationHelper::interleavedVI.
+ */
+bool isInterleavedValueIterationApplicable(storm::Environment const& env);
+
 }  // namespace storm::solver::helper
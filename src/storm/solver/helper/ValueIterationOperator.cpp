@@ -1,5 +1,6 @@
 #include "storm/solver/helper/ValueIterationOperator.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -25,6 +26,7 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
     this->backwards = Backward;
     this->hasSkippedRows = false;
     auto const numRows = matrix.getRowCount();
+    updateMemoryReservation(matrix.getNonzeroEntryCount(), matrix.getNonzeroEntryCount() + numRows + 1, auxiliaryVector.capacity());
     matrixValues.clear();
     matrixColumns.clear();
     matrixValues.reserve(matrix.getNonzeroEntryCount());
@@ -55,6 +57,22 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
     }
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+typename ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::RobustOrder
+ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::createRobustOrder() const {
+    RobustOrder result;
+    result.reserve(matrixValues.size());
+    IndexType localIndex = 0;
+    for (auto const& column : matrixColumns) {
+        if (column >= StartOfRowIndicator) {
+            localIndex = 0;
+        } else {
+            result.push_back(localIndex++);
+        }
+    }
+    return result;
+}
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrixForwards(storm::storage::SparseMatrix<ValueType> const& matrix,
                                                                                             std::vector<IndexType> const* rowGroupIndices) {
@@ -129,6 +147,7 @@ template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 std::vector<SolutionType>& ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::allocateAuxiliaryVector(
     uint64_t size, std::optional<SolutionType> const& initialValue) {
     STORM_LOG_ASSERT(!auxiliaryVectorUsedExternally, "Auxiliary vector already in use.");
+    updateMemoryReservation(matrixValues.capacity(), matrixColumns.capacity(), std::max<uint64_t>(size, auxiliaryVector.capacity()));
     if (initialValue) {
         auxiliaryVector.assign(size, *initialValue);
     } else {
@@ -143,6 +162,13 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::freeAu
     auxiliaryVectorUsedExternally = false;
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::updateMemoryReservation(uint64_t numberOfEntries, uint64_t numberOfColumnEntries,
+                                                                                                  uint64_t auxiliaryVectorSize) {
+    uint64_t bytes = numberOfEntries * sizeof(ValueType) + numberOfColumnEntries * sizeof(IndexType) + auxiliaryVectorSize * sizeof(SolutionType);
+    memoryReservation.resize(bytes);
+}
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const {
     do {
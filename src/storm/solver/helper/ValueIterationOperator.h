@@ -1,5 +1,7 @@
 #pragma once
+#include <algorithm>
 #include <functional>
+#include <numeric>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -9,6 +11,7 @@
 
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
 #include "storm/storage/sparse/StateType.h"
+#include "storm/utility/MemoryBudget.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"  // TODO
 
@@ -35,6 +38,14 @@ class ValueIterationOperator {
    public:
     using IndexType = storm::storage::sparse::state_type;
 
+    /*!
+     * Only relevant for interval models: For each row, a permutation of the (local) indices of its entries, sorted ascendingly w.r.t. the operand values of
+     * the most recent robust application of the operator. Has one entry per non-zero matrix entry.
+     * The order is owned by the caller such that the operator can be applied concurrently. Passing the same order to subsequent applications speeds them
+     * up, as the order of the successor values usually changes only slightly.
+     */
+    using RobustOrder = std::vector<IndexType>;
+
     /*!
      * Initializes this operator with the given data
      * @tparam backwards if true, we iterate backwards starting with the largest rowgroup. This often makes in place (Gauss-Seidel) iterations more efficient
@@ -96,19 +107,26 @@ class ValueIterationOperator {
         return applyRobust<OptimizationDirection::Maximize>(operandIn, operandOut, offsets, backend);
     }
 
+    /*!
+     * Same as `apply` but for interval models, where the robust direction determines how the distribution within the intervals is chosen.
+     * @param robustOrder For interval models: the order of the successors to start with, which is updated during the application (see `RobustOrder`).
+     *                    If not given, the successors of each row are sorted from scratch, which is preferable for a single application.
+     */
     template<OptimizationDirection RobustDir, typename OperandType, typename OffsetType, typename BackendType>
-    bool applyRobust(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
+    bool applyRobust(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend,
+                     RobustOrder* robustOrder = nullptr) const {
+        STORM_LOG_ASSERT(robustOrder == nullptr || robustOrder->size() == matrixValues.size(), "The robust order does not fit to the matrix.");
         if (hasSkippedRows) {
             if (backwards) {
-                return apply<OperandType, OffsetType, BackendType, true, true, RobustDir>(operandOut, operandIn, offsets, backend);
+                return apply<OperandType, OffsetType, BackendType, true, true, RobustDir>(operandOut, operandIn, offsets, backend, robustOrder);
             } else {
-                return apply<OperandType, OffsetType, BackendType, false, true, RobustDir>(operandOut, operandIn, offsets, backend);
+                return apply<OperandType, OffsetType, BackendType, false, true, RobustDir>(operandOut, operandIn, offsets, backend, robustOrder);
             }
         } else {
             if (backwards) {
-                return apply<OperandType, OffsetType, BackendType, true, false, RobustDir>(operandOut, operandIn, offsets, backend);
+                return apply<OperandType, OffsetType, BackendType, true, false, RobustDir>(operandOut, operandIn, offsets, backend, robustOrder);
             } else {
-                return apply<OperandType, OffsetType, BackendType, false, false, RobustDir>(operandOut, operandIn, offsets, backend);
+                return apply<OperandType, OffsetType, BackendType, false, false, RobustDir>(operandOut, operandIn, offsets, backend, robustOrder);
             }
         }
     }
@@ -122,8 +140,47 @@ class ValueIterationOperator {
     }
 
     template<OptimizationDirection RobustDir, typename OperandType, typename OffsetType, typename BackendType>
-    bool applyInPlaceRobust(OperandType& operand, OffsetType const& offsets, BackendType& backend) const {
-        return applyRobust<RobustDir>(operand, operand, offsets, backend);
+    bool applyInPlaceRobust(OperandType& operand, OffsetType const& offsets, BackendType& backend, RobustOrder* robustOrder = nullptr) const {
+        return applyRobust<RobustDir>(operand, operand, offsets, backend, robustOrder);
+    }
+
+    /*!
+     * Creates the robust order in which the successors of each row are ordered as in the matrix.
+     */
+    RobustOrder createRobustOrder() const;
+
+    /*!
+     * Applies the operator to multiple operands at once. The operands (and the offsets) are stored interleaved, i.e., the entries of all operands that
+     * belong to the same row group (or row) are stored consecutively. Each matrix entry is thus only loaded once per application, independent of the number
+     * of operands, and the innermost loop over the operands can be vectorized.
+     * The backend is invoked as in `apply`, except that
+     * * backend.firstRow(rowResults, rowGroupIndex, rowIndex) and backend.nextRow(rowResults, rowGroupIndex, rowIndex) get a pointer to the results of
+     *   all operands for the given row and
+     * * backend.applyUpdate(operandOutEntries, rowGroupIndex) gets a pointer to the entries of all operands for the given row group.
+     *
+     * @param operandIn Input operands (interleaved)
+     * @param operandOut Output operands (interleaved)
+     * @param offsets Row offsets for each operand (interleaved)
+     * @param numberOfOperands the number of operands
+     * @param backend the backend
+     * @return whatever backend.converged() returns
+     */
+    template<typename BackendType>
+    bool applyInterleaved(std::vector<SolutionType> const& operandIn, std::vector<SolutionType>& operandOut, std::vector<ValueType> const& offsets,
+                          uint64_t numberOfOperands, BackendType& backend) const {
+        if (hasSkippedRows) {
+            if (backwards) {
+                return applyInterleaved<BackendType, true, true>(operandOut, operandIn, offsets, numberOfOperands, backend);
+            } else {
+                return applyInterleaved<BackendType, false, true>(operandOut, operandIn, offsets, numberOfOperands, backend);
+            }
+        } else {
+            if (backwards) {
+                return applyInterleaved<BackendType, true, false>(operandOut, operandIn, offsets, numberOfOperands, backend);
+            } else {
+                return applyInterleaved<BackendType, false, false>(operandOut, operandIn, offsets, numberOfOperands, backend);
+            }
+        }
     }
 
     /*!
@@ -164,7 +221,7 @@ class ValueIterationOperator {
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
     template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection>
-    bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+    bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend, RobustOrder* robustOrder) const {
         STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
         auto const operandSize = getSize(operandIn);
         STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
@@ -176,17 +233,18 @@ class ValueIterationOperator {
             STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
             //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
             if constexpr (TrivialRowGrouping) {
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
+                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex, robustOrder), groupIndex, groupIndex);
             } else {
                 IndexType rowIndex = (*rowGroupIndices)[groupIndex];
                 if constexpr (SkipIgnoredRows) {
                     rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
                 }
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex, robustOrder), groupIndex, rowIndex);
                 while (*matrixColumnIt < StartOfRowGroupIndicator) {
                     ++rowIndex;
                     if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-                        backend.nextRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                        backend.nextRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex, robustOrder), groupIndex,
+                                        rowIndex);
                     }
                 }
             }
@@ -205,6 +263,70 @@ class ValueIterationOperator {
         return backend.converged();
     }
 
+    /*!
+     * Internal variant of `applyInterleaved`
+     */
+    template<typename BackendType, bool Backward, bool SkipIgnoredRows>
+    bool applyInterleaved(std::vector<SolutionType>& operandOut, std::vector<SolutionType> const& operandIn, std::vector<ValueType> const& offsets,
+                          uint64_t const numberOfOperands, BackendType& backend) const {
+        static_assert(!std::is_same_v<ValueType, storm::Interval>, "Interleaved operands are not supported for interval models.");
+        STORM_LOG_ASSERT(operandIn.size() == operandOut.size(), "Input and Output Operands have different sizes.");
+        STORM_LOG_ASSERT(numberOfOperands > 0 && operandIn.size() % numberOfOperands == 0, "Unexpected size of interleaved operands.");
+        auto const operandSize = operandIn.size() / numberOfOperands;
+        STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
+        std::vector<SolutionType> rowResults(numberOfOperands);
+        backend.startNewIteration();
+        auto matrixValueIt = matrixValues.cbegin();
+        auto matrixColumnIt = matrixColumns.cbegin();
+        for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
+            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+            if constexpr (TrivialRowGrouping) {
+                applyRowInterleaved(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex, rowResults);
+                backend.firstRow(rowResults.data(), groupIndex, groupIndex);
+            } else {
+                IndexType rowIndex = (*rowGroupIndices)[groupIndex];
+                if constexpr (SkipIgnoredRows) {
+                    rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
+                }
+                applyRowInterleaved(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex, rowResults);
+                backend.firstRow(rowResults.data(), groupIndex, rowIndex);
+                while (*matrixColumnIt < StartOfRowGroupIndicator) {
+                    ++rowIndex;
+                    if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
+                        applyRowInterleaved(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex, rowResults);
+                        backend.nextRow(rowResults.data(), groupIndex, rowIndex);
+                    }
+                }
+            }
+            backend.applyUpdate(operandOut.data() + groupIndex * numberOfOperands, groupIndex);
+            if (backend.abort()) {
+                return backend.converged();
+            }
+        }
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Computes the results of all (interleaved) operands for a single row and advances the given iterators to the end of the row
+     */
+    void applyRowInterleaved(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+                             std::vector<SolutionType> const& operand, std::vector<ValueType> const& offsets, uint64_t offsetIndex,
+                             std::vector<SolutionType>& rowResults) const {
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        uint64_t const numberOfOperands = rowResults.size();
+        std::copy_n(offsets.begin() + offsetIndex * numberOfOperands, numberOfOperands, rowResults.begin());
+        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+            auto const* operandEntries = operand.data() + *matrixColumnIt * numberOfOperands;
+            auto const& matrixValue = *matrixValueIt;
+            for (uint64_t operandIndex = 0; operandIndex < numberOfOperands; ++operandIndex) {
+                rowResults[operandIndex] += operandEntries[operandIndex] * matrixValue;
+            }
+        }
+    }
+
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
 
     template<typename OpT, typename OffT>
@@ -250,9 +372,9 @@ class ValueIterationOperator {
      */
     template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
     auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                  OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
+                  OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex, RobustOrder* robustOrder) const {
         if constexpr (std::is_same_v<ValueType, storm::Interval>) {
-            return applyRowRobust<RobustDirection>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
+            return applyRowRobust<RobustDirection>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex, robustOrder);
         } else {
             return applyRowStandard(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
         }
@@ -274,24 +396,20 @@ class ValueIterationOperator {
         return result;
     }
 
-    // Aux function for applyRowRobust
-    template<OptimizationDirection RobustDirection>
-    struct AuxCompare {
-        bool operator()(const std::pair<SolutionType, SolutionType>& a, const std::pair<SolutionType, SolutionType>& b) const {
-            if constexpr (RobustDirection == OptimizationDirection::Maximize) {
-                return a.first > b.first;
-            } else {
-                return a.first < b.first;
-            }
-        }
-    };
-
+    /*!
+     * Computes the result for a single row of an interval model, where the (robust) direction determines whether the distribution within the intervals
+     * is chosen in favour of small or large values. Advances the given iterators to the end of the row.
+     * Each row first gets the lower bounds of its intervals. The remaining probability mass is distributed greedily over the successors in the order of
+     * their values. If a robust order is given, the order of the successors is taken from it and repaired using insertion sort, as the order of values
+     * usually changes only slightly between two applications of the operator. Otherwise, the successors are sorted.
+     */
     template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
     auto applyRowRobust(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                        OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
+                        OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex, RobustOrder* robustOrder) const {
         STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
         auto result{robustInitializeRowRes<RobustDirection>(operand, offsets, offsetIndex)};
-        std::vector<std::pair<SolutionType, SolutionType>> tmp;  // TODO this reallocation is too costly.
+        auto const rowColumnIt = matrixColumnIt + 1;
+        auto const rowValueIt = matrixValueIt;
         SolutionType remainingValue{storm::utility::one<SolutionType>()};
         for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
             if constexpr (isPair<OperandType>::value) {
@@ -301,22 +419,55 @@ class ValueIterationOperator {
                 result += operand[*matrixColumnIt] * (matrixValueIt->lower());
             }
             remainingValue -= matrixValueIt->lower();
-            if (!storm::utility::isZero(matrixValueIt->diameter())) {
-                tmp.emplace_back(operand[*matrixColumnIt], matrixValueIt->diameter());
-            }
         }
         if (storm::utility::isZero(remainingValue) || storm::utility::isOne(remainingValue)) {
             return result;
         }
-        AuxCompare<RobustDirection> compare;
-        std::sort(tmp.begin(), tmp.end(), compare);
-
-        for (auto const& valWidthPair : tmp) {
-            auto availableMass = std::min(valWidthPair.second, remainingValue);
-            result += availableMass * valWidthPair.first;
-            remainingValue -= availableMass;
-            if (storm::utility::isZero(remainingValue)) {
-                return result;
+
+        // Get the (ascending) order of the successor values.
+        RobustOrder rowOrder;
+        typename RobustOrder::iterator orderBegin, orderEnd;
+        if (robustOrder != nullptr) {
+            orderBegin = robustOrder->begin() + std::distance(matrixValues.cbegin(), rowValueIt);
+            orderEnd = orderBegin + std::distance(rowValueIt, matrixValueIt);
+            for (auto orderIt = orderBegin; orderIt != orderEnd; ++orderIt) {
+                IndexType const localIndex = *orderIt;
+                SolutionType const& value = operand[rowColumnIt[localIndex]];
+                auto insertIt = orderIt;
+                for (; insertIt != orderBegin && value < operand[rowColumnIt[*(insertIt - 1)]]; --insertIt) {
+                    *insertIt = *(insertIt - 1);
+                }
+                *insertIt = localIndex;
+            }
+        } else {
+            rowOrder.resize(std::distance(rowValueIt, matrixValueIt));
+            std::iota(rowOrder.begin(), rowOrder.end(), 0);
+            std::sort(rowOrder.begin(), rowOrder.end(),
+                      [&operand, &rowColumnIt](IndexType const lhs, IndexType const rhs) { return operand[rowColumnIt[lhs]] < operand[rowColumnIt[rhs]]; });
+            orderBegin = rowOrder.begin();
+            orderEnd = rowOrder.end();
+        }
+
+        auto distributeMass = [&result, &remainingValue, &operand, &rowColumnIt, &rowValueIt](IndexType const localIndex) {
+            auto const diameter = rowValueIt[localIndex].diameter();
+            if (!storm::utility::isZero(diameter)) {
+                auto availableMass = std::min(diameter, remainingValue);
+                result += availableMass * operand[rowColumnIt[localIndex]];
+                remainingValue -= availableMass;
+            }
+            return storm::utility::isZero(remainingValue);
+        };
+        if constexpr (RobustDirection == OptimizationDirection::Maximize) {
+            for (auto orderIt = orderEnd; orderIt != orderBegin;) {
+                if (distributeMass(*(--orderIt))) {
+                    return result;
+                }
+            }
+        } else {
+            for (auto orderIt = orderBegin; orderIt != orderEnd; ++orderIt) {
+                if (distributeMass(*orderIt)) {
+                    return result;
+                }
             }
         }
         STORM_LOG_ASSERT(storm::utility::isZero(remainingValue), "Should be zero (all prob mass taken)");
@@ -360,6 +511,11 @@ class ValueIterationOperator {
      */
     void moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const;
 
+    /*!
+     * Adjusts the reservation with the memory budget to the given sizes of the internal storage
+     */
+    void updateMemoryReservation(uint64_t numberOfEntries, uint64_t numberOfColumnEntries, uint64_t auxiliaryVectorSize);
+
     /*!
      * Skips the current row, if it is ignored. Advances the iterators accordingly
      */
@@ -407,6 +563,11 @@ class ValueIterationOperator {
      */
     bool auxiliaryVectorUsedExternally{false};
 
+    /*!
+     * The memory that is reserved for the matrix data and the auxiliary vector
+     */
+    storm::utility::resources::MemoryReservation memoryReservation{storm::utility::resources::MemoryCategory::SolverVectors};
+
     /*!
      * Bitmask that indicates the start of a row in the 'matrixColumns' vector
      */
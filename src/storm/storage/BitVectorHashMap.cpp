@@ -43,7 +43,11 @@ std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash
 
 template<class ValueType, class Hash>
 BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
-    : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
+    : loadFactor(loadFactor),
+      bucketSize(bucketSize),
+      currentSize(1),
+      numberOfElements(0),
+      memoryReservation(storm::utility::resources::MemoryCategory::StateStorage) {
     STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
 
     while (initialSize > 0) {
@@ -52,6 +56,7 @@ BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_
     }
 
     // Create the underlying containers.
+    memoryReservation.resize(getStorageSizeInBytes(currentSize));
     buckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
     occupied = storm::storage::BitVector(1ull << currentSize);
     values = std::vector<ValueType>(1ull << currentSize);
@@ -74,6 +79,9 @@ uint64_t BitVectorHashMap<ValueType, Hash>::capacity() const {
 
 template<class ValueType, class Hash>
 void BitVectorHashMap<ValueType, Hash>::increaseSize() {
+    // While rehashing, both the old and the new containers are in memory.
+    memoryReservation.resize(getStorageSizeInBytes(currentSize) + getStorageSizeInBytes(currentSize + 1));
+
     ++currentSize;
     STORM_LOG_TRACE("Increasing size of hash map from " << (1ull << (currentSize - 1)) << " to " << (1ull << currentSize) << ".");
 
@@ -92,6 +100,12 @@ void BitVectorHashMap<ValueType, Hash>::increaseSize() {
         findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
     }
     STORM_LOG_ASSERT(oldSize == numberOfElements, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << numberOfElements << ".");
+    memoryReservation.resize(getStorageSizeInBytes(currentSize));
+}
+
+template<class ValueType, class Hash>
+uint64_t BitVectorHashMap<ValueType, Hash>::getStorageSizeInBytes(uint64_t size) const {
+    return (bucketSize + 1) * (1ull << size) / 8 + (1ull << size) * sizeof(ValueType);
 }
 
 template<class ValueType, class Hash>
@@ -5,6 +5,7 @@
 #include <functional>
 
 #include "storm/storage/BitVector.h"
+#include "storm/utility/MemoryBudget.h"
 
 namespace storm {
 namespace storage {
@@ -197,6 +198,11 @@ class BitVectorHashMap {
      */
     uint64_t getCurrentShiftWidth() const;
 
+    /*!
+     * Retrieves the number of bytes needed for the containers if the map has 2^size buckets.
+     */
+    uint64_t getStorageSizeInBytes(uint64_t size) const;
+
     // The load factor determining when the size of the map is increased.
     double loadFactor;
 
@@ -220,6 +226,9 @@ class BitVectorHashMap {
 
     // Functor object that are used to perform the actual hashing.
     Hash hasher;
+
+    // The memory that is reserved for the containers.
+    storm::utility::resources::MemoryReservation memoryReservation;
 };
 
 }  // namespace storage
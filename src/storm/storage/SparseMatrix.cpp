@@ -4,9 +4,12 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateType.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -17,11 +20,79 @@
 
 #include "storm/utility/macros.h"
 
+#include <functional>
 #include <iterator>
+#include <numeric>
+#include <type_traits>
 
 namespace storm {
 namespace storage {
 
+namespace {
+using storm::utility::parallel::forEachChunk;
+
+// Matrices with fewer entries are always processed sequentially, because the overhead of the threads would dominate.
+uint64_t const minimalEntryCountForParallelization = 1ull << 16;
+
+/*!
+ * Retrieves the number of threads that are to be used for building a submatrix of a matrix with the given number of
+ * entries.
+ */
+template<typename ValueType>
+uint64_t getNumberOfSubmatrixThreads(uint64_t entryCount) {
+    if (!storm::utility::parallel::isThreadSafeValueType<ValueType> || entryCount < minimalEntryCountForParallelization ||
+        !storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()) {
+        return 1;
+    }
+    return storm::utility::parallel::getNumberOfThreads(storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getNumberOfThreads());
+}
+
+/*!
+ * Builds a matrix whose rows are copies of rows of another matrix.
+ *
+ * @param numberOfThreads The number of threads to use.
+ * @param rowCount The number of rows of the resulting matrix.
+ * @param columnCount The number of columns of the resulting matrix.
+ * @param rowGroupIndices If given, the row grouping of the resulting matrix.
+ * @param insertDiagonalEntries If set, a zero entry is inserted at column i of row i unless there already is an entry.
+ * @param getSourceRow A function that retrieves for each row of the resulting matrix the (constant) row that is copied.
+ */
+template<typename ValueType, typename SourceRowFunction>
+SparseMatrix<ValueType> buildFromRowCopies(uint64_t numberOfThreads, SparseMatrixIndexType rowCount, SparseMatrixIndexType columnCount,
+                                           boost::optional<std::vector<SparseMatrixIndexType>>&& rowGroupIndices, bool insertDiagonalEntries,
+                                           SourceRowFunction const& getSourceRow) {
+    TwoPassSparseMatrixBuilder<ValueType> builder(rowCount, columnCount, std::move(rowGroupIndices));
+
+    // Unless diagonal entries need to be inserted, the number of entries of a row is available in constant time.
+    forEachChunk(insertDiagonalEntries ? numberOfThreads : 1, rowCount, [&](uint64_t firstRow, uint64_t lastRow) {
+        for (SparseMatrixIndexType row = firstRow; row < lastRow; ++row) {
+            auto sourceRow = getSourceRow(row);
+            bool insertDiagonalEntry = insertDiagonalEntries && std::none_of(sourceRow.begin(), sourceRow.end(),
+                                                                             [row](auto const& entry) { return entry.getColumn() == row; });
+            builder.setRowEntryCount(row, sourceRow.getNumberOfEntries() + (insertDiagonalEntry ? 1 : 0));
+        }
+    });
+    builder.allocate();
+
+    forEachChunk(numberOfThreads, rowCount, [&](uint64_t firstRow, uint64_t lastRow) {
+        for (SparseMatrixIndexType row = firstRow; row < lastRow; ++row) {
+            auto sourceRow = getSourceRow(row);
+            auto targetIt = builder.begin(row);
+            if (static_cast<SparseMatrixIndexType>(std::distance(targetIt, builder.end(row))) == sourceRow.getNumberOfEntries()) {
+                std::copy(sourceRow.begin(), sourceRow.end(), targetIt);
+            } else {
+                // The diagonal entry is inserted in front of the first entry with a larger column.
+                auto sourceIt = std::find_if(sourceRow.begin(), sourceRow.end(), [row](auto const& entry) { return entry.getColumn() > row; });
+                targetIt = std::copy(sourceRow.begin(), sourceIt, targetIt);
+                *targetIt = MatrixEntry<SparseMatrixIndexType, ValueType>(row, storm::utility::zero<ValueType>());
+                std::copy(sourceIt, sourceRow.end(), ++targetIt);
+            }
+        }
+    });
+    return builder.build();
+}
+}  // namespace
+
 template<typename IndexType, typename ValueType>
 MatrixEntry<IndexType, ValueType>::MatrixEntry(IndexType column, ValueType value) : entry(column, value) {
     // Intentionally left empty.
@@ -98,8 +169,10 @@ SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type
       lastRow(0),
       lastColumn(0),
       highestColumn(0),
-      currentRowGroupCount(0) {
+      currentRowGroupCount(0),
+      memoryReservation(storm::utility::resources::MemoryCategory::MatrixBuilder) {
     // Prepare the internal storage.
+    updateMemoryReservation(initialEntryCount, initialRowCount + 1);
     if (initialRowCountSet) {
         rowIndications.reserve(initialRowCount + 1);
     }
@@ -131,7 +204,8 @@ SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& ma
       columnsAndValues(std::move(matrix.columnsAndValues)),
       rowIndications(std::move(matrix.rowIndications)),
       currentEntryCount(matrix.entryCount),
-      currentRowGroupCount() {
+      currentRowGroupCount(),
+      memoryReservation(storm::utility::resources::MemoryCategory::MatrixBuilder) {
     lastRow = matrix.rowCount == 0 ? 0 : matrix.rowCount - 1;
     lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
     highestColumn = matrix.getColumnCount() == 0 ? 0 : matrix.getColumnCount() - 1;
@@ -195,7 +269,10 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
 
         lastColumn = column;
 
-        // Finally, set the element and increase the current size.
+        // Finally, set the element and increase the current size. If this grows the storage, the memory budget has to permit it.
+        if (columnsAndValues.size() == columnsAndValues.capacity()) {
+            updateMemoryReservation(std::max<index_type>(1, 2 * columnsAndValues.capacity()), rowIndications.capacity());
+        }
         columnsAndValues.emplace_back(column, value);
         highestColumn = std::max(highestColumn, column);
         ++currentEntryCount;
@@ -348,9 +425,16 @@ SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overrid
         }
     }
 
+    // The storage is handed over to the matrix.
+    memoryReservation.resize(0);
     return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
 }
 
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::updateMemoryReservation(index_type entryCapacity, index_type rowCapacity) {
+    memoryReservation.resize(entryCapacity * sizeof(MatrixEntry<index_type, value_type>) + rowCapacity * sizeof(index_type));
+}
+
 template<typename ValueType>
 typename SparseMatrixBuilder<ValueType>::index_type SparseMatrixBuilder<ValueType>::getLastRow() const {
     return lastRow;
@@ -454,6 +538,58 @@ void SparseMatrixBuilder<ValueType>::addDiagonalEntry(index_type row, ValueType
     }
 }
 
+template<typename ValueType>
+TwoPassSparseMatrixBuilder<ValueType>::TwoPassSparseMatrixBuilder(index_type rowCount, index_type columnCount,
+                                                                  boost::optional<std::vector<index_type>>&& rowGroupIndices)
+    : columnCount(columnCount),
+      rowIndications(rowCount + 1, 0),
+      columnsAndValues(),
+      rowGroupIndices(std::move(rowGroupIndices)),
+      allocated(false),
+      memoryReservation(storm::utility::resources::MemoryCategory::MatrixBuilder) {
+    STORM_LOG_ASSERT(!this->rowGroupIndices || (!this->rowGroupIndices->empty() && this->rowGroupIndices->back() == rowCount),
+                     "The row grouping does not match the number of rows.");
+}
+
+template<typename ValueType>
+void TwoPassSparseMatrixBuilder<ValueType>::setRowEntryCount(index_type row, index_type entryCount) {
+    STORM_LOG_ASSERT(!allocated, "Cannot change the number of entries of a row after the storage was allocated.");
+    STORM_LOG_ASSERT(row + 1 < rowIndications.size(), "Row " << row << " is out of range.");
+    rowIndications[row + 1] = entryCount;
+}
+
+template<typename ValueType>
+void TwoPassSparseMatrixBuilder<ValueType>::allocate() {
+    STORM_LOG_ASSERT(!allocated, "The storage was already allocated.");
+    std::partial_sum(rowIndications.begin(), rowIndications.end(), rowIndications.begin());
+    memoryReservation.resize(rowIndications.back() * sizeof(MatrixEntry<index_type, value_type>) + rowIndications.size() * sizeof(index_type));
+    columnsAndValues.resize(rowIndications.back());
+    allocated = true;
+}
+
+template<typename ValueType>
+typename TwoPassSparseMatrixBuilder<ValueType>::iterator TwoPassSparseMatrixBuilder<ValueType>::begin(index_type row) {
+    STORM_LOG_ASSERT(allocated, "The storage has not been allocated yet.");
+    return columnsAndValues.begin() + rowIndications[row];
+}
+
+template<typename ValueType>
+typename TwoPassSparseMatrixBuilder<ValueType>::iterator TwoPassSparseMatrixBuilder<ValueType>::end(index_type row) {
+    STORM_LOG_ASSERT(allocated, "The storage has not been allocated yet.");
+    return columnsAndValues.begin() + rowIndications[row + 1];
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> TwoPassSparseMatrixBuilder<ValueType>::build() {
+    if (!allocated) {
+        std::fill(rowIndications.begin(), rowIndications.end(), 0);
+        allocated = true;
+    }
+    // The storage is handed over to the matrix.
+    memoryReservation.resize(0);
+    return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+}
+
 template<typename ValueType>
 SparseMatrix<ValueType>::rows::rows(iterator begin, index_type entryCount) : beginIterator(begin), entryCount(entryCount) {
     // Intentionally left empty.
@@ -1168,72 +1304,75 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(storm::storage::Bi
     // Start by creating a temporary vector that stores for each index whose bit is set to true the number of
     // bits that were set before that particular index.
     std::vector<index_type> columnBitsSetBeforeIndex = columnConstraint.getNumberOfSetBitsBeforeIndices();
-    std::unique_ptr<std::vector<index_type>> tmp;
-    if (rowGroupConstraint != columnConstraint) {
-        tmp = std::make_unique<std::vector<index_type>>(rowGroupConstraint.getNumberOfSetBitsBeforeIndices());
-    }
-    std::vector<index_type> const& rowBitsSetBeforeIndex = tmp ? *tmp : columnBitsSetBeforeIndex;
-
-    // Then, we need to determine the number of entries and the number of rows of the submatrix.
-    index_type subEntries = 0;
-    index_type subRows = 0;
-    index_type rowGroupCount = 0;
-    for (auto index : rowGroupConstraint) {
-        subRows += rowGroupIndices[index + 1] - rowGroupIndices[index];
-        for (index_type i = rowGroupIndices[index]; i < rowGroupIndices[index + 1]; ++i) {
-            bool foundDiagonalElement = false;
-
-            for (const_iterator it = this->begin(i), ite = this->end(i); it != ite; ++it) {
-                if (columnConstraint.get(it->getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(it->getColumn()))) {
-                    ++subEntries;
-
-                    if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
-                        foundDiagonalElement = true;
-                    }
-                }
-            }
+    bool const hasZeroColumns = makeZeroColumns.size() != 0;
 
-            // If requested, we need to reserve one entry more for inserting the diagonal zero entry.
-            if (insertDiagonalEntries && !foundDiagonalElement && rowGroupCount < submatrixColumnCount) {
-                ++subEntries;
-            }
-        }
-        ++rowGroupCount;
+    // Determine the selected row groups and the first row of each of them in the submatrix.
+    std::vector<index_type> selectedRowGroups(rowGroupConstraint.begin(), rowGroupConstraint.end());
+    std::vector<index_type> newRowGroupIndices;
+    newRowGroupIndices.reserve(selectedRowGroups.size() + 1);
+    newRowGroupIndices.push_back(0);
+    for (auto rowGroup : selectedRowGroups) {
+        newRowGroupIndices.push_back(newRowGroupIndices.back() + rowGroupIndices[rowGroup + 1] - rowGroupIndices[rowGroup]);
     }
 
-    // Create and initialize resulting matrix.
-    SparseMatrixBuilder<ValueType> matrixBuilder(subRows, submatrixColumnCount, subEntries, true, !this->hasTrivialRowGrouping());
-
-    // Copy over selected entries.
-    rowGroupCount = 0;
-    index_type rowCount = 0;
-    subEntries = 0;
-    for (auto index : rowGroupConstraint) {
-        if (!this->hasTrivialRowGrouping()) {
-            matrixBuilder.newRowGroup(rowCount);
-        }
-        for (index_type i = rowGroupIndices[index]; i < rowGroupIndices[index + 1]; ++i) {
-            bool insertedDiagonalElement = false;
-
-            for (const_iterator it = this->begin(i), ite = this->end(i); it != ite; ++it) {
-                if (columnConstraint.get(it->getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(it->getColumn()))) {
-                    if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
-                        insertedDiagonalElement = true;
-                    } else if (insertDiagonalEntries && !insertedDiagonalElement && columnBitsSetBeforeIndex[it->getColumn()] > rowBitsSetBeforeIndex[index]) {
-                        matrixBuilder.addNextValue(rowCount, rowGroupCount, storm::utility::zero<ValueType>());
-                        insertedDiagonalElement = true;
+    // Calls the given function for all entries of the submatrix row that corresponds to the given row. The diagonal
+    // entry of the submatrix row is in the column that corresponds to the index of the row group in the submatrix.
+    auto forEachSubmatrixEntry = [&](index_type row, index_type diagonalColumn, auto const& function) {
+        bool insertedDiagonalElement = !insertDiagonalEntries || diagonalColumn >= submatrixColumnCount;
+        for (auto const& entry : this->getRow(row)) {
+            if (columnConstraint.get(entry.getColumn()) && (!hasZeroColumns || !makeZeroColumns.get(entry.getColumn()))) {
+                index_type column = columnBitsSetBeforeIndex[entry.getColumn()];
+                if (!insertedDiagonalElement && column >= diagonalColumn) {
+                    if (column > diagonalColumn) {
+                        function(diagonalColumn, storm::utility::zero<ValueType>());
                     }
-                    ++subEntries;
-                    matrixBuilder.addNextValue(rowCount, columnBitsSetBeforeIndex[it->getColumn()], it->getValue());
+                    insertedDiagonalElement = true;
                 }
+                function(column, entry.getValue());
             }
-            if (insertDiagonalEntries && !insertedDiagonalElement && rowGroupCount < submatrixColumnCount) {
-                matrixBuilder.addNextValue(rowCount, rowGroupCount, storm::utility::zero<ValueType>());
-            }
-            ++rowCount;
         }
-        ++rowGroupCount;
-    }
+        if (!insertedDiagonalElement) {
+            function(diagonalColumn, storm::utility::zero<ValueType>());
+        }
+    };
+
+    // Calls the given function for all selected rows together with their index in the submatrix and the index of
+    // their row group in the submatrix. The row groups are distributed among the threads.
+    uint64_t numberOfThreads = getNumberOfSubmatrixThreads<ValueType>(this->getEntryCount());
+    auto forEachSelectedRow = [&](auto const& function) {
+        forEachChunk(numberOfThreads, selectedRowGroups.size(), [&](uint64_t firstRowGroup, uint64_t lastRowGroup) {
+            for (index_type newRowGroup = firstRowGroup; newRowGroup < lastRowGroup; ++newRowGroup) {
+                index_type newRow = newRowGroupIndices[newRowGroup];
+                for (index_type row = rowGroupIndices[selectedRowGroups[newRowGroup]]; row < rowGroupIndices[selectedRowGroups[newRowGroup] + 1];
+                     ++row, ++newRow) {
+                    function(row, newRow, newRowGroup);
+                }
+            }
+        });
+    };
+
+    boost::optional<std::vector<index_type>> submatrixRowGroupIndices;
+    if (!this->hasTrivialRowGrouping()) {
+        submatrixRowGroupIndices = newRowGroupIndices;
+    }
+    TwoPassSparseMatrixBuilder<ValueType> matrixBuilder(newRowGroupIndices.back(), submatrixColumnCount, std::move(submatrixRowGroupIndices));
+
+    // First, count the entries of each row so that the matrix can be allocated with its final size.
+    forEachSelectedRow([&](index_type row, index_type newRow, index_type newRowGroup) {
+        index_type entryCount = 0;
+        forEachSubmatrixEntry(row, newRowGroup, [&entryCount](index_type, ValueType const&) { ++entryCount; });
+        matrixBuilder.setRowEntryCount(newRow, entryCount);
+    });
+    matrixBuilder.allocate();
+
+    // Then, copy over the selected entries.
+    forEachSelectedRow([&](index_type row, index_type newRow, index_type newRowGroup) {
+        auto entryIt = matrixBuilder.begin(newRow);
+        forEachSubmatrixEntry(row, newRowGroup, [&entryIt](index_type column, ValueType const& value) {
+            *entryIt = MatrixEntry<index_type, ValueType>(column, value);
+            ++entryIt;
+        });
+    });
 
     return matrixBuilder.build();
 }
@@ -1242,69 +1381,35 @@ template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::restrictRows(storm::storage::BitVector const& rowsToKeep, bool allowEmptyRowGroups) const {
     STORM_LOG_ASSERT(rowsToKeep.size() == this->getRowCount(), "Dimensions mismatch.");
 
-    // Count the number of entries of the resulting matrix
-    index_type entryCount = 0;
-    for (auto row : rowsToKeep) {
-        entryCount += this->getRow(row).getNumberOfEntries();
-    }
-
-    // Get the smallest row group index such that all row groups with at least this index are empty.
-    index_type firstTrailingEmptyRowGroup = this->getRowGroupCount();
-    for (auto groupIndexIt = this->getRowGroupIndices().rbegin() + 1; groupIndexIt != this->getRowGroupIndices().rend(); ++groupIndexIt) {
-        if (rowsToKeep.getNextSetIndex(*groupIndexIt) != rowsToKeep.size()) {
-            break;
-        }
-        --firstTrailingEmptyRowGroup;
-    }
-    STORM_LOG_THROW(allowEmptyRowGroups || firstTrailingEmptyRowGroup == this->getRowGroupCount(), storm::exceptions::InvalidArgumentException,
-                    "Empty rows are not allowed, but row group " << firstTrailingEmptyRowGroup << " is empty.");
-
-    // build the matrix. The row grouping will always be considered as nontrivial.
-    SparseMatrixBuilder<ValueType> builder(rowsToKeep.getNumberOfSetBits(), this->getColumnCount(), entryCount, true, true, this->getRowGroupCount());
+    // Determine the row grouping of the resulting matrix. The row grouping will always be considered as nontrivial.
+    std::vector<index_type> selectedRows(rowsToKeep.begin(), rowsToKeep.end());
+    std::vector<index_type> newRowGroupIndices;
+    newRowGroupIndices.reserve(this->getRowGroupCount() + 1);
     index_type newRow = 0;
-    for (index_type rowGroup = 0; rowGroup < firstTrailingEmptyRowGroup; ++rowGroup) {
-        // Add a new row group
-        builder.newRowGroup(newRow);
-        bool rowGroupEmpty = true;
-        for (index_type row = rowsToKeep.getNextSetIndex(this->getRowGroupIndices()[rowGroup]); row < this->getRowGroupIndices()[rowGroup + 1];
-             row = rowsToKeep.getNextSetIndex(row + 1)) {
-            rowGroupEmpty = false;
-            for (auto const& entry : this->getRow(row)) {
-                builder.addNextValue(newRow, entry.getColumn(), entry.getValue());
-            }
+    for (index_type rowGroup = 0; rowGroup < this->getRowGroupCount(); ++rowGroup) {
+        newRowGroupIndices.push_back(newRow);
+        while (newRow < selectedRows.size() && selectedRows[newRow] < this->getRowGroupIndices()[rowGroup + 1]) {
             ++newRow;
         }
-        STORM_LOG_THROW(allowEmptyRowGroups || !rowGroupEmpty, storm::exceptions::InvalidArgumentException,
+        STORM_LOG_THROW(allowEmptyRowGroups || newRowGroupIndices.back() != newRow, storm::exceptions::InvalidArgumentException,
                         "Empty rows are not allowed, but row group " << rowGroup << " is empty.");
     }
+    newRowGroupIndices.push_back(newRow);
 
-    // The all remaining row groups will be empty. Note that it is not allowed to call builder.addNewGroup(...) if there are no more rows afterwards.
-    SparseMatrix<ValueType> res = builder.build();
-    return res;
+    return buildFromRowCopies<ValueType>(getNumberOfSubmatrixThreads<ValueType>(this->getEntryCount()), selectedRows.size(), this->getColumnCount(),
+                                         std::move(newRowGroupIndices), false, [&](index_type row) { return this->getRow(selectedRows[row]); });
 }
 
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::filterEntries(storm::storage::BitVector const& rowFilter) const {
-    // Count the number of entries in the resulting matrix.
-    index_type entryCount = 0;
-    for (auto row : rowFilter) {
-        entryCount += getRow(row).getNumberOfEntries();
-    }
-
-    // Build the resulting matrix.
-    SparseMatrixBuilder<ValueType> builder(getRowCount(), getColumnCount(), entryCount);
-    for (auto row : rowFilter) {
-        for (auto const& entry : getRow(row)) {
-            builder.addNextValue(row, entry.getColumn(), entry.getValue());
-        }
-    }
-    SparseMatrix<ValueType> result = builder.build();
-
-    // Add a row grouping if necessary.
+    // Rows that are not selected by the filter are empty. A row grouping is added if necessary.
+    boost::optional<std::vector<index_type>> newRowGroupIndices;
     if (!hasTrivialRowGrouping()) {
-        result.setRowGroupIndices(getRowGroupIndices());
+        newRowGroupIndices = getRowGroupIndices();
     }
-    return result;
+    return buildFromRowCopies<ValueType>(getNumberOfSubmatrixThreads<ValueType>(this->getEntryCount()), getRowCount(), getColumnCount(),
+                                         std::move(newRowGroupIndices), false,
+                                         [&](index_type row) { return rowFilter.get(row) ? this->getRow(row) : this->getRows(row, row); });
 }
 
 template<typename ValueType>
@@ -1331,119 +1436,26 @@ void SparseMatrix<ValueType>::dropZeroEntries() {
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping,
                                                                          bool insertDiagonalEntries) const {
-    // First, we need to count how many non-zero entries the resulting matrix will have and reserve space for
-    // diagonal entries if requested.
-    index_type subEntries = 0;
-    for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
-        // Determine which row we need to select from the current row group.
-        index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
-
-        // Iterate through that row and count the number of slots we have to reserve for copying.
-        bool foundDiagonalElement = false;
-        for (const_iterator it = this->begin(rowToCopy), ite = this->end(rowToCopy); it != ite; ++it) {
-            if (it->getColumn() == rowGroupIndex) {
-                foundDiagonalElement = true;
-            }
-            ++subEntries;
-        }
-        if (insertDiagonalEntries && !foundDiagonalElement) {
-            ++subEntries;
-        }
-    }
-
-    // Now create the matrix to be returned with the appropriate size.
-    SparseMatrixBuilder<ValueType> matrixBuilder(rowGroupIndices.get().size() - 1, columnCount, subEntries);
-
-    // Copy over the selected lines from the source matrix.
-    for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
-        // Determine which row we need to select from the current row group.
-        index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
-
-        // Iterate through that row and copy the entries. This also inserts a zero element on the diagonal if
-        // there is no entry yet.
-        bool insertedDiagonalElement = false;
-        for (const_iterator it = this->begin(rowToCopy), ite = this->end(rowToCopy); it != ite; ++it) {
-            if (it->getColumn() == rowGroupIndex) {
-                insertedDiagonalElement = true;
-            } else if (insertDiagonalEntries && !insertedDiagonalElement && it->getColumn() > rowGroupIndex) {
-                matrixBuilder.addNextValue(rowGroupIndex, rowGroupIndex, storm::utility::zero<ValueType>());
-                insertedDiagonalElement = true;
-            }
-            matrixBuilder.addNextValue(rowGroupIndex, it->getColumn(), it->getValue());
-        }
-        if (insertDiagonalEntries && !insertedDiagonalElement) {
-            matrixBuilder.addNextValue(rowGroupIndex, rowGroupIndex, storm::utility::zero<ValueType>());
-        }
-    }
-
-    // Finalize created matrix and return result.
-    return matrixBuilder.build();
+    STORM_LOG_ASSERT(rowGroupToRowIndexMapping.size() == this->getRowGroupCount(), "Dimensions mismatch.");
+    // The row grouping is retrieved upfront as it might be created on-the-fly.
+    std::vector<index_type> const& groupIndices = this->getRowGroupIndices();
+    return buildFromRowCopies<ValueType>(getNumberOfSubmatrixThreads<ValueType>(this->getEntryCount()), this->getRowGroupCount(), columnCount, boost::none,
+                                         insertDiagonalEntries,
+                                         [&](index_type rowGroup) { return this->getRow(groupIndices[rowGroup] + rowGroupToRowIndexMapping[rowGroup]); });
 }
 
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowIndexSequence(std::vector<index_type> const& rowIndexSequence,
                                                                                 bool insertDiagonalEntries) const {
-    // First, we need to count how many non-zero entries the resulting matrix will have and reserve space for
-    // diagonal entries if requested.
-    index_type newEntries = 0;
-    for (index_type row = 0, rowEnd = rowIndexSequence.size(); row < rowEnd; ++row) {
-        bool foundDiagonalElement = false;
-        for (const_iterator it = this->begin(rowIndexSequence[row]), ite = this->end(rowIndexSequence[row]); it != ite; ++it) {
-            if (it->getColumn() == row) {
-                foundDiagonalElement = true;
-            }
-            ++newEntries;
-        }
-        if (insertDiagonalEntries && !foundDiagonalElement) {
-            ++newEntries;
-        }
-    }
-
-    // Now create the matrix to be returned with the appropriate size.
-    SparseMatrixBuilder<ValueType> matrixBuilder(rowIndexSequence.size(), columnCount, newEntries);
-
-    // Copy over the selected rows from the source matrix.
-    for (index_type row = 0, rowEnd = rowIndexSequence.size(); row < rowEnd; ++row) {
-        bool insertedDiagonalElement = false;
-        for (const_iterator it = this->begin(rowIndexSequence[row]), ite = this->end(rowIndexSequence[row]); it != ite; ++it) {
-            if (it->getColumn() == row) {
-                insertedDiagonalElement = true;
-            } else if (insertDiagonalEntries && !insertedDiagonalElement && it->getColumn() > row) {
-                matrixBuilder.addNextValue(row, row, storm::utility::zero<ValueType>());
-                insertedDiagonalElement = true;
-            }
-            matrixBuilder.addNextValue(row, it->getColumn(), it->getValue());
-        }
-        if (insertDiagonalEntries && !insertedDiagonalElement) {
-            matrixBuilder.addNextValue(row, row, storm::utility::zero<ValueType>());
-        }
-    }
-
-    // Finally create matrix and return result.
-    return matrixBuilder.build();
+    return buildFromRowCopies<ValueType>(getNumberOfSubmatrixThreads<ValueType>(this->getEntryCount()), rowIndexSequence.size(), columnCount, boost::none,
+                                         insertDiagonalEntries, [&](index_type row) { return this->getRow(rowIndexSequence[row]); });
 }
 
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_type> const& inversePermutation) const {
-    // Now create the matrix to be returned with the appropriate size.
-    // The entry size is only adequate if this is indeed a permutation.
-    SparseMatrixBuilder<ValueType> matrixBuilder(inversePermutation.size(), columnCount, entryCount);
-
-    // Copy over the selected rows from the source matrix.
-
-    for (index_type writeTo = 0; writeTo < inversePermutation.size(); ++writeTo) {
-        index_type const& readFrom = inversePermutation[writeTo];
-        auto row = this->getRow(readFrom);
-        for (auto const& entry : row) {
-            matrixBuilder.addNextValue(writeTo, entry.getColumn(), entry.getValue());
-        }
-    }
-    // Finally create matrix and return result.
-    auto result = matrixBuilder.build();
-    if (this->rowGroupIndices) {
-        result.setRowGroupIndices(this->rowGroupIndices.get());
-    }
-    return result;
+    return buildFromRowCopies<ValueType>(getNumberOfSubmatrixThreads<ValueType>(this->getEntryCount()), inversePermutation.size(), columnCount,
+                                         boost::optional<std::vector<index_type>>(this->rowGroupIndices), false,
+                                         [&](index_type row) { return this->getRow(inversePermutation[row]); });
 }
 
 template<typename ValueType>
@@ -2609,6 +2621,7 @@ std::size_t SparseMatrix<ValueType>::hash() const {
 template class MatrixEntry<typename SparseMatrix<double>::index_type, double>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<double>::index_type, double> const& entry);
 template class SparseMatrixBuilder<double>;
+template class TwoPassSparseMatrixBuilder<double>;
 template class SparseMatrix<double>;
 template std::ostream& operator<<(std::ostream& out, SparseMatrix<double> const& matrix);
 template double SparseMatrix<double>::getPointwiseProductRowSum(storm::storage::SparseMatrix<double> const& otherMatrix,
@@ -2623,6 +2636,7 @@ template std::ostream& operator<<(std::ostream& out, MatrixEntry<uint32_t, doubl
 template class MatrixEntry<typename SparseMatrix<int>::index_type, int>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<int>::index_type, int> const& entry);
 template class SparseMatrixBuilder<int>;
+template class TwoPassSparseMatrixBuilder<int>;
 template class SparseMatrix<int>;
 template std::ostream& operator<<(std::ostream& out, SparseMatrix<int> const& matrix);
 template bool SparseMatrix<int>::isSubmatrixOf(SparseMatrix<int> const& matrix) const;
@@ -2632,6 +2646,7 @@ template class MatrixEntry<typename SparseMatrix<storm::storage::sparse::state_t
 template std::ostream& operator<<(
     std::ostream& out, MatrixEntry<typename SparseMatrix<storm::storage::sparse::state_type>::index_type, storm::storage::sparse::state_type> const& entry);
 template class SparseMatrixBuilder<storm::storage::sparse::state_type>;
+template class TwoPassSparseMatrixBuilder<storm::storage::sparse::state_type>;
 template class SparseMatrix<storm::storage::sparse::state_type>;
 template std::ostream& operator<<(std::ostream& out, SparseMatrix<storm::storage::sparse::state_type> const& matrix);
 template bool SparseMatrix<int>::isSubmatrixOf(SparseMatrix<storm::storage::sparse::state_type> const& matrix) const;
@@ -2643,6 +2658,7 @@ template bool SparseMatrix<int>::isSubmatrixOf(SparseMatrix<storm::storage::spar
 template class MatrixEntry<typename SparseMatrix<ClnRationalNumber>::index_type, ClnRationalNumber>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<ClnRationalNumber>::index_type, ClnRationalNumber> const& entry);
 template class SparseMatrixBuilder<ClnRationalNumber>;
+template class TwoPassSparseMatrixBuilder<ClnRationalNumber>;
 template class SparseMatrix<ClnRationalNumber>;
 template std::ostream& operator<<(std::ostream& out, SparseMatrix<ClnRationalNumber> const& matrix);
 template storm::ClnRationalNumber SparseMatrix<storm::ClnRationalNumber>::getPointwiseProductRowSum(
@@ -2656,6 +2672,7 @@ template bool SparseMatrix<storm::ClnRationalNumber>::isSubmatrixOf(SparseMatrix
 template class MatrixEntry<typename SparseMatrix<GmpRationalNumber>::index_type, GmpRationalNumber>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<GmpRationalNumber>::index_type, GmpRationalNumber> const& entry);
 template class SparseMatrixBuilder<GmpRationalNumber>;
+template class TwoPassSparseMatrixBuilder<GmpRationalNumber>;
 template class SparseMatrix<GmpRationalNumber>;
 template std::ostream& operator<<(std::ostream& out, SparseMatrix<GmpRationalNumber> const& matrix);
 template storm::GmpRationalNumber SparseMatrix<storm::GmpRationalNumber>::getPointwiseProductRowSum(
@@ -2669,6 +2686,7 @@ template bool SparseMatrix<storm::GmpRationalNumber>::isSubmatrixOf(SparseMatrix
 template class MatrixEntry<typename SparseMatrix<RationalFunction>::index_type, RationalFunction>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<RationalFunction>::index_type, RationalFunction> const& entry);
 template class SparseMatrixBuilder<RationalFunction>;
+template class TwoPassSparseMatrixBuilder<RationalFunction>;
 template class SparseMatrix<RationalFunction>;
 template std::ostream& operator<<(std::ostream& out, SparseMatrix<RationalFunction> const& matrix);
 template storm::RationalFunction SparseMatrix<storm::RationalFunction>::getPointwiseProductRowSum(
@@ -2691,6 +2709,7 @@ template std::vector<storm::Interval> SparseMatrix<double>::getPointwiseProductR
 template class MatrixEntry<typename SparseMatrix<Interval>::index_type, Interval>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<Interval>::index_type, Interval> const& entry);
 template class SparseMatrixBuilder<Interval>;
+template class TwoPassSparseMatrixBuilder<Interval>;
 template class SparseMatrix<Interval>;
 template std::ostream& operator<<(std::ostream& out, SparseMatrix<Interval> const& matrix);
 template std::vector<storm::Interval> SparseMatrix<Interval>::getPointwiseProductRowSumVector(
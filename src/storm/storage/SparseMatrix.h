@@ -15,6 +15,7 @@
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/MemoryBudget.h"
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/constants.h"
 
@@ -250,6 +251,12 @@ class SparseMatrixBuilder {
     void addDiagonalEntry(index_type row, ValueType const& value);
 
    private:
+    /*!
+     * Adjusts the reservation with the memory budget to the given capacities of the internal storage. This is to be
+     * called before the storage is actually (re-)allocated.
+     */
+    void updateMemoryReservation(index_type entryCapacity, index_type rowCapacity);
+
     // A flag indicating whether a row count was set upon construction.
     bool initialRowCountSet;
 
@@ -312,6 +319,67 @@ class SparseMatrixBuilder {
     index_type currentRowGroupCount;
 
     boost::optional<ValueType> pendingDiagonalEntry;
+
+    // The memory that is reserved for the internal storage.
+    storm::utility::resources::MemoryReservation memoryReservation;
+};
+
+/*!
+ * A class that builds a sparse matrix in two passes: First, the number of entries of every row is set. Then, the
+ * storage is allocated with exactly the required size and the entries of the rows are written in place. As opposed to
+ * the SparseMatrixBuilder, no intermediate storage is required and the rows can be filled in any order (in particular,
+ * different rows may be filled concurrently).
+ */
+template<typename ValueType>
+class TwoPassSparseMatrixBuilder {
+   public:
+    typedef SparseMatrixIndexType index_type;
+    typedef ValueType value_type;
+    typedef typename std::vector<MatrixEntry<index_type, value_type>>::iterator iterator;
+
+    /*!
+     * Constructs a builder for a matrix with the given dimensions in which all rows are initially empty.
+     *
+     * @param rowCount The number of rows of the resulting matrix.
+     * @param columnCount The number of columns of the resulting matrix.
+     * @param rowGroupIndices If given, the row grouping of the resulting matrix.
+     */
+    TwoPassSparseMatrixBuilder(index_type rowCount, index_type columnCount, boost::optional<std::vector<index_type>>&& rowGroupIndices = boost::none);
+
+    /*!
+     * Sets the number of entries of the given row. This must be called before the storage is allocated.
+     */
+    void setRowEntryCount(index_type row, index_type entryCount);
+
+    /*!
+     * Allocates the storage for the entries. Afterwards, the row entry counts can no longer be changed.
+     */
+    void allocate();
+
+    /*!
+     * Retrieves iterators to the storage of the entries of the given row. The storage has to be allocated and the
+     * entries of the row have to be written ordered by column.
+     */
+    iterator begin(index_type row);
+    iterator end(index_type row);
+
+    /*!
+     * Finalizes the matrix. If the storage was not yet allocated, all rows are empty.
+     */
+    SparseMatrix<value_type> build();
+
+   private:
+    index_type columnCount;
+
+    // Before the allocation, the entry i+1 holds the number of entries of row i. Afterwards, it holds the usual row
+    // indications of the matrix.
+    std::vector<index_type> rowIndications;
+    std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
+    boost::optional<std::vector<index_type>> rowGroupIndices;
+    bool allocated;
+
+    // The memory that is reserved for the internal storage.
+    storm::utility::resources::MemoryReservation memoryReservation;
 };
 
 /*!
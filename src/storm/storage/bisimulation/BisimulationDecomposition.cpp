@@ -1,5 +1,6 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
+#include <algorithm>
 #include <chrono>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -20,11 +21,13 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -60,10 +63,18 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      signatureRefinement(false),
+      numberOfThreads(1),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
-    // Intentionally left empty.
+    if (storm::settings::hasModule<storm::settings::modules::BisimulationSettings>()) {
+        signatureRefinement = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getSparseRefinementMode() ==
+                              storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+    }
+    if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()) {
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getNumberOfThreads();
+    }
 }
 
 template<typename ModelType, typename BlockDataType>
@@ -223,7 +234,11 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
     this->initialize();
 
     std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-    this->performPartitionRefinement();
+    if (options.signatureRefinement) {
+        this->performSignatureRefinement();
+    } else {
+        this->performPartitionRefinement();
+    }
     std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
 
     std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -288,6 +303,44 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+    this->initializeSignatureRefinement();
+
+    uint64_t const numberOfStates = model.getNumberOfStates();
+    // The signatures contain copies of the transition probabilities, so they can only be computed concurrently if the value type permits it.
+    uint64_t const numberOfThreads = storm::utility::parallel::isThreadSafeValueType<ValueType> ? options.numberOfThreads : 1;
+
+    uint_fast64_t iterations = 0;
+    bool partitionChanged = true;
+    while (partitionChanged) {
+        ++iterations;
+
+        // First, compute the signatures of all states wrt. the current partition.
+        storm::utility::parallel::forEachChunk(numberOfThreads, numberOfStates,
+                                               [this](uint64_t firstState, uint64_t lastState) { this->computeSignatures(firstState, lastState); });
+
+        // Then split all blocks according to the signatures. Since new blocks are appended to the list of blocks
+        // and are already stable wrt. the signatures, we only need to consider the blocks that existed before.
+        partitionChanged = false;
+        std::size_t numberOfBlocks = partition.size();
+        for (uint_fast64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+            Block<BlockDataType>& block = *partition.getBlocks()[blockIndex];
+            if (block.getNumberOfStates() > 1 && !block.data().absorbing()) {
+                partitionChanged |= this->splitBlockBasedOnSignatures(block);
+            }
+        }
+        STORM_LOG_TRACE("Partition has " << partition.size() << " blocks after " << iterations << " rounds of signature-based refinement.");
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " rounds of signature-based partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+            break;
+        }
+    }
+    STORM_LOG_DEBUG("Signature-based refinement reached a fixpoint after " << iterations << " rounds.");
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
@@ -126,6 +126,13 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// A flag that indicates whether the partition is refined by computing the signatures of all states in rounds
+        /// (instead of considering one splitter at a time).
+        bool signatureRefinement;
+
+        /// The number of threads used to compute the signatures in signature-based refinement (zero means 'auto-detect').
+        uint64_t numberOfThreads;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -208,6 +215,36 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement on the model by repeatedly computing the signatures of all states wrt. the
+     * current partition (in parallel) and splitting all blocks according to these signatures until a fixpoint is
+     * reached. The result is the same partition as the one obtained by performPartitionRefinement().
+     */
+    void performSignatureRefinement();
+
+    /*!
+     * Prepares the data structures needed for computing signatures. It is called once before the first round of
+     * signature-based refinement.
+     */
+    virtual void initializeSignatureRefinement() = 0;
+
+    /*!
+     * Computes the signatures of all states in the given range wrt. the current partition. This may be called
+     * concurrently for disjoint ranges, so implementations must only write data associated with these states.
+     *
+     * @param firstState The first state of the range.
+     * @param lastState The first state after the range.
+     */
+    virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) = 0;
+
+    /*!
+     * Splits the given block according to the signatures computed last.
+     *
+     * @param block The block to split.
+     * @return True iff the block was split.
+     */
+    virtual bool splitBlockBasedOnSignatures(bisimulation::Block<BlockDataType>& block) = 0;
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
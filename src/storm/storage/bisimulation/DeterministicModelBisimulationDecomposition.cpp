@@ -592,6 +592,114 @@ void DeterministicModelBisimulationDecomposition<ModelType>::refinePartitionBase
     }
 }
 
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::initializeSignatureRefinement() {
+    signatures.resize(this->model.getNumberOfStates());
+}
+
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::computeSignatures(storm::storage::sparse::state_type firstState,
+                                                                               storm::storage::sparse::state_type lastState) {
+    bool weakDtmc = this->options.getType() == BisimulationType::Weak && this->model.getType() == storm::models::ModelType::Dtmc;
+    for (storm::storage::sparse::state_type state = firstState; state < lastState; ++state) {
+        Block<BlockDataType> const& block = this->partition.getBlock(state);
+        storm::storage::Distribution<ValueType>& signature = signatures[state];
+        signature = storm::storage::Distribution<ValueType>();
+
+        // Absorbing blocks are never split, so we do not need the signatures of their states.
+        if (block.data().absorbing()) {
+            continue;
+        }
+
+        // For weak bisimulation, moving within the block is not observable (unless the block has rewards).
+        bool ignoreOwnBlock = this->options.getType() == BisimulationType::Weak && !block.data().hasRewards();
+        ValueType silentProbability = storm::utility::zero<ValueType>();
+        if (weakDtmc) {
+            for (auto const& successorEntry : this->model.getRows(state)) {
+                if (this->partition.getBlock(successorEntry.getColumn()) == block) {
+                    silentProbability += successorEntry.getValue();
+                }
+            }
+            silentProbabilities[state] = silentProbability;
+        }
+
+        for (auto const& successorEntry : this->model.getRows(state)) {
+            if (this->comparator.isZero(successorEntry.getValue())) {
+                continue;
+            }
+            Block<BlockDataType> const& successorBlock = this->partition.getBlock(successorEntry.getColumn());
+            if (ignoreOwnBlock && successorBlock == block) {
+                continue;
+            }
+
+            // For weak bisimulation on DTMCs, the non-silent states are compared wrt. their conditional probabilities
+            // of leaving the block.
+            if (weakDtmc && ignoreOwnBlock) {
+                signature.addProbability(successorBlock.getId(), successorEntry.getValue() / (storm::utility::one<ValueType>() - silentProbability));
+            } else {
+                signature.addProbability(successorBlock.getId(), successorEntry.getValue());
+            }
+        }
+    }
+}
+
+template<typename ModelType>
+bool DeterministicModelBisimulationDecomposition<ModelType>::splitBlockBasedOnSignatures(bisimulation::Block<BlockDataType>& block) {
+    if (this->options.getType() == BisimulationType::Weak && this->model.getType() == storm::models::ModelType::Dtmc && !block.data().hasRewards()) {
+        return splitBlockBasedOnWeakSignatures(block);
+    }
+
+    // In the case of CTMCs and weak bisimulation, the signatures do not contain the rates of staying in the block,
+    // so splitting according to the signatures is all we need to do.
+    return this->partition.splitBlock(
+        block,
+        [this](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+            return signatures[state1].less(signatures[state2], this->comparator);
+        },
+        [&block](Block<BlockDataType>& newBlock) {
+            // Keep track of whether this is a block with reward states.
+            newBlock.data().setHasRewards(block.data().hasRewards());
+        });
+}
+
+template<typename ModelType>
+bool DeterministicModelBisimulationDecomposition<ModelType>::splitBlockBasedOnWeakSignatures(bisimulation::Block<BlockDataType>& block) {
+    // First, we move the non-silent states to the front of the block and sort them according to their signatures.
+    // Note that the signatures of silent states are empty.
+    auto signatureLess = [this](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+        return signatures[state1].less(signatures[state2], this->comparator);
+    };
+    this->partition.sortBlock(block, [this, &signatureLess](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+        bool silent1 = isSilent(state1);
+        bool silent2 = isSilent(state2);
+        if (silent1 != silent2) {
+            return silent2;
+        }
+        return !silent1 && signatureLess(state1, state2);
+    });
+    auto nonSilentEnd = std::find_if(this->partition.begin(block), this->partition.end(block),
+                                     [this](storm::storage::sparse::state_type state) { return isSilent(state); });
+    storm::storage::sparse::state_type nonSilentEndIndex = block.getBeginIndex() + std::distance(this->partition.begin(block), nonSilentEnd);
+    if (nonSilentEndIndex == block.getBeginIndex()) {
+        return false;
+    }
+
+    // Then, we need to compute a labeling of the states that expresses which of the classes of non-silent states
+    // they can reach.
+    std::vector<uint_fast64_t> nonSilentBlockIndices = this->partition.computeRangesOfEqualValue(block.getBeginIndex(), nonSilentEndIndex, signatureLess);
+    std::vector<storm::storage::BitVector> weakStateLabels = computeWeakStateLabelingBasedOnNonSilentBlocks(block, nonSilentBlockIndices);
+
+    // Finally, split the block according to this labeling.
+    // CAUTION: this assumes that the positions of the states in the partition are not updated until after the
+    // sorting is over. Otherwise, this interferes with the data used in the sorting process.
+    storm::storage::sparse::state_type originalBlockIndex = block.getBeginIndex();
+    return this->partition.splitBlock(
+        block, [&weakStateLabels, originalBlockIndex, this](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+            return weakStateLabels[this->partition.getPosition(state1) - originalBlockIndex] <
+                   weakStateLabels[this->partition.getPosition(state2) - originalBlockIndex];
+        });
+}
+
 template<typename ModelType>
 void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
     // In order to create the quotient model, we need to construct
@@ -1,6 +1,7 @@
 #ifndef STORM_STORAGE_BISIMULATION_DETERMINISTICMODELBISIMULATIONDECOMPOSITION_H_
 #define STORM_STORAGE_BISIMULATION_DETERMINISTICMODELBISIMULATIONDECOMPOSITION_H_
 
+#include "storm/storage/Distribution.h"
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
@@ -39,6 +40,12 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter,
                                                 std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
 
+    virtual void initializeSignatureRefinement() override;
+
+    virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) override;
+
+    virtual bool splitBlockBasedOnSignatures(bisimulation::Block<BlockDataType>& block) override;
+
    private:
     // Post-processes the initial partition to properly initialize it.
     void postProcessInitialPartition();
@@ -124,6 +131,9 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     std::vector<storm::storage::BitVector> computeWeakStateLabelingBasedOnNonSilentBlocks(bisimulation::Block<BlockDataType> const& block,
                                                                                           std::vector<uint_fast64_t> const& nonSilentBlockIndices);
 
+    // Splits the given block according to the signatures wrt. weak bisimulation in DTMCs.
+    bool splitBlockBasedOnWeakSignatures(bisimulation::Block<BlockDataType>& block);
+
     // Inserts the block into the list of predecessors if it is not already contained.
     void insertIntoPredecessorList(bisimulation::Block<BlockDataType>& predecessorBlock, std::list<bisimulation::Block<BlockDataType>*>& predecessorBlocks);
 
@@ -133,6 +143,10 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
 
     // A vector mapping each state to its silent probability.
     std::vector<ValueType> silentProbabilities;
+
+    // A vector mapping each state to its signature, i.e., its probabilities (or rates) of moving to the blocks of the
+    // partition. This is used by the signature-based refinement.
+    std::vector<storm::storage::Distribution<ValueType>> signatures;
 };
 }  // namespace storage
 }  // namespace storm
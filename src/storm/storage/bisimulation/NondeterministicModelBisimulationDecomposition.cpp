@@ -98,7 +98,7 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::initializeQuotie
 
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuotientDistributions(storm::storage::sparse::state_type state) {
-    std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    auto const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
     std::sort(this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state],
               this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state + 1],
               [this](storm::storage::Distribution<ValueType> const* dist1, storm::storage::Distribution<ValueType> const* dist2) {
@@ -106,6 +106,46 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuo
               });
 }
 
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::initializeSignatureRefinement() {
+    // The quotient distributions serve as signatures, so they have already been initialized.
+}
+
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignatures(storm::storage::sparse::state_type firstState,
+                                                                                  storm::storage::sparse::state_type lastState) {
+    auto const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    bool keepActionRewards = this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards();
+    for (storm::storage::sparse::state_type state = firstState; state < lastState; ++state) {
+        Block<BlockDataType> const& block = this->partition.getBlock(state);
+
+        // States in absorbing blocks keep their distributions, because these blocks are never split.
+        if (block.data().absorbing()) {
+            continue;
+        }
+
+        for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+            storm::storage::DistributionWithReward<ValueType>& distribution = this->quotientDistributions[choice];
+            distribution = storm::storage::DistributionWithReward<ValueType>(
+                keepActionRewards ? this->model.getUniqueRewardModel().getStateActionReward(choice) : storm::utility::zero<ValueType>());
+            for (auto const& entry : this->model.getTransitionMatrix().getRow(choice)) {
+                if (!this->comparator.isZero(entry.getValue())) {
+                    distribution.addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                }
+            }
+            orderedQuotientDistributions[choice] = &distribution;
+        }
+        updateOrderedQuotientDistributions(state);
+    }
+}
+
+template<typename ModelType>
+bool NondeterministicModelBisimulationDecomposition<ModelType>::splitBlockBasedOnSignatures(bisimulation::Block<BlockDataType>& block) {
+    return this->partition.splitBlock(block, [this](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+        return quotientDistributionsLess(state1, state2);
+    });
+}
+
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
     // In order to create the quotient model, we need to construct
@@ -400,7 +440,7 @@ template<typename ModelType>
 bool NondeterministicModelBisimulationDecomposition<ModelType>::quotientDistributionsLess(storm::storage::sparse::state_type state1,
                                                                                           storm::storage::sparse::state_type state2) const {
     STORM_LOG_TRACE("Comparing the quotient distributions of state " << state1 << " and " << state2 << ".");
-    std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    auto const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
 
     auto firstIt = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1];
     auto firstIte = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1 + 1];
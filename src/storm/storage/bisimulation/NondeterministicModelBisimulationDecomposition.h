@@ -40,6 +40,12 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
 
     virtual void initialize() override;
 
+    virtual void initializeSignatureRefinement() override;
+
+    virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) override;
+
+    virtual bool splitBlockBasedOnSignatures(bisimulation::Block<BlockDataType>& block) override;
+
    private:
     // Creates the mapping from the choice indices to the states.
     void createChoiceToStateMapping();
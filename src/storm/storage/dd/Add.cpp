@@ -14,14 +14,30 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 namespace storm {
 namespace dd {
+
+namespace {
+/*!
+ * Retrieves the number of threads that are to be used for translating DDs to sparse matrices.
+ */
+template<typename ValueType>
+uint_fast64_t getNumberOfMatrixTranslationThreads() {
+    if (!storm::utility::parallel::isThreadSafeValueType<ValueType> || !storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()) {
+        return 1;
+    }
+    return storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getNumberOfThreads();
+}
+}  // namespace
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType>::Add(DdManager<LibraryType> const& ddManager, InternalAdd<LibraryType, ValueType> const& internalAdd,
                                  std::set<storm::expressions::Variable> const& containedMetaVariables)
@@ -713,7 +729,7 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
 
     // Now actually fill the entry vector.
     internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
-                                   true);
+                                   true, getNumberOfMatrixTranslationThreads<ValueType>());
 
     // Since the last call to toMatrixRec modified the rowIndications, we need to restore the correct values.
     for (uint_fast64_t i = rowIndications.size() - 1; i > 0; --i) {
@@ -888,11 +904,12 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
     rowIndications[0] = 0;
 
     // Now actually fill the entry vector.
+    uint_fast64_t const numberOfThreads = getNumberOfMatrixTranslationThreads<ValueType>();
     for (uint_fast64_t i = 0; i < groups.size(); ++i) {
         auto const& group = groups[i];
 
         group.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
-                                             ddColumnVariableIndices, true);
+                                             ddColumnVariableIndices, true, numberOfThreads);
 
         statesWithGroupEnabled[i].composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
     }
@@ -1113,11 +1130,12 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
     rowIndications[0] = 0;
 
     // Now actually fill the entry vector.
+    uint_fast64_t const numberOfThreads = getNumberOfMatrixTranslationThreads<ValueType>();
     for (uint_fast64_t i = 0; i < groups.size(); ++i) {
         auto const& dd = groups[i].back();
 
         dd.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
-                                          true);
+                                          true, numberOfThreads);
         statesWithGroupEnabled[i].composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
     }
 
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
+#include <map>
+
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
@@ -12,6 +14,7 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace dd {
@@ -724,14 +727,122 @@ void InternalAdd<DdType::CUDD, ValueType>::splitIntoGroupsRec(std::vector<DdNode
     }
 }
 
+namespace {
+/*!
+ * Splits the given DD into its four quadrants with respect to the given row and column variable.
+ */
+void splitIntoQuadrants(DdNode const* dd, uint_fast64_t ddRowVariableIndex, uint_fast64_t ddColumnVariableIndex, DdNode const*& elseElse,
+                        DdNode const*& elseThen, DdNode const*& thenElse, DdNode const*& thenThen) {
+    if (ddColumnVariableIndex < Cudd_NodeReadIndex(dd)) {
+        elseElse = elseThen = thenElse = thenThen = dd;
+    } else if (ddRowVariableIndex < Cudd_NodeReadIndex(dd)) {
+        elseElse = thenElse = Cudd_E_const(dd);
+        elseThen = thenThen = Cudd_T_const(dd);
+    } else {
+        DdNode const* elseNode = Cudd_E_const(dd);
+        if (ddColumnVariableIndex < Cudd_NodeReadIndex(elseNode)) {
+            elseElse = elseThen = elseNode;
+        } else {
+            elseElse = Cudd_E_const(elseNode);
+            elseThen = Cudd_T_const(elseNode);
+        }
+
+        DdNode const* thenNode = Cudd_T_const(dd);
+        if (ddColumnVariableIndex < Cudd_NodeReadIndex(thenNode)) {
+            thenElse = thenThen = thenNode;
+        } else {
+            thenElse = Cudd_E_const(thenNode);
+            thenThen = Cudd_T_const(thenNode);
+        }
+    }
+}
+
+// A part of the DD that is to be translated to matrix entries starting at the given column offset.
+struct ToMatrixSubproblem {
+    DdNode const* dd;
+    Odd const* columnOdd;
+    uint_fast64_t columnOffset;
+};
+
+// All parts of the DD that belong to the rows below the given node of the row ODD, in the order of the sequential traversal.
+struct ToMatrixTask {
+    Odd const* rowOdd;
+    std::vector<ToMatrixSubproblem> subproblems;
+};
+
+void collectToMatrixTasksRec(DdNode const* dd, DdNode const* zero, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel,
+                             uint_fast64_t splitLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                             std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                             std::map<uint_fast64_t, ToMatrixTask>& tasks) {
+    // For the empty DD, we do not need to add any entries.
+    if (dd == zero) {
+        return;
+    }
+
+    if (currentLevel == splitLevel) {
+        ToMatrixTask& task = tasks[currentRowOffset];
+        task.rowOdd = &rowOdd;
+        task.subproblems.push_back({dd, &columnOdd, currentColumnOffset});
+        return;
+    }
+
+    DdNode const* elseElse;
+    DdNode const* elseThen;
+    DdNode const* thenElse;
+    DdNode const* thenThen;
+    splitIntoQuadrants(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], elseElse, elseThen, thenElse, thenThen);
+
+    collectToMatrixTasksRec(elseElse, zero, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset,
+                            currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+    collectToMatrixTasksRec(elseThen, zero, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset,
+                            currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+    collectToMatrixTasksRec(thenElse, zero, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel,
+                            currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+    collectToMatrixTasksRec(thenThen, zero, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel,
+                            currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
+                            ddColumnVariableIndices, tasks);
+}
+}  // namespace
+
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                               Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                              std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
-                                 ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
-                                 writeValues);
+                                                              std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                                                              uint_fast64_t numberOfThreads) const {
+    uint_fast64_t const maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    numberOfThreads = storm::utility::parallel::getNumberOfThreads(numberOfThreads);
+    if (numberOfThreads == 1 || ddRowVariableIndices.empty()) {
+        toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                              ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // Split the traversal at an upper level of the row ODD such that there are several tasks per thread. All parts of the
+    // DD below the same node of the row ODD are processed by the same task in the order of the sequential traversal.
+    // Hence, the tasks modify disjoint parts of the row indications and the entries and yield the same result. Note that
+    // the tasks only read the DD, which does not interfere with the (single-threaded) CUDD manager.
+    uint_fast64_t splitLevel = 0;
+    while (splitLevel < ddRowVariableIndices.size() && (1ull << splitLevel) < 8 * numberOfThreads) {
+        ++splitLevel;
+    }
+    std::map<uint_fast64_t, ToMatrixTask> tasks;
+    collectToMatrixTasksRec(this->getCuddDdNode(), Cudd_ReadZero(ddManager->getCuddManager().getManager()), rowOdd, columnOdd, 0, splitLevel, 0, 0,
+                            ddRowVariableIndices, ddColumnVariableIndices, tasks);
+    std::vector<std::pair<uint_fast64_t, ToMatrixTask const*>> taskList;
+    taskList.reserve(tasks.size());
+    for (auto const& rowOffsetTaskPair : tasks) {
+        taskList.emplace_back(rowOffsetTaskPair.first, &rowOffsetTaskPair.second);
+    }
+
+    storm::utility::parallel::executeTasks(numberOfThreads, taskList.size(), [&](uint64_t taskIndex, uint64_t) {
+        uint_fast64_t const rowOffset = taskList[taskIndex].first;
+        ToMatrixTask const& task = *taskList[taskIndex].second;
+        for (auto const& subproblem : task.subproblems) {
+            toMatrixComponentsRec(subproblem.dd, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *subproblem.columnOdd, splitLevel,
+                                  splitLevel, maxLevel, rowOffset, subproblem.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        }
+    });
 }
 
 template<typename ValueType>
@@ -760,28 +871,7 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
         DdNode const* thenElse;
         DdNode const* thenThen;
 
-        if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-            elseElse = elseThen = thenElse = thenThen = dd;
-        } else if (ddRowVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-            elseElse = thenElse = Cudd_E_const(dd);
-            elseThen = thenThen = Cudd_T_const(dd);
-        } else {
-            DdNode const* elseNode = Cudd_E_const(dd);
-            if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(elseNode)) {
-                elseElse = elseThen = elseNode;
-            } else {
-                elseElse = Cudd_E_const(elseNode);
-                elseThen = Cudd_T_const(elseNode);
-            }
-
-            DdNode const* thenNode = Cudd_T_const(dd);
-            if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(thenNode)) {
-                thenElse = thenThen = thenNode;
-            } else {
-                thenElse = Cudd_E_const(thenNode);
-                thenThen = Cudd_T_const(thenNode);
-            }
-        }
+        splitIntoQuadrants(dd, ddRowVariableIndices[currentRowLevel], ddColumnVariableIndices[currentColumnLevel], elseElse, elseThen, thenElse, thenThen);
 
         // Visit else-else.
         toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
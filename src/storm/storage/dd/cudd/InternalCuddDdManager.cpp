@@ -1,7 +1,10 @@
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
 
+#include <algorithm>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CuddSettings.h"
+#include "storm/utility/MemoryBudget.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -9,8 +12,10 @@ namespace storm {
 namespace dd {
 
 InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0) {
-    this->cuddManager.SetMaxMemory(
-        static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
+    // The memory of CUDD must not exceed what is left of the overall memory budget.
+    uint64_t maximalMemory = std::min<uint64_t>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul,
+                                                storm::utility::resources::MemoryBudget::instance().getAvailableBytes());
+    this->cuddManager.SetMaxMemory(static_cast<unsigned long>(maximalMemory));
 
     auto const& settings = storm::settings::getModule<storm::settings::modules::CuddSettings>();
     this->cuddManager.SetEpsilon(settings.getConstantPrecision());
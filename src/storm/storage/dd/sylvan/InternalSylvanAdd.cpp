@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include <map>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
@@ -12,6 +14,7 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm-config.h"
 
@@ -1226,14 +1229,125 @@ void InternalAdd<DdType::Sylvan, ValueType>::splitIntoGroupsRec(std::vector<MTBD
     }
 }
 
+namespace {
+/*!
+ * Splits the given DD into its four quadrants with respect to the given row and column variable.
+ */
+void splitIntoQuadrants(MTBDD dd, uint_fast64_t ddRowVariableIndex, uint_fast64_t ddColumnVariableIndex, MTBDD& elseElse, MTBDD& elseThen, MTBDD& thenElse,
+                        MTBDD& thenThen) {
+    if (mtbdd_isleaf(dd) || ddColumnVariableIndex < mtbdd_getvar(dd)) {
+        elseElse = elseThen = thenElse = thenThen = dd;
+    } else if (ddRowVariableIndex < mtbdd_getvar(dd)) {
+        elseElse = thenElse = mtbdd_getlow(dd);
+        elseThen = thenThen = mtbdd_gethigh(dd);
+    } else {
+        MTBDD elseNode = mtbdd_getlow(dd);
+        if (mtbdd_isleaf(elseNode) || ddColumnVariableIndex < mtbdd_getvar(elseNode)) {
+            elseElse = elseThen = elseNode;
+        } else {
+            elseElse = mtbdd_getlow(elseNode);
+            elseThen = mtbdd_gethigh(elseNode);
+        }
+
+        MTBDD thenNode = mtbdd_gethigh(dd);
+        if (mtbdd_isleaf(thenNode) || ddColumnVariableIndex < mtbdd_getvar(thenNode)) {
+            thenElse = thenThen = thenNode;
+        } else {
+            thenElse = mtbdd_getlow(thenNode);
+            thenThen = mtbdd_gethigh(thenNode);
+        }
+    }
+}
+
+// A part of the DD that is to be translated to matrix entries starting at the given column offset.
+struct ToMatrixSubproblem {
+    MTBDD dd;
+    bool negated;
+    Odd const* columnOdd;
+    uint_fast64_t columnOffset;
+};
+
+// All parts of the DD that belong to the rows below the given node of the row ODD, in the order of the sequential traversal.
+struct ToMatrixTask {
+    Odd const* rowOdd;
+    std::vector<ToMatrixSubproblem> subproblems;
+};
+
+void collectToMatrixTasksRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel,
+                             uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                             std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::map<uint_fast64_t, ToMatrixTask>& tasks) {
+    // For the empty DD, we do not need to add any entries.
+    if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+        return;
+    }
+
+    if (currentLevel == splitLevel) {
+        ToMatrixTask& task = tasks[currentRowOffset];
+        task.rowOdd = &rowOdd;
+        task.subproblems.push_back({dd, negated, &columnOdd, currentColumnOffset});
+        return;
+    }
+
+    MTBDD elseElse;
+    MTBDD elseThen;
+    MTBDD thenElse;
+    MTBDD thenThen;
+    splitIntoQuadrants(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], elseElse, elseThen, thenElse, thenThen);
+
+    collectToMatrixTasksRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
+                            currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+    collectToMatrixTasksRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(),
+                            currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
+                            ddColumnVariableIndices, tasks);
+    collectToMatrixTasksRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(),
+                            currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices,
+                            ddColumnVariableIndices, tasks);
+    collectToMatrixTasksRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(),
+                            currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(),
+                            ddRowVariableIndices, ddColumnVariableIndices, tasks);
+}
+}  // namespace
+
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                                                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                                                                uint_fast64_t numberOfThreads) const {
+    uint_fast64_t const maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    numberOfThreads = storm::utility::parallel::getNumberOfThreads(numberOfThreads);
+    if (numberOfThreads == 1 || ddRowVariableIndices.empty()) {
+        toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
+                              rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
+                              writeValues);
+        return;
+    }
+
+    // Split the traversal at an upper level of the row ODD such that there are several tasks per thread. All parts of the
+    // DD below the same node of the row ODD are processed by the same task in the order of the sequential traversal.
+    // Hence, the tasks modify disjoint parts of the row indications and the entries and yield the same result.
+    uint_fast64_t splitLevel = 0;
+    while (splitLevel < ddRowVariableIndices.size() && (1ull << splitLevel) < 8 * numberOfThreads) {
+        ++splitLevel;
+    }
+    std::map<uint_fast64_t, ToMatrixTask> tasks;
+    collectToMatrixTasksRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowOdd, columnOdd, 0,
+                            splitLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+    std::vector<std::pair<uint_fast64_t, ToMatrixTask const*>> taskList;
+    taskList.reserve(tasks.size());
+    for (auto const& rowOffsetTaskPair : tasks) {
+        taskList.emplace_back(rowOffsetTaskPair.first, &rowOffsetTaskPair.second);
+    }
+
+    storm::utility::parallel::executeTasks(numberOfThreads, taskList.size(), [&](uint64_t taskIndex, uint64_t) {
+        uint_fast64_t const rowOffset = taskList[taskIndex].first;
+        ToMatrixTask const& task = *taskList[taskIndex].second;
+        for (auto const& subproblem : task.subproblems) {
+            toMatrixComponentsRec(subproblem.dd, subproblem.negated, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *subproblem.columnOdd,
+                                  splitLevel, splitLevel, maxLevel, rowOffset, subproblem.columnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                                  writeValues);
+        }
+    });
 }
 
 template<typename ValueType>
@@ -1262,28 +1376,7 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
         MTBDD thenElse;
         MTBDD thenThen;
 
-        if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = elseThen = thenElse = thenThen = dd;
-        } else if (ddRowVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = thenElse = mtbdd_getlow(dd);
-            elseThen = thenThen = mtbdd_gethigh(dd);
-        } else {
-            MTBDD elseNode = mtbdd_getlow(dd);
-            if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(elseNode)) {
-                elseElse = elseThen = elseNode;
-            } else {
-                elseElse = mtbdd_getlow(elseNode);
-                elseThen = mtbdd_gethigh(elseNode);
-            }
-
-            MTBDD thenNode = mtbdd_gethigh(dd);
-            if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(thenNode)) {
-                thenElse = thenThen = thenNode;
-            } else {
-                thenElse = mtbdd_getlow(thenNode);
-                thenThen = mtbdd_gethigh(thenNode);
-            }
-        }
+        splitIntoQuadrants(dd, ddRowVariableIndices[currentRowLevel], ddColumnVariableIndices[currentColumnLevel], elseElse, elseThen, thenElse, thenThen);
 
         // Visit else-else.
         toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
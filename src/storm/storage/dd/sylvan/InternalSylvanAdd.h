@@ -636,11 +636,13 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param ddColumnVariableIndices The variable indices of the column variables.
      * @param writeValues A flag that indicates whether or not to write to the entry vector. If this is not set,
      * only the row indications are modified.
+     * @param numberOfThreads The number of threads to use (0 means 'auto-detect'). If more than one thread is used, the
+     * traversal is split at the upper levels of the row ODD into tasks that cover disjoint ranges of rows.
      */
     void toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                             std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
                             std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
-                            bool writeValues) const;
+                            bool writeValues, uint_fast64_t numberOfThreads = 1) const;
 
     /*!
      * Creates an ADD from the given explicit vector.
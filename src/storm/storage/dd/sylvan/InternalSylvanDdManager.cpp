@@ -1,5 +1,6 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -8,6 +9,7 @@
 
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/MemoryBudget.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -77,7 +79,10 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         }
         lace_start(numThreads, task_deque_size);
 
-        sylvan_set_limits(storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024, 0, 0);
+        // The tables of sylvan must not exceed what is left of the overall memory budget.
+        uint64_t maximalMemory =
+            std::min<uint64_t>(settings.getMaximalMemory() * 1024 * 1024, storm::utility::resources::MemoryBudget::instance().getAvailableBytes());
+        sylvan_set_limits(maximalMemory, 0, 0);
         sylvan_init_package();
 
         sylvan::Sylvan::initBdd();
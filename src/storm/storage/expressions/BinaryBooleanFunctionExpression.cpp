@@ -71,8 +71,8 @@ bool BinaryBooleanFunctionExpression::evaluateAsBool(Valuation const* valuation)
 }
 
 std::shared_ptr<BaseExpression const> BinaryBooleanFunctionExpression::simplify() const {
-    std::shared_ptr<BaseExpression const> firstOperandSimplified = this->getFirstOperand()->simplify();
-    std::shared_ptr<BaseExpression const> secondOperandSimplified = this->getSecondOperand()->simplify();
+    std::shared_ptr<BaseExpression const> firstOperandSimplified = this->getManager().getSimplifiedExpression(*this->getFirstOperand());
+    std::shared_ptr<BaseExpression const> secondOperandSimplified = this->getManager().getSimplifiedExpression(*this->getSecondOperand());
 
     if (firstOperandSimplified->isLiteral() || secondOperandSimplified->isLiteral()) {
         switch (this->getOperatorType()) {
@@ -4,6 +4,7 @@
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/expressions/BinaryNumericalFunctionExpression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/ExpressionVisitor.h"
 #include "storm/storage/expressions/IntegerLiteralExpression.h"
 #include "storm/storage/expressions/OperatorType.h"
@@ -152,8 +153,8 @@ double BinaryNumericalFunctionExpression::evaluateAsDouble(Valuation const* valu
 }
 
 std::shared_ptr<BaseExpression const> BinaryNumericalFunctionExpression::simplify() const {
-    std::shared_ptr<BaseExpression const> firstOperandSimplified = this->getFirstOperand()->simplify();
-    std::shared_ptr<BaseExpression const> secondOperandSimplified = this->getSecondOperand()->simplify();
+    std::shared_ptr<BaseExpression const> firstOperandSimplified = this->getManager().getSimplifiedExpression(*this->getFirstOperand());
+    std::shared_ptr<BaseExpression const> secondOperandSimplified = this->getManager().getSimplifiedExpression(*this->getSecondOperand());
 
     if (firstOperandSimplified->isLiteral() && secondOperandSimplified->isLiteral()) {
         if (this->hasIntegerType()) {
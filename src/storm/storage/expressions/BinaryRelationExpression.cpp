@@ -5,6 +5,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/storage/expressions/BooleanLiteralExpression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/ExpressionVisitor.h"
 #include "storm/storage/expressions/OperatorType.h"
 #include "storm/utility/constants.h"
@@ -74,8 +75,8 @@ bool BinaryRelationExpression::evaluateAsBool(Valuation const* valuation) const
 }
 
 std::shared_ptr<BaseExpression const> BinaryRelationExpression::simplify() const {
-    std::shared_ptr<BaseExpression const> firstOperandSimplified = this->getFirstOperand()->simplify();
-    std::shared_ptr<BaseExpression const> secondOperandSimplified = this->getSecondOperand()->simplify();
+    std::shared_ptr<BaseExpression const> firstOperandSimplified = this->getManager().getSimplifiedExpression(*this->getFirstOperand());
+    std::shared_ptr<BaseExpression const> secondOperandSimplified = this->getManager().getSimplifiedExpression(*this->getSecondOperand());
 
     if (firstOperandSimplified->isLiteral() && secondOperandSimplified->isLiteral()) {
         storm::RationalNumber firstOperandEvaluation;
@@ -1,5 +1,10 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include <algorithm>
+#include <typeinfo>
+
+#include <boost/functional/hash.hpp>
+
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/storage/expressions/Expressions.h"
@@ -9,6 +14,61 @@
 namespace storm {
 namespace expressions {
 
+namespace {
+// Retrieves whether expressions of the given kind can be shared. Other kinds (e.g. the array expressions of JANI) are never shared.
+bool isShareable(BaseExpression const& expression) {
+    return expression.isBooleanLiteralExpression() || expression.isIntegerLiteralExpression() || expression.isRationalLiteralExpression() ||
+           expression.isVariableExpression() || expression.isIfThenElseExpression() || expression.isBinaryBooleanFunctionExpression() ||
+           expression.isBinaryNumericalFunctionExpression() || expression.isBinaryRelationExpression() || expression.isUnaryBooleanFunctionExpression() ||
+           expression.isUnaryNumericalFunctionExpression() || expression.isPredicateExpression();
+}
+
+// Computes a hash of the top-level structure of the given (shareable) expression. Operands are only considered via their address.
+std::size_t hashTopLevelStructure(BaseExpression const& expression) {
+    std::size_t seed = typeid(expression).hash_code();
+    if (expression.isBooleanLiteralExpression()) {
+        boost::hash_combine(seed, expression.asBooleanLiteralExpression().getValue());
+    } else if (expression.isIntegerLiteralExpression()) {
+        boost::hash_combine(seed, expression.asIntegerLiteralExpression().getValue());
+    } else if (expression.isRationalLiteralExpression()) {
+        boost::hash_combine(seed, expression.asRationalLiteralExpression().getValueAsDouble());
+    } else if (expression.isVariableExpression()) {
+        boost::hash_combine(seed, expression.asVariableExpression().getVariable().getIndex());
+    } else {
+        boost::hash_combine(seed, static_cast<int>(expression.getOperator()));
+        for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            boost::hash_combine(seed, expression.getOperand(operandIndex).get());
+        }
+    }
+    return seed;
+}
+
+// Checks whether the two (shareable) expressions have the same top-level structure and the very same operands.
+bool haveEqualTopLevelStructure(BaseExpression const& first, BaseExpression const& second) {
+    if (typeid(first) != typeid(second) || !(first.getType() == second.getType())) {
+        return false;
+    }
+    if (first.isBooleanLiteralExpression()) {
+        return first.asBooleanLiteralExpression().getValue() == second.asBooleanLiteralExpression().getValue();
+    } else if (first.isIntegerLiteralExpression()) {
+        return first.asIntegerLiteralExpression().getValue() == second.asIntegerLiteralExpression().getValue();
+    } else if (first.isRationalLiteralExpression()) {
+        return first.asRationalLiteralExpression().getValue() == second.asRationalLiteralExpression().getValue();
+    } else if (first.isVariableExpression()) {
+        return first.asVariableExpression().getVariable() == second.asVariableExpression().getVariable();
+    }
+    if (first.getOperator() != second.getOperator() || first.getArity() != second.getArity()) {
+        return false;
+    }
+    for (uint_fast64_t operandIndex = 0; operandIndex < first.getArity(); ++operandIndex) {
+        if (first.getOperand(operandIndex) != second.getOperand(operandIndex)) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 VariableIterator::VariableIterator(ExpressionManager const& manager, std::unordered_map<std::string, uint_fast64_t>::const_iterator nameIndexIterator,
                                    std::unordered_map<std::string, uint_fast64_t>::const_iterator nameIndexIteratorEnd, VariableSelection const& selection)
     : manager(manager), nameIndexIterator(nameIndexIterator), nameIndexIteratorEnd(nameIndexIteratorEnd), selection(selection) {
@@ -328,6 +388,113 @@ std::shared_ptr<ExpressionManager const> ExpressionManager::getSharedPointer() c
     return this->shared_from_this();
 }
 
+void ExpressionManager::setExpressionSharing(bool value) {
+    std::lock_guard<std::mutex> lock(expressionSharing.mutex);
+    expressionSharing.enabled = value;
+    if (!value) {
+        expressionSharing.expressions.clear();
+        expressionSharing.simplifications.clear();
+        expressionSharing.numberOfInsertionsSinceCleanup = 0;
+    }
+}
+
+bool ExpressionManager::isExpressionSharingEnabled() const {
+    return expressionSharing.enabled;
+}
+
+std::shared_ptr<BaseExpression const> ExpressionManager::getSharedExpression(std::shared_ptr<BaseExpression const> const& expression) const {
+    if (!expressionSharing.enabled || !expression || !isShareable(*expression)) {
+        return expression;
+    }
+    STORM_LOG_ASSERT(&expression->getManager() == this, "Expression is not managed by this manager.");
+
+    std::size_t hash = hashTopLevelStructure(*expression);
+    std::lock_guard<std::mutex> lock(expressionSharing.mutex);
+    auto range = expressionSharing.expressions.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        std::shared_ptr<BaseExpression const> candidate = it->second.lock();
+        if (candidate && (candidate == expression || haveEqualTopLevelStructure(*candidate, *expression))) {
+            return candidate;
+        }
+    }
+    expressionSharing.expressions.emplace(hash, expression);
+    expressionSharing.recordInsertion();
+    return expression;
+}
+
+std::shared_ptr<BaseExpression const> ExpressionManager::getSimplifiedExpression(BaseExpression const& expression) const {
+    if (!expressionSharing.enabled) {
+        return expression.simplify();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(expressionSharing.mutex);
+        auto it = expressionSharing.simplifications.find(&expression);
+        if (it != expressionSharing.simplifications.end() && it->second.first.lock().get() == &expression) {
+            if (std::shared_ptr<BaseExpression const> result = it->second.second.lock()) {
+                return result;
+            }
+        }
+    }
+
+    // The lock must not be held here, as the simplification recursively simplifies the operands.
+    std::shared_ptr<BaseExpression const> result = getSharedExpression(expression.simplify());
+
+    std::lock_guard<std::mutex> lock(expressionSharing.mutex);
+    expressionSharing.simplifications[&expression] = std::make_pair(expression.weak_from_this(), result);
+    expressionSharing.recordInsertion();
+    return result;
+}
+
+uint64_t ExpressionManager::getNumberOfSharedExpressions() const {
+    std::lock_guard<std::mutex> lock(expressionSharing.mutex);
+    expressionSharing.removeExpiredEntries();
+    return expressionSharing.expressions.size();
+}
+
+ExpressionManager::ExpressionSharing::ExpressionSharing() : enabled(false), numberOfInsertionsSinceCleanup(0) {
+    // Intentionally left empty.
+}
+
+ExpressionManager::ExpressionSharing::ExpressionSharing(ExpressionSharing const& other) : enabled(other.enabled.load()), numberOfInsertionsSinceCleanup(0) {
+    // Intentionally left empty.
+}
+
+ExpressionManager::ExpressionSharing& ExpressionManager::ExpressionSharing::operator=(ExpressionSharing const& other) {
+    if (this != &other) {
+        enabled = other.enabled.load();
+        expressions.clear();
+        simplifications.clear();
+        numberOfInsertionsSinceCleanup = 0;
+    }
+    return *this;
+}
+
+void ExpressionManager::ExpressionSharing::recordInsertion() {
+    // Removing the expired entries takes time linear in the size of the tables, so it is only done after sufficiently many insertions.
+    if (++numberOfInsertionsSinceCleanup > std::max<uint64_t>(1024, (expressions.size() + simplifications.size()) / 2)) {
+        removeExpiredEntries();
+    }
+}
+
+void ExpressionManager::ExpressionSharing::removeExpiredEntries() {
+    for (auto it = expressions.begin(); it != expressions.end();) {
+        if (it->second.expired()) {
+            it = expressions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = simplifications.begin(); it != simplifications.end();) {
+        if (it->second.first.expired() || it->second.second.expired()) {
+            it = simplifications.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    numberOfInsertionsSinceCleanup = 0;
+}
+
 std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager) {
     out << "manager {\n";
 
@@ -1,9 +1,12 @@
 #ifndef STORM_STORAGE_EXPRESSIONS_EXPRESSIONMANAGER_H_
 #define STORM_STORAGE_EXPRESSIONS_EXPRESSIONMANAGER_H_
 
+#include <atomic>
 #include <cstdint>
 #include <iosfwd>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -395,9 +398,79 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
      */
     std::shared_ptr<ExpressionManager const> getSharedPointer() const;
 
+    /*!
+     * Sets whether structurally equal expressions of this manager are shared (hash-consing). If enabled, the
+     * expressions created via the Expression class (e.g. by its operators), by substitution and by simplification are
+     * interned in a table of the manager such that structurally equal expressions are represented by the same object.
+     * Substitution and simplification then handle each shared subexpression only once. Sharing is disabled by default.
+     * As expressions are only identified if their operands are shared already, sharing should be enabled before the
+     * first expression is created (for example, the parsers enable it if --share-expressions is set).
+     *
+     * @param value If true, expression sharing is enabled.
+     */
+    void setExpressionSharing(bool value);
+
+    /*!
+     * Retrieves whether structurally equal expressions of this manager are shared.
+     */
+    bool isExpressionSharingEnabled() const;
+
+    /*!
+     * Retrieves the shared representative of the given expression. Two expressions are only identified if their
+     * operands are the same objects, i.e., the operands are not shared recursively. If expression sharing is disabled,
+     * the given expression is returned.
+     *
+     * @param expression The expression whose representative to retrieve.
+     * @return The representative of the expression.
+     */
+    std::shared_ptr<BaseExpression const> getSharedExpression(std::shared_ptr<BaseExpression const> const& expression) const;
+
+    /*!
+     * Simplifies the given expression. If expression sharing is enabled, the result is memoized for the expression
+     * and shared.
+     *
+     * @param expression The expression to simplify.
+     * @return The simplified expression.
+     */
+    std::shared_ptr<BaseExpression const> getSimplifiedExpression(BaseExpression const& expression) const;
+
+    /*!
+     * Retrieves the number of shared expressions that are currently stored by this manager.
+     */
+    uint64_t getNumberOfSharedExpressions() const;
+
     friend std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager);
 
    private:
+    // The data required for sharing expressions. Copies of a manager start with empty tables, because the stored
+    // expressions refer to the original manager.
+    struct ExpressionSharing {
+        ExpressionSharing();
+        ExpressionSharing(ExpressionSharing const& other);
+        ExpressionSharing& operator=(ExpressionSharing const& other);
+
+        // Notes that an entry was added and removes the expired entries from time to time.
+        void recordInsertion();
+
+        // Removes the entries whose expressions do not exist anymore.
+        void removeExpiredEntries();
+
+        // Whether sharing is enabled. It is read without holding the mutex whenever an expression is created.
+        std::atomic<bool> enabled;
+
+        // Guards the tables, as expressions may be created concurrently.
+        std::mutex mutex;
+
+        // The shared expressions, indexed by a hash over their top-level structure.
+        std::unordered_multimap<std::size_t, std::weak_ptr<BaseExpression const>> expressions;
+
+        // The memoized simplifications. The key is stored as well to detect whether the expression still exists.
+        std::unordered_map<BaseExpression const*, std::pair<std::weak_ptr<BaseExpression const>, std::weak_ptr<BaseExpression const>>> simplifications;
+
+        // The number of entries that were added since the last time expired entries were removed.
+        uint64_t numberOfInsertionsSinceCleanup;
+    };
+
     // Explicitly make copy construction/assignment private, since the manager is supposed to be stored as a pointer
     // of some sort. This is because the expression classes store a reference to the manager and it must
     // therefore be guaranteed that they do not become invalid, because the manager has been copied.
@@ -487,6 +560,9 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
     mutable boost::optional<Type> rationalType;
     mutable std::unordered_set<Type> arrayTypes;
 
+    // The tables used for sharing structurally equal expressions.
+    mutable ExpressionSharing expressionSharing;
+
     // A mask that can be used to query whether a variable is an auxiliary variable.
     static const uint64_t auxiliaryMask = (1ull << 50);
 
@@ -2,6 +2,7 @@
 
 #include "ExpressionVisitor.h"
 #include "storm/exceptions/InvalidAccessException.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/OperatorType.h"
 #include "storm/utility/macros.h"
 
@@ -75,14 +76,14 @@ void IfThenElseExpression::gatherVariables(std::set<storm::expressions::Variable
 }
 
 std::shared_ptr<BaseExpression const> IfThenElseExpression::simplify() const {
-    std::shared_ptr<BaseExpression const> conditionSimplified = this->condition->simplify();
+    std::shared_ptr<BaseExpression const> conditionSimplified = this->getManager().getSimplifiedExpression(*this->condition);
     if (conditionSimplified->isTrue()) {
-        return this->thenExpression->simplify();
+        return this->getManager().getSimplifiedExpression(*this->thenExpression);
     } else if (conditionSimplified->isFalse()) {
-        return this->elseExpression->simplify();
+        return this->getManager().getSimplifiedExpression(*this->elseExpression);
     } else {
-        std::shared_ptr<BaseExpression const> thenExpressionSimplified = this->thenExpression->simplify();
-        std::shared_ptr<BaseExpression const> elseExpressionSimplified = this->elseExpression->simplify();
+        std::shared_ptr<BaseExpression const> thenExpressionSimplified = this->getManager().getSimplifiedExpression(*this->thenExpression);
+        std::shared_ptr<BaseExpression const> elseExpressionSimplified = this->getManager().getSimplifiedExpression(*this->elseExpression);
 
         if (conditionSimplified.get() == this->condition.get() && thenExpressionSimplified.get() == this->thenExpression.get() &&
             elseExpressionSimplified.get() == this->elseExpression.get()) {
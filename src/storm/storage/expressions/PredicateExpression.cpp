@@ -3,6 +3,7 @@
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/expressions/BooleanLiteralExpression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/ExpressionVisitor.h"
 #include "storm/storage/expressions/OperatorType.h"
 #include "storm/utility/macros.h"
@@ -53,7 +54,7 @@ std::shared_ptr<BaseExpression const> PredicateExpression::simplify() const {
     std::vector<std::shared_ptr<BaseExpression const>> simplifiedOperands;
     uint64_t trueCount = 0;
     for (auto const& operand : operands) {
-        auto res = operand->simplify();
+        auto res = this->getManager().getSimplifiedExpression(*operand);
         if (res->isLiteral()) {
             if (res->isTrue()) {
                 if (predicate == PredicateType::AtLeastOneOf) {
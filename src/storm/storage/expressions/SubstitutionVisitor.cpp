@@ -1,4 +1,5 @@
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -14,73 +15,79 @@ SubstitutionVisitor<MapType>::SubstitutionVisitor(MapType const& variableToExpre
 
 template<typename MapType>
 Expression SubstitutionVisitor<MapType>::substitute(Expression const& expression) {
+    substitutedOperands.clear();
     return Expression(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getBaseExpression().accept(*this, boost::none)));
 }
 
+template<typename MapType>
+std::shared_ptr<BaseExpression const> SubstitutionVisitor<MapType>::substituteOperand(std::shared_ptr<BaseExpression const> const& operand,
+                                                                                      boost::any const& data) {
+    // Shared subexpressions only need to be substituted once.
+    if (!operand->getManager().isExpressionSharingEnabled()) {
+        return boost::any_cast<std::shared_ptr<BaseExpression const>>(operand->accept(*this, data));
+    }
+    auto it = substitutedOperands.find(operand.get());
+    if (it == substitutedOperands.end()) {
+        it = substitutedOperands.emplace(operand.get(), boost::any_cast<std::shared_ptr<BaseExpression const>>(operand->accept(*this, data))).first;
+    }
+    return it->second;
+}
+
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(IfThenElseExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> conditionExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getCondition()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> thenExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getThenExpression()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> elseExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getElseExpression()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> conditionExpression = this->substituteOperand(expression.getCondition(), data);
+    std::shared_ptr<BaseExpression const> thenExpression = this->substituteOperand(expression.getThenExpression(), data);
+    std::shared_ptr<BaseExpression const> elseExpression = this->substituteOperand(expression.getElseExpression(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (conditionExpression.get() == expression.getCondition().get() && thenExpression.get() == expression.getThenExpression().get() &&
         elseExpression.get() == expression.getElseExpression().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
-            new IfThenElseExpression(expression.getManager(), expression.getType(), conditionExpression, thenExpression, elseExpression)));
+        return expression.getManager().getSharedExpression(std::make_shared<IfThenElseExpression>(
+            expression.getManager(), expression.getType(), conditionExpression, thenExpression, elseExpression));
     }
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = this->substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = this->substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(new BinaryBooleanFunctionExpression(
-            expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getOperatorType())));
+        return expression.getManager().getSharedExpression(std::make_shared<BinaryBooleanFunctionExpression>(
+            expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getOperatorType()));
     }
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = this->substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = this->substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(new BinaryNumericalFunctionExpression(
-            expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getOperatorType())));
+        return expression.getManager().getSharedExpression(std::make_shared<BinaryNumericalFunctionExpression>(
+            expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getOperatorType()));
     }
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryRelationExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = this->substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = this->substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
-            new BinaryRelationExpression(expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getRelationType())));
+        return expression.getManager().getSharedExpression(std::make_shared<BinaryRelationExpression>(
+            expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getRelationType()));
     }
 }
 
@@ -97,29 +104,27 @@ boost::any SubstitutionVisitor<MapType>::visit(VariableExpression const& express
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> operandExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> operandExpression = this->substituteOperand(expression.getOperand(), data);
 
     // If the argument did not change, we simply push the expression itself.
     if (operandExpression.get() == expression.getOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
-            new UnaryBooleanFunctionExpression(expression.getManager(), expression.getType(), operandExpression, expression.getOperatorType())));
+        return expression.getManager().getSharedExpression(std::make_shared<UnaryBooleanFunctionExpression>(
+            expression.getManager(), expression.getType(), operandExpression, expression.getOperatorType()));
     }
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> operandExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> operandExpression = this->substituteOperand(expression.getOperand(), data);
 
     // If the argument did not change, we simply push the expression itself.
     if (operandExpression.get() == expression.getOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
-            new UnaryNumericalFunctionExpression(expression.getManager(), expression.getType(), operandExpression, expression.getOperatorType())));
+        return expression.getManager().getSharedExpression(std::make_shared<UnaryNumericalFunctionExpression>(
+            expression.getManager(), expression.getType(), operandExpression, expression.getOperatorType()));
     }
 }
 
@@ -128,7 +133,7 @@ boost::any SubstitutionVisitor<MapType>::visit(PredicateExpression const& expres
     bool changed = false;
     std::vector<std::shared_ptr<BaseExpression const>> newExpressions;
     for (uint64_t i = 0; i < expression.getArity(); ++i) {
-        newExpressions.push_back(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand(i)->accept(*this, data)));
+        newExpressions.push_back(this->substituteOperand(expression.getOperand(i), data));
         if (!changed && newExpressions.back() != expression.getOperand(i)) {
             changed = true;
         }
@@ -138,8 +143,8 @@ boost::any SubstitutionVisitor<MapType>::visit(PredicateExpression const& expres
     if (!changed) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
-            new PredicateExpression(expression.getManager(), expression.getType(), newExpressions, expression.getPredicateType())));
+        return expression.getManager().getSharedExpression(std::make_shared<PredicateExpression>(
+            expression.getManager(), expression.getType(), newExpressions, expression.getPredicateType()));
     }
 }
 
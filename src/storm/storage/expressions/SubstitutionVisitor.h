@@ -1,7 +1,9 @@
 #ifndef STORM_STORAGE_EXPRESSIONS_SUBSTITUTIONVISITOR_H_
 #define STORM_STORAGE_EXPRESSIONS_SUBSTITUTIONVISITOR_H_
 
+#include <memory>
 #include <stack>
+#include <unordered_map>
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionVisitor.h"
@@ -41,8 +43,17 @@ class SubstitutionVisitor : public ExpressionVisitor {
     virtual boost::any visit(PredicateExpression const& expression, boost::any const& data) override;
 
    protected:
+    /*!
+     * Substitutes the identifiers in the given operand. If expression sharing is enabled, the result is memoized such
+     * that shared subexpressions are only substituted once.
+     */
+    std::shared_ptr<BaseExpression const> substituteOperand(std::shared_ptr<BaseExpression const> const& operand, boost::any const& data);
+
     // A mapping of variables to expressions with which they shall be replaced.
     MapType const& variableToExpressionMapping;
+
+    // The results of the operands that were already substituted (only used if expression sharing is enabled).
+    std::unordered_map<BaseExpression const*, std::shared_ptr<BaseExpression const>> substitutedOperands;
 };
 }  // namespace expressions
 }  // namespace storm
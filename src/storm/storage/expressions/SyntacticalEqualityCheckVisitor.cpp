@@ -7,7 +7,15 @@ namespace expressions {
 
 bool SyntacticalEqualityCheckVisitor::isSyntacticallyEqual(storm::expressions::Expression const& expression1,
                                                            storm::expressions::Expression const& expression2) {
-    return boost::any_cast<bool>(expression1.accept(*this, std::ref(expression2.getBaseExpression())));
+    return areSyntacticallyEqual(expression1.getBaseExpression(), expression2.getBaseExpression());
+}
+
+bool SyntacticalEqualityCheckVisitor::areSyntacticallyEqual(BaseExpression const& expression1, BaseExpression const& expression2) {
+    // Identical (e.g. shared) expressions are trivially equal.
+    if (&expression1 == &expression2) {
+        return true;
+    }
+    return boost::any_cast<bool>(expression1.accept(*this, std::ref(expression2)));
 }
 
 boost::any SyntacticalEqualityCheckVisitor::visit(IfThenElseExpression const& expression, boost::any const& data) {
@@ -15,12 +23,12 @@ boost::any SyntacticalEqualityCheckVisitor::visit(IfThenElseExpression const& ex
     if (otherBaseExpression.isIfThenElseExpression()) {
         IfThenElseExpression const& otherExpression = otherBaseExpression.asIfThenElseExpression();
 
-        bool result = boost::any_cast<bool>(expression.getCondition()->accept(*this, std::ref(*otherExpression.getCondition())));
+        bool result = areSyntacticallyEqual(*expression.getCondition(), *otherExpression.getCondition());
         if (result) {
-            result = boost::any_cast<bool>(expression.getThenExpression()->accept(*this, std::ref(*otherExpression.getThenExpression())));
+            result = areSyntacticallyEqual(*expression.getThenExpression(), *otherExpression.getThenExpression());
         }
         if (result) {
-            result = boost::any_cast<bool>(expression.getElseExpression()->accept(*this, std::ref(*otherExpression.getElseExpression())));
+            result = areSyntacticallyEqual(*expression.getElseExpression(), *otherExpression.getElseExpression());
         }
         return result;
     } else {
@@ -35,10 +43,10 @@ boost::any SyntacticalEqualityCheckVisitor::visit(BinaryBooleanFunctionExpressio
 
         bool result = expression.getOperatorType() == otherExpression.getOperatorType();
         if (result) {
-            result = boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, std::ref(*otherExpression.getFirstOperand())));
+            result = areSyntacticallyEqual(*expression.getFirstOperand(), *otherExpression.getFirstOperand());
         }
         if (result) {
-            result = boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, std::ref(*otherExpression.getSecondOperand())));
+            result = areSyntacticallyEqual(*expression.getSecondOperand(), *otherExpression.getSecondOperand());
         }
         return result;
     } else {
@@ -53,10 +61,10 @@ boost::any SyntacticalEqualityCheckVisitor::visit(BinaryNumericalFunctionExpress
 
         bool result = expression.getOperatorType() == otherExpression.getOperatorType();
         if (result) {
-            result = boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, std::ref(*otherExpression.getFirstOperand())));
+            result = areSyntacticallyEqual(*expression.getFirstOperand(), *otherExpression.getFirstOperand());
         }
         if (result) {
-            result = boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, std::ref(*otherExpression.getSecondOperand())));
+            result = areSyntacticallyEqual(*expression.getSecondOperand(), *otherExpression.getSecondOperand());
         }
         return result;
     } else {
@@ -71,10 +79,10 @@ boost::any SyntacticalEqualityCheckVisitor::visit(BinaryRelationExpression const
 
         bool result = expression.getRelationType() == otherExpression.getRelationType();
         if (result) {
-            result = boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, std::ref(*otherExpression.getFirstOperand())));
+            result = areSyntacticallyEqual(*expression.getFirstOperand(), *otherExpression.getFirstOperand());
         }
         if (result) {
-            result = boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, std::ref(*otherExpression.getSecondOperand())));
+            result = areSyntacticallyEqual(*expression.getSecondOperand(), *otherExpression.getSecondOperand());
         }
         return result;
     } else {
@@ -99,7 +107,7 @@ boost::any SyntacticalEqualityCheckVisitor::visit(UnaryBooleanFunctionExpression
 
         bool result = expression.getOperatorType() == otherExpression.getOperatorType();
         if (result) {
-            result = boost::any_cast<bool>(expression.getOperand()->accept(*this, std::ref(*otherExpression.getOperand())));
+            result = areSyntacticallyEqual(*expression.getOperand(), *otherExpression.getOperand());
         }
         return result;
     } else {
@@ -114,7 +122,7 @@ boost::any SyntacticalEqualityCheckVisitor::visit(UnaryNumericalFunctionExpressi
 
         bool result = expression.getOperatorType() == otherExpression.getOperatorType();
         if (result) {
-            result = boost::any_cast<bool>(expression.getOperand()->accept(*this, std::ref(*otherExpression.getOperand())));
+            result = areSyntacticallyEqual(*expression.getOperand(), *otherExpression.getOperand());
         }
         return result;
     } else {
@@ -5,6 +5,7 @@
 namespace storm {
 namespace expressions {
 
+class BaseExpression;
 class Expression;
 
 class SyntacticalEqualityCheckVisitor : public ExpressionVisitor {
@@ -21,6 +22,10 @@ class SyntacticalEqualityCheckVisitor : public ExpressionVisitor {
     virtual boost::any visit(BooleanLiteralExpression const& expression, boost::any const& data) override;
     virtual boost::any visit(IntegerLiteralExpression const& expression, boost::any const& data) override;
     virtual boost::any visit(RationalLiteralExpression const& expression, boost::any const& data) override;
+
+   private:
+    // Checks whether the given expressions are syntactically equal, skipping the traversal for identical expressions.
+    bool areSyntacticallyEqual(BaseExpression const& expression1, BaseExpression const& expression2);
 };
 
 }  // namespace expressions
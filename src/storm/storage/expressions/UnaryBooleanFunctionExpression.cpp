@@ -2,6 +2,7 @@
 #include "ExpressionVisitor.h"
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/storage/expressions/BooleanLiteralExpression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/OperatorType.h"
 #include "storm/utility/macros.h"
 
@@ -39,7 +40,7 @@ bool UnaryBooleanFunctionExpression::evaluateAsBool(Valuation const* valuation)
 }
 
 std::shared_ptr<BaseExpression const> UnaryBooleanFunctionExpression::simplify() const {
-    std::shared_ptr<BaseExpression const> operandSimplified = this->getOperand()->simplify();
+    std::shared_ptr<BaseExpression const> operandSimplified = this->getManager().getSimplifiedExpression(*this->getOperand());
     switch (this->getOperatorType()) {
         case OperatorType::Not:
             if (operandSimplified->isTrue()) {
@@ -5,6 +5,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/IntegerLiteralExpression.h"
 #include "storm/storage/expressions/OperatorType.h"
 #include "storm/storage/expressions/RationalLiteralExpression.h"
@@ -83,7 +84,7 @@ double UnaryNumericalFunctionExpression::evaluateAsDouble(Valuation const* valua
 }
 
 std::shared_ptr<BaseExpression const> UnaryNumericalFunctionExpression::simplify() const {
-    std::shared_ptr<BaseExpression const> operandSimplified = this->getOperand()->simplify();
+    std::shared_ptr<BaseExpression const> operandSimplified = this->getManager().getSimplifiedExpression(*this->getOperand());
 
     if (operandSimplified->isLiteral()) {
         if (operandSimplified->hasIntegerType()) {
@@ -0,0 +1,227 @@
+#include "storm/storage/sparse/AnalysisCache.h"
+
+#include <tuple>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/storage/Decomposition.h"
+#include "storm/storage/MaximalEndComponent.h"
+#include "storm/storage/StronglyConnectedComponent.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+AnalysisCache::Key::Key(void const* matrix, std::string const& kind, std::vector<storm::storage::BitVector> const& stateSets, uint64_t parameter)
+    : matrix(matrix), kind(kind), stateSets(stateSets), parameter(parameter) {
+    // Intentionally left empty.
+}
+
+bool AnalysisCache::Key::operator<(Key const& other) const {
+    return std::tie(matrix, kind, parameter, stateSets) < std::tie(other.matrix, other.kind, other.parameter, other.stateSets);
+}
+
+uint64_t AnalysisCache::Key::getSizeInBytes() const {
+    uint64_t result = sizeof(Key) + kind.capacity();
+    for (auto const& stateSet : stateSets) {
+        result += stateSet.getSizeInBytes();
+    }
+    return result;
+}
+
+AnalysisCache::Registration::Registration() : matrix(nullptr) {
+    // Intentionally left empty.
+}
+
+AnalysisCache::Registration::Registration(void const* matrix) : matrix(matrix) {
+    AnalysisCache::instance().registerMatrix(matrix);
+}
+
+AnalysisCache::Registration::Registration(Registration const&) : matrix(nullptr) {
+    // Intentionally left empty.
+}
+
+AnalysisCache::Registration& AnalysisCache::Registration::operator=(Registration const&) {
+    // The registered matrix keeps its address, but its content is replaced.
+    invalidate();
+    return *this;
+}
+
+AnalysisCache::Registration::~Registration() {
+    if (matrix != nullptr) {
+        AnalysisCache::instance().unregisterMatrix(matrix);
+    }
+}
+
+void AnalysisCache::Registration::invalidate() const {
+    if (matrix != nullptr) {
+        AnalysisCache::instance().invalidate(matrix);
+    }
+}
+
+AnalysisCache& AnalysisCache::instance() {
+    static AnalysisCache cache;
+    return cache;
+}
+
+AnalysisCache::AnalysisCache()
+    : memoryLimit(512ull * 1024 * 1024),
+      size(0),
+      hits(0),
+      misses(0),
+      evictions(0),
+      memoryReservation(storm::utility::resources::MemoryCategory::Caches) {
+    if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()) {
+        memoryLimit = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getAnalysisCacheMemoryLimit() * 1024 * 1024;
+    }
+    // The cached structures can always be recomputed, so they are the first to go if memory gets scarce.
+    storm::utility::resources::MemoryBudget::instance().addPressureHandler([this]() { this->evictAll(); });
+}
+
+uint64_t AnalysisCache::estimateSizeInBytes(storm::storage::Decomposition<storm::storage::MaximalEndComponent> const& decomposition) {
+    uint64_t result = sizeof(decomposition);
+    for (auto const& endComponent : decomposition) {
+        // Each state is stored in a node of a hash map together with the set of its choices.
+        result += sizeof(endComponent);
+        for (auto const& stateChoicesPair : endComponent) {
+            result += 4 * sizeof(void*) + sizeof(stateChoicesPair) + stateChoicesPair.second.size() * sizeof(uint_fast64_t);
+        }
+    }
+    return result;
+}
+
+uint64_t AnalysisCache::estimateSizeInBytes(storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& decomposition) {
+    uint64_t result = sizeof(decomposition);
+    for (auto const& component : decomposition) {
+        result += sizeof(component) + component.size() * sizeof(uint_fast64_t);
+    }
+    return result;
+}
+
+void AnalysisCache::setMemoryLimit(uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    memoryLimit = bytes;
+    while (size > memoryLimit) {
+        erase(std::prev(entries.end()));
+        ++evictions;
+    }
+}
+
+void AnalysisCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    keyToEntryMap.clear();
+    size = 0;
+    memoryReservation.resize(0);
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
+
+uint64_t AnalysisCache::getNumberOfHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+uint64_t AnalysisCache::getNumberOfMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+uint64_t AnalysisCache::getNumberOfEvictions() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return evictions;
+}
+
+uint64_t AnalysisCache::getSizeInBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return size;
+}
+
+void AnalysisCache::printStatistics(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "Analysis cache: " << hits << " hits, " << misses << " misses, " << evictions << " evictions, " << entries.size() << " entries ("
+        << (size / 1024) << "KB).\n";
+}
+
+std::shared_ptr<void const> AnalysisCache::lookup(Key const& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (memoryLimit == 0 || registeredMatrices.count(key.matrix) == 0) {
+        return nullptr;
+    }
+    auto findIt = keyToEntryMap.find(key);
+    if (findIt == keyToEntryMap.end()) {
+        ++misses;
+        return nullptr;
+    }
+    ++hits;
+    entries.splice(entries.begin(), entries, findIt->second);
+    return findIt->second->value;
+}
+
+void AnalysisCache::insert(Key const& key, std::shared_ptr<void const> const& value, uint64_t sizeInBytes) {
+    // The key is stored twice: in the entry and in the map.
+    sizeInBytes += 2 * key.getSizeInBytes();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (sizeInBytes > memoryLimit || registeredMatrices.count(key.matrix) == 0 || keyToEntryMap.count(key) > 0) {
+        return;
+    }
+    entries.push_front(Entry{key, value, sizeInBytes});
+    keyToEntryMap.emplace(key, entries.begin());
+    size += sizeInBytes;
+    while (size > memoryLimit) {
+        erase(std::prev(entries.end()));
+        ++evictions;
+    }
+    // The entries also have to fit into the overall memory budget.
+    while (!memoryReservation.tryResize(size)) {
+        erase(std::prev(entries.end()));
+        ++evictions;
+    }
+}
+
+void AnalysisCache::registerMatrix(void const* matrix) {
+    std::lock_guard<std::mutex> lock(mutex);
+    STORM_LOG_ASSERT(registeredMatrices.count(matrix) == 0, "Matrix is registered twice.");
+    registeredMatrices.insert(matrix);
+}
+
+void AnalysisCache::unregisterMatrix(void const* matrix) {
+    invalidate(matrix);
+    std::lock_guard<std::mutex> lock(mutex);
+    registeredMatrices.erase(matrix);
+}
+
+void AnalysisCache::invalidate(void const* matrix) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Since the keys are ordered by their matrix first, all entries of the matrix are stored consecutively.
+    auto mapIt = keyToEntryMap.lower_bound(Key(matrix, ""));
+    while (mapIt != keyToEntryMap.end() && mapIt->first.matrix == matrix) {
+        auto entryIt = mapIt->second;
+        ++mapIt;
+        erase(entryIt);
+    }
+}
+
+void AnalysisCache::erase(std::list<Entry>::iterator entryIt) {
+    size -= entryIt->sizeInBytes;
+    keyToEntryMap.erase(entryIt->key);
+    entries.erase(entryIt);
+    if (memoryReservation.getBytes() > size) {
+        memoryReservation.resize(size);
+    }
+}
+
+void AnalysisCache::evictAll() {
+    std::lock_guard<std::mutex> lock(mutex);
+    evictions += entries.size();
+    entries.clear();
+    keyToEntryMap.clear();
+    size = 0;
+    memoryReservation.resize(0);
+}
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/MemoryBudget.h"
+
+namespace storm {
+namespace storage {
+
+// Forward declarations (the decomposition headers include this header through the model headers).
+template<typename BlockType>
+class Decomposition;
+class MaximalEndComponent;
+class StronglyConnectedComponent;
+
+namespace sparse {
+
+/*!
+ * A cache for structures that are derived from the transition matrix of a model (such as the backward transitions or
+ * the results of graph-based precomputations) and that would otherwise be recomputed for every property that is
+ * checked on the model. Entries are identified by the transition matrix, the kind of the structure and the inputs of
+ * its computation. To make sure that the identity of a matrix is meaningful, entries are only stored for matrices that
+ * are registered with the cache (as done by the sparse models for their transition matrices). The total (estimated)
+ * size of the entries is bounded and the least recently used entries are evicted first.
+ */
+class AnalysisCache {
+   public:
+    /*!
+     * Identifies an entry of the cache.
+     */
+    struct Key {
+        Key(void const* matrix, std::string const& kind, std::vector<storm::storage::BitVector> const& stateSets = {}, uint64_t parameter = 0);
+
+        bool operator<(Key const& other) const;
+
+        /*!
+         * Estimates the memory consumption of (a copy of) the key, including its sets of states.
+         */
+        uint64_t getSizeInBytes() const;
+
+        // The (registered) matrix from which the structure is derived.
+        void const* matrix;
+        // A description of the derived structure.
+        std::string kind;
+        // The sets of states (or choices) that were used to compute the structure.
+        std::vector<storm::storage::BitVector> stateSets;
+        // An additional parameter of the computation.
+        uint64_t parameter;
+    };
+
+    /*!
+     * A registration of a matrix with the cache. Registrations remove all entries of their matrix upon destruction and
+     * upon assignment (because the matrix is then typically overwritten). Copies of a registration do not refer to any
+     * matrix, because the copy of the matrix lives at a different address.
+     */
+    class Registration {
+       public:
+        Registration();
+        explicit Registration(void const* matrix);
+        Registration(Registration const& other);
+        Registration& operator=(Registration const& other);
+        ~Registration();
+
+        /*!
+         * Removes all entries of the registered matrix, e.g. because it is about to be modified.
+         */
+        void invalidate() const;
+
+       private:
+        void const* matrix;
+    };
+
+    /*!
+     * Retrieves the cache that is shared by all models.
+     */
+    static AnalysisCache& instance();
+
+    /*!
+     * Retrieves the structure identified by the given key or computes (and possibly stores) it if it is not present.
+     *
+     * @param key The key that identifies the structure.
+     * @param compute A function that computes the structure.
+     * @param sizeInBytes A function that estimates the memory consumption of the structure.
+     * @return The structure. If the matrix of the key is not registered, the structure is computed and not stored.
+     */
+    template<typename T>
+    std::shared_ptr<T const> getOrCompute(Key const& key, std::function<T()> const& compute, std::function<uint64_t(T const&)> const& sizeInBytes) {
+        if (std::shared_ptr<void const> entry = lookup(key)) {
+            return std::static_pointer_cast<T const>(entry);
+        }
+        std::shared_ptr<T const> result = std::make_shared<T const>(compute());
+        insert(key, result, sizeInBytes(*result));
+        return result;
+    }
+
+    /*!
+     * Retrieves the backward transitions of the given matrix, i.e., its transpose (with joined row groups).
+     */
+    template<typename ValueType>
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+        return getOrCompute<storm::storage::SparseMatrix<ValueType>>(
+            Key(&transitionMatrix, "backward transitions"), [&transitionMatrix]() { return transitionMatrix.transpose(true); },
+            [](storm::storage::SparseMatrix<ValueType> const& matrix) { return estimateSizeInBytes(matrix); });
+    }
+
+    /*!
+     * Retrieves the pair of state sets identified by the given key (such as the result of a qualitative analysis) or
+     * computes (and possibly stores) it if it is not present.
+     */
+    std::shared_ptr<std::pair<storm::storage::BitVector, storm::storage::BitVector> const> getOrComputeStateSets(
+        Key const& key, std::function<std::pair<storm::storage::BitVector, storm::storage::BitVector>()> const& compute) {
+        return getOrCompute<std::pair<storm::storage::BitVector, storm::storage::BitVector>>(
+            key, compute,
+            [](std::pair<storm::storage::BitVector, storm::storage::BitVector> const& sets) {
+                return sets.first.getSizeInBytes() + sets.second.getSizeInBytes();
+            });
+    }
+
+    /*!
+     * Retrieves the decomposition (into end components or strongly connected components) identified by the given key or computes (and possibly stores)
+     * it if it is not present.
+     */
+    template<typename DecompositionType>
+    std::shared_ptr<DecompositionType const> getOrComputeDecomposition(Key const& key, std::function<DecompositionType()> const& compute) {
+        return getOrCompute<DecompositionType>(key, compute, [](DecompositionType const& decomposition) { return estimateSizeInBytes(decomposition); });
+    }
+
+    /*!
+     * Estimates the memory consumption of the given matrix.
+     */
+    template<typename ValueType>
+    static uint64_t estimateSizeInBytes(storm::storage::SparseMatrix<ValueType> const& matrix) {
+        return matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>) +
+               (matrix.getRowCount() + matrix.getRowGroupCount() + 2) * sizeof(uint_fast64_t);
+    }
+
+    /*!
+     * Estimates the memory consumption of the given decomposition into end components.
+     */
+    static uint64_t estimateSizeInBytes(storm::storage::Decomposition<storm::storage::MaximalEndComponent> const& decomposition);
+
+    /*!
+     * Estimates the memory consumption of the given decomposition into strongly connected components.
+     */
+    static uint64_t estimateSizeInBytes(storm::storage::Decomposition<storm::storage::StronglyConnectedComponent> const& decomposition);
+
+    /*!
+     * Sets the maximal (estimated) memory consumption of all entries. A limit of zero disables the cache.
+     */
+    void setMemoryLimit(uint64_t bytes);
+
+    /*!
+     * Removes all entries and resets the statistics.
+     */
+    void clear();
+
+    uint64_t getNumberOfHits() const;
+    uint64_t getNumberOfMisses() const;
+    uint64_t getNumberOfEvictions() const;
+    uint64_t getSizeInBytes() const;
+
+    /*!
+     * Prints the hit/miss statistics of the cache to the given stream.
+     */
+    void printStatistics(std::ostream& out) const;
+
+   private:
+    AnalysisCache();
+
+    struct Entry {
+        Key key;
+        std::shared_ptr<void const> value;
+        uint64_t sizeInBytes;
+    };
+
+    std::shared_ptr<void const> lookup(Key const& key);
+    void insert(Key const& key, std::shared_ptr<void const> const& value, uint64_t sizeInBytes);
+    void registerMatrix(void const* matrix);
+    void unregisterMatrix(void const* matrix);
+    void invalidate(void const* matrix);
+
+    // Removes the given entry. The mutex needs to be held by the caller.
+    void erase(std::list<Entry>::iterator entryIt);
+
+    // Removes all entries (but keeps the statistics), e.g. to free memory if the memory budget is exhausted.
+    void evictAll();
+
+    mutable std::mutex mutex;
+
+    // The entries in the order of their last use (most recently used first).
+    std::list<Entry> entries;
+    std::map<Key, std::list<Entry>::iterator> keyToEntryMap;
+    std::set<void const*> registeredMatrices;
+
+    uint64_t memoryLimit;
+    uint64_t size;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+
+    // The entries are also accounted for in the overall memory budget.
+    storm::utility::resources::MemoryReservation memoryReservation;
+};
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
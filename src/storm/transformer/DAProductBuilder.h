@@ -23,13 +23,31 @@ class DAProductBuilder {
     template<typename Model>
     typename DAProduct<Model>::ptr build(const storm::storage::SparseMatrix<typename Model::ValueType>& originalMatrix,
                                          const storm::storage::BitVector& statesOfInterest) const {
-        typename Product<Model>::ptr product = ProductBuilder<Model>::buildProduct(originalMatrix, *this, statesOfInterest);
+        storm::storage::BitVector absorbingAutomatonStates;
+        if (truncateAtAutomatonSinks) {
+            absorbingAutomatonStates = storm::storage::BitVector(da.getNumberOfStates(), false);
+            for (std::size_t automatonState = 0; automatonState < da.getNumberOfStates(); ++automatonState) {
+                if (da.isSink(automatonState)) {
+                    absorbingAutomatonStates.set(automatonState);
+                }
+            }
+        }
+        typename Product<Model>::ptr product = ProductBuilder<Model>::buildProduct(originalMatrix, *this, statesOfInterest, absorbingAutomatonStates);
         storm::automata::AcceptanceCondition::ptr prodAcceptance = da.getAcceptance()->lift(
             product->getProductModel().getNumberOfStates(), [&product](std::size_t prodState) { return product->getAutomatonState(prodState); });
 
         return typename DAProduct<Model>::ptr(new DAProduct<Model>(std::move(*product), prodAcceptance));
     }
 
+    /*!
+     * Sets whether the exploration of the product stops at product states whose automaton state is a sink.
+     * If so, these states are made absorbing. As the automaton can not leave a sink, this does not change whether the runs through
+     * such a state are accepted. However, the successors of these states are then missing in the product.
+     */
+    void setTruncateAtAutomatonSinks(bool value) {
+        truncateAtAutomatonSinks = value;
+    }
+
     storm::storage::sparse::state_type getInitialState(storm::storage::sparse::state_type modelState) const {
         return da.getSuccessor(da.getInitialState(), getLabelForState(modelState));
     }
@@ -41,6 +59,7 @@ class DAProductBuilder {
    private:
     const storm::automata::DeterministicAutomaton& da;
     const std::vector<storm::storage::BitVector>& statesForAP;
+    bool truncateAtAutomatonSinks = false;
 
     storm::automata::APSet::alphabet_element getLabelForState(storm::storage::sparse::state_type s) const {
         storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
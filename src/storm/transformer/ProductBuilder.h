@@ -3,6 +3,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
 
 #include <deque>
 #include <map>
@@ -19,6 +20,18 @@ class ProductBuilder {
     template<typename ProductOperator>
     static typename Product<Model>::ptr buildProduct(const matrix_type& originalMatrix, ProductOperator& prodOp,
                                                      const storm::storage::BitVector& statesOfInterest) {
+        return buildProduct(originalMatrix, prodOp, statesOfInterest, storm::storage::BitVector());
+    }
+
+    /*!
+     * Builds the product of the given matrix and the product operator, starting from the given states of interest.
+     * Product states whose operator state is contained in the given set of absorbing operator states are not explored any further.
+     * Instead, they get a single self-loop.
+     */
+    template<typename ProductOperator>
+    static typename Product<Model>::ptr buildProduct(const matrix_type& originalMatrix, ProductOperator& prodOp,
+                                                     const storm::storage::BitVector& statesOfInterest,
+                                                     const storm::storage::BitVector& absorbingOperatorStates) {
         bool deterministic = originalMatrix.hasTrivialRowGrouping();
 
         typedef storm::storage::sparse::state_type state_type;
@@ -55,7 +68,15 @@ class ProductBuilder {
 
             product_state_type from = productIndexToProductState.at(prodIndexFrom);
             // std::cout << "Handle " << from.first << "," << from.second << " (prodIndexFrom = " << prodIndexFrom << "):\n";
-            if (deterministic) {
+            if (from.second < absorbingOperatorStates.size() && absorbingOperatorStates.get(from.second)) {
+                if (deterministic) {
+                    builder.addNextValue(prodIndexFrom, prodIndexFrom, storm::utility::one<typename Model::ValueType>());
+                } else {
+                    builder.newRowGroup(curRow);
+                    builder.addNextValue(curRow, prodIndexFrom, storm::utility::one<typename Model::ValueType>());
+                    curRow++;
+                }
+            } else if (deterministic) {
                 typename matrix_type::const_rows row = originalMatrix.getRow(from.first);
                 for (auto const& entry : row) {
                     state_type t = entry.getColumn();
@@ -0,0 +1,264 @@
+#include "storm/utility/MemoryBudget.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/OutOfMemoryException.h"
+
+#if defined LINUX
+#include <unistd.h>
+#elif defined MACOS
+#include <mach/mach.h>
+#endif
+
+namespace storm {
+namespace utility {
+namespace resources {
+
+namespace {
+// Reservations of at least this size trigger a fresh measurement of the resident memory.
+uint64_t const residentMemoryRefreshThreshold = 1024 * 1024;
+
+// The fraction of the limit above which the budget is considered to be under pressure.
+double const pressureThreshold = 0.8;
+
+// Prevents the pressure handlers from being invoked recursively.
+thread_local bool invokingPressureHandlers = false;
+
+uint64_t toMegabytes(uint64_t bytes) {
+    return bytes / (1024 * 1024);
+}
+}  // namespace
+
+std::ostream& operator<<(std::ostream& out, MemoryCategory const& category) {
+    switch (category) {
+        case MemoryCategory::MatrixBuilder:
+            out << "matrix builders";
+            break;
+        case MemoryCategory::StateStorage:
+            out << "state storage";
+            break;
+        case MemoryCategory::SolverVectors:
+            out << "solver vectors";
+            break;
+        case MemoryCategory::Caches:
+            out << "caches";
+            break;
+    }
+    return out;
+}
+
+MemoryBudget::MemoryBudget() : limit(0), reservedBytes(0), lastResidentBytes(0), nextHandlerId(0) {
+    for (auto& bytes : reservedBytesPerCategory) {
+        bytes = 0;
+    }
+}
+
+MemoryBudget& MemoryBudget::instance() {
+    static MemoryBudget budget;
+    return budget;
+}
+
+void MemoryBudget::setLimit(uint64_t bytes) {
+    limit = bytes;
+}
+
+uint64_t MemoryBudget::getLimit() const {
+    return limit;
+}
+
+bool MemoryBudget::hasLimit() const {
+    return limit != 0;
+}
+
+bool MemoryBudget::fits(uint64_t bytes, bool refreshResidentBytes) const {
+    uint64_t currentLimit = limit;
+    if (currentLimit == 0) {
+        return true;
+    }
+    if (refreshResidentBytes) {
+        lastResidentBytes = getResidentBytes();
+    }
+    uint64_t usedBytes = std::max<uint64_t>(reservedBytes, lastResidentBytes);
+    return usedBytes <= currentLimit && bytes <= currentLimit - usedBytes;
+}
+
+void MemoryBudget::reserve(MemoryCategory category, uint64_t bytes) {
+    if (!fits(bytes, bytes >= residentMemoryRefreshThreshold)) {
+        if (!invokingPressureHandlers) {
+            STORM_LOG_INFO("Reserving " << toMegabytes(bytes) << "MB for " << category << " exceeds the memory limit, trying to free memory.");
+            std::vector<std::function<void()>> handlers;
+            {
+                std::lock_guard<std::mutex> lock(handlerMutex);
+                for (auto const& idHandlerPair : pressureHandlers) {
+                    handlers.push_back(idHandlerPair.second);
+                }
+            }
+            invokingPressureHandlers = true;
+            for (auto const& handler : handlers) {
+                handler();
+            }
+            invokingPressureHandlers = false;
+        }
+        STORM_LOG_THROW(fits(bytes, true), storm::exceptions::OutOfMemoryException,
+                        "Reserving " << toMegabytes(bytes) << "MB for " << category << " exceeds the memory limit of " << toMegabytes(limit) << "MB ("
+                                     << toMegabytes(getUsedBytes()) << "MB in use, of which " << toMegabytes(reservedBytes)
+                                     << "MB are reserved). Consider increasing the limit via --memlimit.");
+    }
+    reservedBytes += bytes;
+    reservedBytesPerCategory[static_cast<uint64_t>(category)] += bytes;
+}
+
+bool MemoryBudget::tryReserve(MemoryCategory category, uint64_t bytes) {
+    if (!fits(bytes, bytes >= residentMemoryRefreshThreshold)) {
+        return false;
+    }
+    reservedBytes += bytes;
+    reservedBytesPerCategory[static_cast<uint64_t>(category)] += bytes;
+    return true;
+}
+
+void MemoryBudget::release(MemoryCategory category, uint64_t bytes) {
+    STORM_LOG_ASSERT(reservedBytesPerCategory[static_cast<uint64_t>(category)] >= bytes, "Releasing more memory than was reserved.");
+    reservedBytes -= bytes;
+    reservedBytesPerCategory[static_cast<uint64_t>(category)] -= bytes;
+}
+
+uint64_t MemoryBudget::getReservedBytes() const {
+    return reservedBytes;
+}
+
+uint64_t MemoryBudget::getReservedBytes(MemoryCategory category) const {
+    return reservedBytesPerCategory[static_cast<uint64_t>(category)];
+}
+
+uint64_t MemoryBudget::getUsedBytes() const {
+    return std::max<uint64_t>(reservedBytes, lastResidentBytes);
+}
+
+uint64_t MemoryBudget::getAvailableBytes() const {
+    uint64_t currentLimit = limit;
+    if (currentLimit == 0) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    lastResidentBytes = getResidentBytes();
+    uint64_t usedBytes = getUsedBytes();
+    return usedBytes < currentLimit ? currentLimit - usedBytes : 0;
+}
+
+bool MemoryBudget::isUnderPressure() const {
+    uint64_t currentLimit = limit;
+    if (currentLimit == 0) {
+        return false;
+    }
+    lastResidentBytes = getResidentBytes();
+    return getUsedBytes() > pressureThreshold * currentLimit;
+}
+
+uint64_t MemoryBudget::addPressureHandler(std::function<void()> const& handler) {
+    std::lock_guard<std::mutex> lock(handlerMutex);
+    pressureHandlers.emplace(nextHandlerId, handler);
+    return nextHandlerId++;
+}
+
+void MemoryBudget::removePressureHandler(uint64_t handlerId) {
+    std::lock_guard<std::mutex> lock(handlerMutex);
+    pressureHandlers.erase(handlerId);
+}
+
+void MemoryBudget::printReservations(std::ostream& out) const {
+    for (uint64_t category = 0; category < numberOfCategories; ++category) {
+        out << static_cast<MemoryCategory>(category) << ": " << toMegabytes(reservedBytesPerCategory[category]) << "MB\n";
+    }
+}
+
+uint64_t MemoryBudget::getResidentBytes() {
+#if defined LINUX
+    std::ifstream statm("/proc/self/statm");
+    uint64_t totalPages = 0, residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+#elif defined MACOS
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        return info.resident_size;
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+MemoryReservation::MemoryReservation(MemoryCategory category) : category(category), bytes(0) {
+    // Intentionally left empty.
+}
+
+MemoryReservation::MemoryReservation(MemoryReservation const& other) : category(other.category), bytes(0) {
+    resize(other.bytes);
+}
+
+MemoryReservation::MemoryReservation(MemoryReservation&& other) : category(other.category), bytes(other.bytes) {
+    other.bytes = 0;
+}
+
+MemoryReservation& MemoryReservation::operator=(MemoryReservation const& other) {
+    if (this != &other) {
+        resize(0);
+        category = other.category;
+        resize(other.bytes);
+    }
+    return *this;
+}
+
+MemoryReservation& MemoryReservation::operator=(MemoryReservation&& other) {
+    if (this != &other) {
+        resize(0);
+        category = other.category;
+        bytes = other.bytes;
+        other.bytes = 0;
+    }
+    return *this;
+}
+
+MemoryReservation::~MemoryReservation() {
+    if (bytes > 0) {
+        MemoryBudget::instance().release(category, bytes);
+    }
+}
+
+void MemoryReservation::resize(uint64_t newBytes) {
+    if (newBytes > bytes) {
+        MemoryBudget::instance().reserve(category, newBytes - bytes);
+    } else if (newBytes < bytes) {
+        MemoryBudget::instance().release(category, bytes - newBytes);
+    }
+    bytes = newBytes;
+}
+
+bool MemoryReservation::tryResize(uint64_t newBytes) {
+    if (newBytes > bytes) {
+        if (!MemoryBudget::instance().tryReserve(category, newBytes - bytes)) {
+            return false;
+        }
+    } else if (newBytes < bytes) {
+        MemoryBudget::instance().release(category, bytes - newBytes);
+    }
+    bytes = newBytes;
+    return true;
+}
+
+uint64_t MemoryReservation::getBytes() const {
+    return bytes;
+}
+
+}  // namespace resources
+}  // namespace utility
+}  // namespace storm
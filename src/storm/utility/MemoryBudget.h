@@ -0,0 +1,165 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <ostream>
+
+namespace storm {
+namespace utility {
+namespace resources {
+
+/*!
+ * The kinds of large allocations that are accounted for by the memory budget.
+ */
+enum class MemoryCategory { MatrixBuilder, StateStorage, SolverVectors, Caches };
+
+std::ostream& operator<<(std::ostream& out, MemoryCategory const& category);
+
+/*!
+ * Keeps track of the large allocations of the program and enforces a (configurable) limit on the memory consumption.
+ * Before a large allocation is made, it is reserved with the budget. If the reservation would exceed the limit, the
+ * registered pressure handlers are asked to free memory (e.g. by dropping cached structures). If this does not suffice,
+ * an OutOfMemoryException is thrown, so that the program can terminate gracefully instead of being killed.
+ *
+ * Besides the reservations, the budget also considers the resident memory of the process (where available), because
+ * not all allocations are tracked.
+ */
+class MemoryBudget {
+   public:
+    MemoryBudget(MemoryBudget const&) = delete;
+    MemoryBudget& operator=(MemoryBudget const&) = delete;
+
+    /*!
+     * Retrieves the budget that is shared by the whole program.
+     */
+    static MemoryBudget& instance();
+
+    /*!
+     * Sets the memory limit. A limit of zero means that the memory consumption is not restricted.
+     */
+    void setLimit(uint64_t bytes);
+    uint64_t getLimit() const;
+    bool hasLimit() const;
+
+    /*!
+     * Reserves the given number of bytes. If the limit would be exceeded, the pressure handlers are invoked first.
+     *
+     * @throws OutOfMemoryException if the reservation exceeds the limit even after invoking the pressure handlers.
+     */
+    void reserve(MemoryCategory category, uint64_t bytes);
+
+    /*!
+     * Reserves the given number of bytes if this is possible without exceeding the limit. In contrast to reserve,
+     * this neither invokes the pressure handlers nor throws.
+     *
+     * @return True iff the bytes were reserved.
+     */
+    bool tryReserve(MemoryCategory category, uint64_t bytes);
+
+    /*!
+     * Releases the given number of previously reserved bytes.
+     */
+    void release(MemoryCategory category, uint64_t bytes);
+
+    /*!
+     * Retrieves the number of bytes that are currently reserved (in total or for the given category).
+     */
+    uint64_t getReservedBytes() const;
+    uint64_t getReservedBytes(MemoryCategory category) const;
+
+    /*!
+     * Retrieves the number of bytes that are considered to be in use, i.e., the maximum of the reserved bytes and the
+     * resident memory of the process.
+     */
+    uint64_t getUsedBytes() const;
+
+    /*!
+     * Retrieves the number of bytes that can still be used before the limit is reached. This can be used to bound
+     * libraries that manage their own memory (such as the DD packages).
+     *
+     * @return The number of available bytes or the maximal value if no limit was set.
+     */
+    uint64_t getAvailableBytes() const;
+
+    /*!
+     * Retrieves whether the memory consumption is close to the limit. Algorithms can use this to switch to a less
+     * memory-intensive strategy before the limit is reached.
+     */
+    bool isUnderPressure() const;
+
+    /*!
+     * Adds a handler that is invoked when a reservation would exceed the limit and that is supposed to free memory.
+     * Handlers must not call reserve.
+     *
+     * @return An identifier that can be used to remove the handler.
+     */
+    uint64_t addPressureHandler(std::function<void()> const& handler);
+    void removePressureHandler(uint64_t handlerId);
+
+    /*!
+     * Prints the reserved bytes of all categories to the given stream.
+     */
+    void printReservations(std::ostream& out) const;
+
+   private:
+    MemoryBudget();
+
+    // Retrieves the resident memory of the process (or zero if this is not supported on the current platform).
+    static uint64_t getResidentBytes();
+
+    // Checks whether the given number of bytes can be added without exceeding the limit.
+    bool fits(uint64_t bytes, bool refreshResidentBytes) const;
+
+    static constexpr uint64_t numberOfCategories = 4;
+
+    std::atomic<uint64_t> limit;
+    std::atomic<uint64_t> reservedBytes;
+    std::array<std::atomic<uint64_t>, numberOfCategories> reservedBytesPerCategory;
+    mutable std::atomic<uint64_t> lastResidentBytes;
+
+    mutable std::mutex handlerMutex;
+    std::map<uint64_t, std::function<void()>> pressureHandlers;
+    uint64_t nextHandlerId;
+};
+
+/*!
+ * A reservation of memory with the budget that is released upon destruction. Typically, a data structure owns a
+ * reservation and resizes it whenever its storage grows (before the storage is actually allocated).
+ */
+class MemoryReservation {
+   public:
+    explicit MemoryReservation(MemoryCategory category);
+    MemoryReservation(MemoryReservation const& other);
+    MemoryReservation(MemoryReservation&& other);
+    MemoryReservation& operator=(MemoryReservation const& other);
+    MemoryReservation& operator=(MemoryReservation&& other);
+    ~MemoryReservation();
+
+    /*!
+     * Changes the reserved number of bytes.
+     *
+     * @throws OutOfMemoryException if the limit would be exceeded (in which case the reservation is unchanged).
+     */
+    void resize(uint64_t bytes);
+
+    /*!
+     * Changes the reserved number of bytes if this is possible without exceeding the limit.
+     *
+     * @return True iff the reservation was changed.
+     */
+    bool tryResize(uint64_t bytes);
+
+    uint64_t getBytes() const;
+
+   private:
+    MemoryCategory category;
+    uint64_t bytes;
+};
+
+}  // namespace resources
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,282 @@
+#include "storm/utility/Metrics.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+#if defined LINUX || defined MACOS
+#include <sys/resource.h>
+#endif
+
+namespace storm {
+namespace utility {
+namespace metrics {
+
+namespace detail {
+// The phases that are currently running on this thread (innermost last)
+thread_local std::vector<PhaseId> runningPhases;
+
+uint64_t getThreadIndex() {
+    static std::atomic<uint64_t> nextThreadIndex{0};
+    thread_local uint64_t const threadIndex = nextThreadIndex++;
+    return threadIndex;
+}
+
+uint64_t getPeakResidentBytes() {
+#if defined LINUX || defined MACOS
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return static_cast<uint64_t>(ru.ru_maxrss);
+#else
+    // For Linux, this is returned in kilobytes.
+    return static_cast<uint64_t>(ru.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+double toMilliseconds(std::chrono::microseconds const& time) {
+    return static_cast<double>(time.count()) / 1000.0;
+}
+
+double toMegabytes(uint64_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+}  // namespace detail
+
+MetricsRecorder& MetricsRecorder::instance() {
+    static MetricsRecorder recorder;
+    return recorder;
+}
+
+MetricsRecorder::MetricsRecorder() : enabled(false), referenceTime(std::chrono::steady_clock::now()), generation(0) {
+    // Intentionally left empty.
+}
+
+void MetricsRecorder::setEnabled(bool value) {
+    enabled = value;
+}
+
+void MetricsRecorder::addToCounter(std::string_view name, uint64_t amount) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto counterIt = counters.find(name);
+    if (counterIt == counters.end()) {
+        counters.emplace(std::string(name), amount);
+    } else {
+        counterIt->second += amount;
+    }
+}
+
+void MetricsRecorder::updateCounterMaximum(std::string_view name, uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto counterIt = counters.find(name);
+    if (counterIt == counters.end()) {
+        counters.emplace(std::string(name), value);
+    } else {
+        counterIt->second = std::max(counterIt->second, value);
+    }
+}
+
+void MetricsRecorder::setValue(std::string_view name, double value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto valueIt = values.find(name);
+    if (valueIt == values.end()) {
+        values.emplace(std::string(name), value);
+    } else {
+        valueIt->second = value;
+    }
+}
+
+uint64_t MetricsRecorder::getCounter(std::string_view name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto counterIt = counters.find(name);
+    return counterIt == counters.end() ? 0 : counterIt->second;
+}
+
+uint64_t MetricsRecorder::getNumberOfPhases() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return phases.size();
+}
+
+PhaseId MetricsRecorder::getRunningPhase() const {
+    if (detail::runningPhases.empty()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return {generation, PhaseId::noPhase};
+    }
+    return detail::runningPhases.back();
+}
+
+void MetricsRecorder::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    STORM_LOG_WARN_COND(std::all_of(phases.begin(), phases.end(), [](Phase const& phase) { return phase.finished; }),
+                        "Clearing metrics while some phases are still running.");
+    phases.clear();
+    ++generation;
+    counters.clear();
+    values.clear();
+}
+
+PhaseId MetricsRecorder::beginPhase(std::string_view name, PhaseId const& parent) {
+    auto start = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - referenceTime);
+    PhaseId result;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // The parent might have been recorded before the phases were cleared
+        uint64_t parentIndex = parent.generation == generation ? parent.index : PhaseId::noPhase;
+        result = {generation, phases.size()};
+        phases.push_back({std::string(name), parentIndex, detail::getThreadIndex(), start, std::chrono::microseconds::zero(), 0, false});
+    }
+    detail::runningPhases.push_back(result);
+    return result;
+}
+
+void MetricsRecorder::endPhase(PhaseId const& phaseId) {
+    auto end = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - referenceTime);
+    STORM_LOG_ASSERT(!detail::runningPhases.empty() && detail::runningPhases.back() == phaseId, "Phases are not properly nested.");
+    detail::runningPhases.pop_back();
+    uint64_t peakResidentBytes = detail::getPeakResidentBytes();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (phaseId.generation == generation) {  // The phases might have been cleared in the meantime
+        auto& phase = phases[phaseId.index];
+        phase.duration = end - phase.start;
+        phase.peakResidentBytes = peakResidentBytes;
+        phase.finished = true;
+    }
+}
+
+void MetricsRecorder::exportMetrics(std::ostream& out, MetricsFormat format) const {
+    switch (format) {
+        case MetricsFormat::Json:
+            exportJson(out);
+            break;
+        case MetricsFormat::ChromeTrace:
+            exportChromeTrace(out);
+            break;
+    }
+}
+
+void MetricsRecorder::exportJson(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - referenceTime);
+
+    // Collect the children of each phase
+    std::vector<std::vector<uint64_t>> children(phases.size());
+    std::vector<uint64_t> topLevelPhases;
+    for (uint64_t phaseIndex = 0; phaseIndex < phases.size(); ++phaseIndex) {
+        auto parent = phases[phaseIndex].parent;
+        (parent == PhaseId::noPhase ? topLevelPhases : children[parent]).push_back(phaseIndex);
+    }
+    std::function<storm::json<double>(uint64_t)> phaseToJson = [&](uint64_t phaseIndex) {
+        auto const& phase = phases[phaseIndex];
+        storm::json<double> result;
+        result["name"] = phase.name;
+        result["thread"] = phase.thread;
+        result["start-ms"] = detail::toMilliseconds(phase.start);
+        result["duration-ms"] = detail::toMilliseconds(phase.finished ? phase.duration : now - phase.start);
+        if (phase.finished) {
+            result["peak-memory-mb"] = detail::toMegabytes(phase.peakResidentBytes);
+        } else {
+            result["running"] = true;
+        }
+        if (!children[phaseIndex].empty()) {
+            storm::json<double> childrenJson = storm::json<double>::array();
+            for (auto child : children[phaseIndex]) {
+                childrenJson.push_back(phaseToJson(child));
+            }
+            result["phases"] = std::move(childrenJson);
+        }
+        return result;
+    };
+
+    storm::json<double> output;
+    output["phases"] = storm::json<double>::array();
+    for (auto phaseIndex : topLevelPhases) {
+        output["phases"].push_back(phaseToJson(phaseIndex));
+    }
+    output["counters"] = storm::json<double>::object();
+    for (auto const& counter : counters) {
+        output["counters"][counter.first] = counter.second;
+    }
+    output["values"] = storm::json<double>::object();
+    for (auto const& value : values) {
+        output["values"][value.first] = value.second;
+    }
+    output["peak-memory-mb"] = detail::toMegabytes(detail::getPeakResidentBytes());
+    out << storm::dumpJson(output) << '\n';
+}
+
+void MetricsRecorder::exportChromeTrace(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - referenceTime);
+
+    storm::json<double> events = storm::json<double>::array();
+    storm::json<double> processName;
+    processName["name"] = "process_name";
+    processName["ph"] = "M";
+    processName["pid"] = 0;
+    processName["args"]["name"] = "storm";
+    events.push_back(std::move(processName));
+    for (auto const& phase : phases) {
+        storm::json<double> event;
+        event["name"] = phase.name;
+        event["ph"] = "X";  // A 'complete' event, i.e., with start and duration
+        event["pid"] = 0;
+        event["tid"] = phase.thread;
+        event["ts"] = phase.start.count();
+        event["dur"] = (phase.finished ? phase.duration : now - phase.start).count();
+        if (phase.finished) {
+            event["args"]["peak-memory-mb"] = detail::toMegabytes(phase.peakResidentBytes);
+        }
+        events.push_back(std::move(event));
+    }
+    // Counters and values are reported with their final value at the end of the trace
+    auto addCounterEvent = [&events, &now](std::string const& name, storm::json<double>&& value) {
+        storm::json<double> event;
+        event["name"] = name;
+        event["ph"] = "C";
+        event["pid"] = 0;
+        event["ts"] = now.count();
+        event["args"]["value"] = std::move(value);
+        events.push_back(std::move(event));
+    };
+    for (auto const& counter : counters) {
+        addCounterEvent(counter.first, counter.second);
+    }
+    for (auto const& value : values) {
+        addCounterEvent(value.first, value.second);
+    }
+
+    storm::json<double> output;
+    output["traceEvents"] = std::move(events);
+    output["displayTimeUnit"] = "ms";
+    out << storm::dumpJson(output, true) << '\n';
+}
+
+ScopedTimer::ScopedTimer(std::string_view name) : phase{0, PhaseId::noPhase}, active(MetricsRecorder::instance().isEnabled()) {
+    if (active) {
+        auto& recorder = MetricsRecorder::instance();
+        phase = recorder.beginPhase(name, recorder.getRunningPhase());
+    }
+}
+
+ScopedTimer::ScopedTimer(std::string_view name, PhaseId const& parent) : phase{0, PhaseId::noPhase}, active(MetricsRecorder::instance().isEnabled()) {
+    if (active) {
+        phase = MetricsRecorder::instance().beginPhase(name, parent);
+    }
+}
+
+ScopedTimer::~ScopedTimer() {
+    if (active) {
+        MetricsRecorder::instance().endPhase(phase);
+    }
+}
+
+}  // namespace metrics
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace metrics {
+
+/*!
+ * The formats in which recorded metrics can be exported.
+ */
+enum class MetricsFormat {
+    Json,        /// A JSON object with the (nested) phases, the counters, and the values
+    ChromeTrace  /// The trace event format that can be loaded in chrome://tracing or Perfetto
+};
+
+/*!
+ * Identifies a recorded phase. Identifiers of phases that have been recorded before the last call to MetricsRecorder::clear() are no longer valid.
+ */
+struct PhaseId {
+    uint64_t generation;
+    uint64_t index;  // index of the phase or noPhase
+
+    static constexpr uint64_t noPhase = std::numeric_limits<uint64_t>::max();
+
+    bool operator==(PhaseId const& other) const {
+        return generation == other.generation && index == other.index;
+    }
+};
+
+/*!
+ * Collects timings of (nested) phases, counters, and values during a run so that they can be exported in a machine-readable format.
+ * Recording is disabled by default. In this case, all recording functions return immediately so that instrumented code has negligible overhead.
+ * All functions are thread-safe.
+ */
+class MetricsRecorder {
+   public:
+    /*!
+     * Retrieves the (unique) instance of the recorder.
+     */
+    static MetricsRecorder& instance();
+
+    /*!
+     * Enables or disables the recording of metrics.
+     */
+    void setEnabled(bool value);
+
+    /*!
+     * Retrieves whether metrics are currently recorded.
+     */
+    bool isEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * Adds the given amount to the counter with the given name. Counters that have not been used before start at zero.
+     */
+    void addToCounter(std::string_view name, uint64_t amount);
+
+    /*!
+     * Sets the counter with the given name to the maximum of its current value and the given value.
+     */
+    void updateCounterMaximum(std::string_view name, uint64_t value);
+
+    /*!
+     * Sets the value with the given name, overwriting previously set values.
+     */
+    void setValue(std::string_view name, double value);
+
+    /*!
+     * Retrieves the current value of the counter with the given name (or zero if the counter has not been used so far).
+     */
+    uint64_t getCounter(std::string_view name) const;
+
+    /*!
+     * Retrieves the number of phases that have been recorded so far (including running phases).
+     */
+    uint64_t getNumberOfPhases() const;
+
+    /*!
+     * Retrieves the innermost phase that is currently running on the calling thread (with index PhaseId::noPhase if there is none).
+     * The result can be passed to other threads so that the phases they record become children of this phase.
+     */
+    PhaseId getRunningPhase() const;
+
+    /*!
+     * Removes all recorded phases, counters, and values.
+     * Phases that are still running when clearing are not recorded upon their end.
+     */
+    void clear();
+
+    /*!
+     * Exports the recorded metrics in the given format.
+     */
+    void exportMetrics(std::ostream& out, MetricsFormat format) const;
+
+   private:
+    friend class ScopedTimer;
+
+    MetricsRecorder();
+
+    /*!
+     * Starts a new phase with the given name and parent on the calling thread and returns its identifier.
+     * If the parent is not valid (anymore), the new phase becomes a top-level phase.
+     */
+    PhaseId beginPhase(std::string_view name, PhaseId const& parent);
+
+    /*!
+     * Ends the given phase that has been started on the calling thread.
+     */
+    void endPhase(PhaseId const& phase);
+
+    void exportJson(std::ostream& out) const;
+    void exportChromeTrace(std::ostream& out) const;
+
+    struct Phase {
+        std::string name;
+        uint64_t parent;  // index of the parent phase or PhaseId::noPhase
+        uint64_t thread;
+        std::chrono::microseconds start;
+        std::chrono::microseconds duration;
+        uint64_t peakResidentBytes;  // peak resident memory of the process at the end of the phase
+        bool finished;
+    };
+
+    std::atomic<bool> enabled;
+    std::chrono::steady_clock::time_point const referenceTime;
+    mutable std::mutex mutex;
+    uint64_t generation;  // incremented whenever the recorded phases are cleared
+    std::vector<Phase> phases;
+    std::map<std::string, uint64_t, std::less<>> counters;
+    std::map<std::string, double, std::less<>> values;
+};
+
+/*!
+ * Records the time between its construction and its destruction as a phase with the given name.
+ * Phases that are started while another phase is running on the same thread are recorded as children of that phase.
+ * Phases on worker threads can instead be attached to a phase of the spawning thread (see MetricsRecorder::getRunningPhase).
+ * If recording is disabled upon construction, nothing is recorded.
+ */
+class ScopedTimer {
+   public:
+    explicit ScopedTimer(std::string_view name);
+    ScopedTimer(std::string_view name, PhaseId const& parent);
+    ~ScopedTimer();
+
+    ScopedTimer(ScopedTimer const&) = delete;
+    ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+   private:
+    PhaseId phase;
+    bool active;
+};
+
+/*!
+ * Retrieves whether metrics are currently recorded.
+ */
+inline bool isEnabled() {
+    return MetricsRecorder::instance().isEnabled();
+}
+
+/*!
+ * Adds the given amount to the counter with the given name (if recording is enabled).
+ */
+inline void addToCounter(std::string_view name, uint64_t amount = 1) {
+    auto& recorder = MetricsRecorder::instance();
+    if (recorder.isEnabled()) {
+        recorder.addToCounter(name, amount);
+    }
+}
+
+/*!
+ * Sets the counter with the given name to the maximum of its current value and the given value (if recording is enabled).
+ */
+inline void updateCounterMaximum(std::string_view name, uint64_t value) {
+    auto& recorder = MetricsRecorder::instance();
+    if (recorder.isEnabled()) {
+        recorder.updateCounterMaximum(name, value);
+    }
+}
+
+/*!
+ * Sets the value with the given name (if recording is enabled).
+ */
+inline void setValue(std::string_view name, double value) {
+    auto& recorder = MetricsRecorder::instance();
+    if (recorder.isEnabled()) {
+        recorder.setValue(name, value);
+    }
+}
+
+}  // namespace metrics
+}  // namespace utility
+}  // namespace storm
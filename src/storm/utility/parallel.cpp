@@ -0,0 +1,162 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+uint64_t getNumberOfThreads(uint64_t requestedNumberOfThreads) {
+    if (requestedNumberOfThreads == 0) {
+        return std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+    return requestedNumberOfThreads;
+}
+
+void executeOnThreads(uint64_t numberOfThreads, std::function<void(uint64_t)> const& function) {
+    numberOfThreads = getNumberOfThreads(numberOfThreads);
+    if (numberOfThreads == 1) {
+        function(0);
+        return;
+    }
+
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    auto guardedFunction = [&function, &exception, &exceptionMutex](uint64_t thread) {
+        try {
+            function(thread);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(guardedFunction, thread);
+    }
+    guardedFunction(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void executeTasks(uint64_t numberOfThreads, uint64_t numberOfTasks, std::function<void(uint64_t, uint64_t)> const& function) {
+    numberOfThreads = std::min(getNumberOfThreads(numberOfThreads), std::max<uint64_t>(numberOfTasks, 1));
+    std::atomic<uint64_t> nextTask(0);
+    std::atomic<bool> abort(false);
+    executeOnThreads(numberOfThreads, [&](uint64_t thread) {
+        for (uint64_t task = nextTask++; task < numberOfTasks && !abort; task = nextTask++) {
+            try {
+                function(task, thread);
+            } catch (...) {
+                abort = true;
+                throw;
+            }
+        }
+    });
+}
+
+bool executeTaskGraph(uint64_t numberOfThreads, std::vector<std::vector<uint64_t>> const& dependencies,
+                      std::function<void(uint64_t, uint64_t)> const& function) {
+    uint64_t const numberOfTasks = dependencies.size();
+
+    // Invert the dependencies and find the tasks that can be started right away.
+    std::vector<uint64_t> numberOfPendingDependencies(numberOfTasks);
+    std::vector<std::vector<uint64_t>> dependentTasks(numberOfTasks);
+    std::set<uint64_t> readyTasks;
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        numberOfPendingDependencies[task] = dependencies[task].size();
+        for (auto const& dependency : dependencies[task]) {
+            STORM_LOG_ASSERT(dependency < numberOfTasks, "Task " << task << " depends on non-existing task " << dependency << ".");
+            dependentTasks[dependency].push_back(task);
+        }
+        if (dependencies[task].empty()) {
+            readyTasks.insert(task);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable taskFinished;
+    uint64_t numberOfRunningTasks = 0;
+    uint64_t numberOfFinishedTasks = 0;
+    bool abort = false;
+    executeOnThreads(std::min(getNumberOfThreads(numberOfThreads), std::max<uint64_t>(numberOfTasks, 1)), [&](uint64_t thread) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            taskFinished.wait(lock, [&] { return abort || !readyTasks.empty() || numberOfRunningTasks == 0; });
+            if (abort || readyTasks.empty()) {
+                // Either we are asked to stop or no task is running and no task can be started.
+                break;
+            }
+            uint64_t task = *readyTasks.begin();
+            readyTasks.erase(readyTasks.begin());
+            ++numberOfRunningTasks;
+            lock.unlock();
+            try {
+                function(task, thread);
+            } catch (...) {
+                lock.lock();
+                --numberOfRunningTasks;
+                abort = true;
+                taskFinished.notify_all();
+                throw;
+            }
+            lock.lock();
+            --numberOfRunningTasks;
+            ++numberOfFinishedTasks;
+            for (auto const& dependentTask : dependentTasks[task]) {
+                if (--numberOfPendingDependencies[dependentTask] == 0) {
+                    readyTasks.insert(dependentTask);
+                }
+            }
+            if (storm::utility::resources::isTerminate()) {
+                abort = true;
+            }
+            taskFinished.notify_all();
+        }
+    });
+    STORM_LOG_ASSERT(abort || numberOfFinishedTasks == numberOfTasks, "Not all tasks have been executed. Are the task dependencies cyclic?");
+    return numberOfFinishedTasks == numberOfTasks;
+}
+
+void forEachChunk(uint64_t numberOfThreads, uint64_t size, std::function<void(uint64_t, uint64_t)> const& function) {
+    numberOfThreads = getNumberOfThreads(numberOfThreads);
+    if (numberOfThreads == 1) {
+        function(0, size);
+        return;
+    }
+    // Use more chunks than threads such that the threads can balance the work among them.
+    uint64_t const chunkSize = std::max<uint64_t>(1024, size / (8 * numberOfThreads) + 1);
+    uint64_t const numberOfChunks = (size + chunkSize - 1) / chunkSize;
+    executeTasks(numberOfThreads, numberOfChunks, [&](uint64_t chunk, uint64_t) { function(chunk * chunkSize, std::min(size, (chunk + 1) * chunkSize)); });
+}
+
+bool anyOfChunks(uint64_t numberOfThreads, uint64_t size, std::function<bool(uint64_t, uint64_t)> const& function) {
+    std::atomic<bool> result(false);
+    forEachChunk(numberOfThreads, size, [&](uint64_t first, uint64_t last) {
+        if (function(first, last)) {
+            result = true;
+        }
+    });
+    return result;
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
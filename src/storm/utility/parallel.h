@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * Indicates whether values of the given type can be copied and destroyed on several threads at the same time, even if the copies originate from the same
+ * (shared) object. This is not the case for exact or parametric numbers, whose representations are reference counted without synchronization.
+ * Computations on other value types have to be performed sequentially.
+ */
+template<typename ValueType>
+constexpr bool isThreadSafeValueType = std::is_same_v<ValueType, double>;
+
+/*!
+ * Retrieves the number of threads that are actually used if the given number of threads is requested.
+ * A request of zero threads is interpreted as 'use all available hardware threads'.
+ */
+uint64_t getNumberOfThreads(uint64_t requestedNumberOfThreads);
+
+/*!
+ * Invokes the given function on the given number of threads and waits until all invocations have finished.
+ * The calling thread participates in the computation, i.e., only numberOfThreads - 1 additional threads are spawned.
+ * If one of the invocations throws an exception, the (first) exception is rethrown in the calling thread.
+ *
+ * @param numberOfThreads the number of threads (zero means 'auto-detect').
+ * @param function the function to invoke. It receives the index of the thread it is executed on (in [0, numberOfThreads)).
+ */
+void executeOnThreads(uint64_t numberOfThreads, std::function<void(uint64_t)> const& function);
+
+/*!
+ * Invokes the given function for every task in [0, numberOfTasks). The tasks are dynamically distributed over the threads.
+ *
+ * @param numberOfThreads the number of threads (zero means 'auto-detect').
+ * @param numberOfTasks the number of tasks.
+ * @param function the function to invoke. It receives the index of the task and the index of the thread it is executed on.
+ */
+void executeTasks(uint64_t numberOfThreads, uint64_t numberOfTasks, std::function<void(uint64_t, uint64_t)> const& function);
+
+/*!
+ * Applies the given function to consecutive chunks of the range [0, size). The chunks are dynamically distributed over the threads.
+ * If a single thread is used, the function is invoked once for the whole range.
+ *
+ * @param numberOfThreads the number of threads (zero means 'auto-detect').
+ * @param size the size of the range.
+ * @param function the function to invoke. It receives the first and the (exclusive) last index of a chunk.
+ */
+void forEachChunk(uint64_t numberOfThreads, uint64_t size, std::function<void(uint64_t, uint64_t)> const& function);
+
+/*!
+ * Applies the given function to consecutive chunks of the range [0, size) as done by forEachChunk.
+ * All chunks are processed, even if the function already returned true for one of them.
+ *
+ * @return true iff the function returned true for at least one chunk.
+ */
+bool anyOfChunks(uint64_t numberOfThreads, uint64_t size, std::function<bool(uint64_t, uint64_t)> const& function);
+
+/*!
+ * Invokes the given function for every task in [0, dependencies.size()) such that a task is only started once all tasks it depends on have finished.
+ * Among the tasks that are ready to be executed, the one with the smallest index is started first.
+ * No further tasks are started once an exception was thrown or the termination of the program is requested.
+ *
+ * @param numberOfThreads the number of threads (zero means 'auto-detect').
+ * @param dependencies for each task the tasks it depends on. The induced graph is assumed to be acyclic.
+ * @param function the function to invoke. It receives the index of the task and the index of the thread it is executed on.
+ * @return true iff all tasks have been executed.
+ */
+bool executeTaskGraph(uint64_t numberOfThreads, std::vector<std::vector<uint64_t>> const& dependencies,
+                      std::function<void(uint64_t, uint64_t)> const& function);
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
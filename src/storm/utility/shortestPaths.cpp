@@ -1,5 +1,5 @@
+#include <algorithm>
 #include <ostream>
-#include <queue>
 #include <set>
 #include <string>
 
@@ -32,12 +32,8 @@ ShortestPathsGenerator<T>::ShortestPathsGenerator(storage::SparseMatrix<T> const
     // gives us SP-predecessors, SP-distances
     performDijkstra();
 
-    computeSPSuccessors();
-
     // constructs the recursive shortest path representations
     initializeShortestPaths();
-
-    candidatePaths.resize(numStates);
 }
 
 template<typename T>
@@ -186,44 +182,16 @@ void ShortestPathsGenerator<T>::performDijkstra() {
     }
 }
 
-template<typename T>
-void ShortestPathsGenerator<T>::computeSPSuccessors() {
-    shortestPathSuccessors.resize(numStates);
-
-    for (state_t i = 0; i < numStates; i++) {
-        if (shortestPathPredecessors[i]) {
-            state_t predecessor = shortestPathPredecessors[i].get();
-            shortestPathSuccessors[predecessor].push_back(i);
-        }
-    }
-}
-
 template<typename T>
 void ShortestPathsGenerator<T>::initializeShortestPaths() {
     kShortestPaths.resize(numStates);
 
-    // BFS in Dijkstra-SP order
-    std::queue<state_t> bfsQueue;
-    for (state_t initialState : initialStates) {
-        bfsQueue.push(initialState);
-    }
-
-    while (!bfsQueue.empty()) {
-        state_t currentNode = bfsQueue.front();
-        bfsQueue.pop();
-
-        if (!kShortestPaths[currentNode].empty()) {
-            continue;  // already visited
-        }
-
-        for (state_t successorNode : shortestPathSuccessors[currentNode]) {
-            bfsQueue.push(successorNode);
+    // Only the nodes reached by Dijkstra have a shortest path.
+    // note that `shortestPathPredecessor` is not present if the current node is an initial state
+    for (state_t node = 0; node < numStates; ++node) {
+        if (shortestPathPredecessors[node] || isInitialState(node)) {
+            kShortestPaths[node].push_back(Path<T>{shortestPathPredecessors[node], 1, shortestPathDistances[node]});
         }
-
-        // note that `shortestPathPredecessor` may not be present
-        // if current node is an initial state
-        // in this case, the boost::optional copy of an uninitialized optional is hopefully also uninitialized
-        kShortestPaths[currentNode].push_back(Path<T>{shortestPathPredecessors[currentNode], 1, shortestPathDistances[currentNode]});
     }
 }
 
@@ -251,25 +219,57 @@ T ShortestPathsGenerator<T>::getEdgeDistance(state_t tailNode, state_t headNode)
 
 template<typename T>
 void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
+    // Computing the k-shortest path to a node requires the next path to the predecessor on its (k-1)-shortest path (Steps B.2-5 in J&M paper),
+    // which in turn might require the next path to the predecessor of that predecessor and so on.
+    // We first collect this chain of required paths and then compute them from back to front.
+    std::vector<std::pair<state_t, unsigned long>> requiredPaths = {{node, k}};
+    while (true) {
+        state_t currentNode = requiredPaths.back().first;
+        unsigned long currentK = requiredPaths.back().second;
+        assert(currentK >= 2);                                       // Dijkstra is used for k=1
+        assert(kShortestPaths[currentNode].size() == currentK - 1);  // if not, the previous SP must not exist
+        if (currentK == 2 && isInitialState(currentNode)) {
+            break;
+        }
+        // the (k-1)th shortest path (i.e., one better than the one we want to compute)
+        Path<T> const& previousShortestPath = kShortestPaths[currentNode][currentK - 1 - 1];
+        state_t predecessor = previousShortestPath.predecessorNode.get();
+        unsigned long tailK = previousShortestPath.predecessorK;
+        if (kShortestPaths[predecessor].size() >= tailK + 1) {
+            // the one-worse-shortest path to the predecessor has already been computed
+            break;
+        }
+        requiredPaths.emplace_back(predecessor, tailK + 1);
+    }
+
+    for (auto requiredPathIt = requiredPaths.rbegin(); requiredPathIt != requiredPaths.rend(); ++requiredPathIt) {
+        addCandidatesAndSelectNextPath(requiredPathIt->first, requiredPathIt->second);
+    }
+}
+
+template<typename T>
+void ShortestPathsGenerator<T>::addCandidatesAndSelectNextPath(state_t node, unsigned long k) {
     assert(k >= 2);                                // Dijkstra is used for k=1
     assert(kShortestPaths[node].size() == k - 1);  // if not, the previous SP must not exist
 
-    // TODO: I could extract the candidate generation to make this function more succinct
+    std::vector<Path<T>>& candidates = candidatePaths[node];
+    auto addCandidate = [&candidates](Path<T>&& candidate) {
+        candidates.push_back(std::move(candidate));
+        std::push_heap(candidates.begin(), candidates.end(), candidateHeapOrder);
+    };
+
     if (k == 2) {
         // Step B.1 in J&M paper
 
-        Path<T> shortestPathToNode = kShortestPaths[node][1 - 1];  // never forget index shift :-|
+        Path<T> const& shortestPathToNode = kShortestPaths[node][1 - 1];  // never forget index shift :-|
 
         for (state_t predecessor : graphPredecessors[node]) {
-            // add shortest paths to predecessors plus edge to current node
+            // add shortest paths to predecessors plus edge to current node ...
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
                                                  shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
-
             // ... but not the actual shortest path
-            auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-            if (it != candidatePaths[node].end()) {
-                candidatePaths[node].erase(it);
+            if (!(pathToPredecessorPlusEdge == shortestPathToNode)) {
+                addCandidate(std::move(pathToPredecessorPlusEdge));
             }
         }
     }
@@ -278,7 +278,7 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
         // Steps B.2-5 in J&M paper
 
         // the (k-1)th shortest path (i.e., one better than the one we want to compute)
-        Path<T> previousShortestPath = kShortestPaths[node][k - 1 - 1];  // oh god, I forgot index shift AGAIN
+        Path<T> const& previousShortestPath = kShortestPaths[node][k - 1 - 1];  // oh god, I forgot index shift AGAIN
 
         // the predecessor node on that path
         state_t predecessor = previousShortestPath.predecessorNode.get();
@@ -287,32 +287,20 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
 
         // i.e. source ~~tailK-shortest path~~> predecessor --> node
 
-        // compute one-worse-shortest path to the predecessor (if it hasn't yet been computed)
-        if (kShortestPaths[predecessor].size() < tailK + 1) {
-            // TODO: investigate recursion depth and possible iterative alternative
-            computeNextPath(predecessor, tailK + 1);
-        }
-
+        // the one-worse-shortest path to the predecessor has been computed before (see computeNextPath), if it exists
         if (kShortestPaths[predecessor].size() >= tailK + 1) {
             // take that path, add an edge to the current node; that's a candidate
-            Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), tailK + 1,
-                                                 kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
+            addCandidate({boost::optional<state_t>(predecessor), tailK + 1,
+                          kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)});
         }
         // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
     }
 
     // Step B.6 in J&M paper
-    if (!candidatePaths[node].empty()) {
-        Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-        for (auto path : candidatePaths[node]) {
-            if (path.distance > minDistanceCandidate.distance) {
-                minDistanceCandidate = path;
-            }
-        }
-
-        candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-        kShortestPaths[node].push_back(minDistanceCandidate);
+    if (!candidates.empty()) {
+        std::pop_heap(candidates.begin(), candidates.end(), candidateHeapOrder);
+        kShortestPaths[node].push_back(std::move(candidates.back()));
+        candidates.pop_back();
     } else {
         // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
         STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
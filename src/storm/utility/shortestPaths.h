@@ -2,6 +2,7 @@
 #define STORM_UTIL_SHORTESTPATHS_H_
 
 #include <boost/optional/optional.hpp>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -126,11 +127,14 @@ class ShortestPathsGenerator {
 
     std::vector<OrderedStateList> graphPredecessors;
     std::vector<boost::optional<state_t>> shortestPathPredecessors;
-    std::vector<OrderedStateList> shortestPathSuccessors;
     std::vector<T> shortestPathDistances;
 
+    // The paths are stored implicitly, i.e., each path only refers to its predecessor node and the index of the path to that node.
+    // Hence, common prefixes are shared among the paths.
     std::vector<std::vector<Path<T>>> kShortestPaths;
-    std::vector<std::set<Path<T>>> candidatePaths;
+    // Candidates for the next shortest path, organized as heap (see `candidateHeapOrder`).
+    // Candidates are only stored for nodes for which more than one path has been requested.
+    std::unordered_map<state_t, std::vector<Path<T>>> candidatePaths;
 
     /*!
      * Computes list of predecessors for all nodes.
@@ -147,13 +151,6 @@ class ShortestPathsGenerator {
      */
     void performDijkstra();
 
-    /*!
-     * Computes list of shortest path successor nodes from predecessor list.
-     * Requires `shortestPathPredecessors`, `numStates`.
-     * Modifies `shortestPathSuccessors`.
-     */
-    void computeSPSuccessors();
-
     /*!
      * Constructs and stores the implicit shortest path representations (see `Path`) for the (1-)shortest paths.
      * Requires `shortestPathPredecessors`, `shortestPathDistances`, `model`, `numStates`.
@@ -162,10 +159,18 @@ class ShortestPathsGenerator {
     void initializeShortestPaths();
 
     /*!
-     * Main step of REA algorithm. TODO: Document further.
+     * Main step of REA algorithm: Computes the `k`-shortest path to `node`, assuming that the (k-1) shortest paths have been computed before.
+     * This might require the computation of further paths to the predecessors of `node`. These are computed iteratively (instead of recursively) to
+     * avoid deep recursions on long paths.
      */
     void computeNextPath(state_t node, unsigned long k);
 
+    /*!
+     * Adds the candidates for the `k`-shortest path to `node` and selects the best one.
+     * Assumes that the (k-1) shortest paths to `node` as well as the paths to the predecessors that are needed for the candidates have been computed.
+     */
+    void addCandidatesAndSelectNextPath(state_t node, unsigned long k);
+
     /*!
      * Computes k-shortest path if not yet computed.
      * @throws std::invalid_argument if no such k-shortest path exists
@@ -185,7 +190,16 @@ class ShortestPathsGenerator {
     // --- tiny helper fcts ---
 
     inline bool isInitialState(state_t node) const {
-        return std::find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
+        return node < initialStates.size() && initialStates.get(node);
+    }
+
+    // Order for the candidate heaps: the top of a heap is the candidate with the highest probability.
+    // Ties are broken by the (arbitrary) order of `Path`, preferring the smaller path.
+    inline static bool candidateHeapOrder(Path<T> const& lhs, Path<T> const& rhs) {
+        if (lhs.distance != rhs.distance) {
+            return lhs.distance < rhs.distance;
+        }
+        return rhs < lhs;
     }
 
     inline bool isMetaTargetPredecessor(state_t node) const {
@@ -107,6 +107,40 @@ void setVectorValues(std::vector<T>& vector, storm::storage::BitVector const& po
     }
 }
 
+/*!
+ * Writes the given values into the given interleaved vector, i.e., values[i] is written to position i * numberOfLanes + lane.
+ *
+ * @param interleavedVector The interleaved vector in which the values are to be set.
+ * @param values The values that are to be set.
+ * @param lane The lane to which the values belong.
+ * @param numberOfLanes The number of interleaved vectors.
+ */
+template<class T>
+void setVectorValuesInterleaved(std::vector<T>& interleavedVector, std::vector<T> const& values, uint64_t lane, uint64_t numberOfLanes) {
+    STORM_LOG_ASSERT(lane < numberOfLanes, "Invalid lane.");
+    STORM_LOG_ASSERT(interleavedVector.size() == values.size() * numberOfLanes, "Size mismatch of the interleaved vector and the values vector.");
+    for (uint64_t i = 0; i < values.size(); ++i) {
+        interleavedVector[i * numberOfLanes + lane] = values[i];
+    }
+}
+
+/*!
+ * Reads the values of the given lane from the given interleaved vector, i.e., values[i] is read from position i * numberOfLanes + lane.
+ *
+ * @param values The vector into which the values are written. Its size determines the number of read values.
+ * @param interleavedVector The interleaved vector from which the values are read.
+ * @param lane The lane that is to be read.
+ * @param numberOfLanes The number of interleaved vectors.
+ */
+template<class T>
+void getVectorValuesInterleaved(std::vector<T>& values, std::vector<T> const& interleavedVector, uint64_t lane, uint64_t numberOfLanes) {
+    STORM_LOG_ASSERT(lane < numberOfLanes, "Invalid lane.");
+    STORM_LOG_ASSERT(interleavedVector.size() == values.size() * numberOfLanes, "Size mismatch of the interleaved vector and the values vector.");
+    for (uint64_t i = 0; i < values.size(); ++i) {
+        values[i] = interleavedVector[i * numberOfLanes + lane];
+    }
+}
+
 template<typename T>
 void setNonzeroIndices(std::vector<T> const& vec, storm::storage::BitVector& bv) {
     STORM_LOG_ASSERT(bv.size() == vec.size(), "Bitvector size should match vector size");
@@ -0,0 +1,100 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include "storm-cli-utilities/model-handling.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/io/BinaryEncoding.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
+namespace {
+
+class ModelCacheTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        cacheDirectory = std::filesystem::temp_directory_path() / ("storm-model-cache-test-" + std::to_string(std::random_device()()));
+        std::filesystem::create_directories(cacheDirectory);
+        // Unset the option first so that it can be set from the command line again. Restoring the memento unsets it after the test.
+        modelCache = storm::settings::mutableBuildSettings().overrideModelCacheSet(false);
+        storm::settings::mutableManager().setFromExplodedString({"--model-cache", cacheDirectory.string()});
+    }
+
+    void TearDown() override {
+        modelCache.reset();
+        std::filesystem::remove_all(cacheDirectory);
+    }
+
+    std::shared_ptr<storm::models::sparse::Model<double>> buildModel(std::string const& programFile) {
+        storm::cli::SymbolicInput input;
+        input.model = storm::storage::SymbolicModelDescription(storm::api::parseProgram(programFile));
+        auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+        return storm::cli::buildModelSparse<double>(input, buildSettings)->as<storm::models::sparse::Model<double>>();
+    }
+
+    std::vector<std::filesystem::path> getCacheFiles() const {
+        std::vector<std::filesystem::path> result;
+        for (auto const& entry : std::filesystem::directory_iterator(cacheDirectory)) {
+            result.push_back(entry.path());
+        }
+        return result;
+    }
+
+    std::filesystem::path cacheDirectory;
+    std::unique_ptr<storm::settings::SettingMemento> modelCache;
+};
+
+TEST_F(ModelCacheTest, StoreAndLoad) {
+    std::string const programFile = STORM_TEST_RESOURCES_DIR "/dtmc/die.pm";
+    auto model = buildModel(programFile);
+    EXPECT_EQ(13ull, model->getNumberOfStates());
+    auto cacheFiles = getCacheFiles();
+    ASSERT_EQ(1ull, cacheFiles.size());
+    EXPECT_EQ(".stormbin", cacheFiles.front().extension().string());
+
+    // Replace the cached model by a different one to observe that the second run loads it from the cache.
+    storm::prism::Program otherProgram = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto otherModel = storm::builder::ExplicitModelBuilder<double>(otherProgram).build();
+    {
+        std::ofstream stream(cacheFiles.front(), std::ios::binary);
+        storm::exporter::binaryExportSparseModel(stream, otherModel);
+    }
+    EXPECT_EQ(otherModel->getNumberOfStates(), buildModel(programFile)->getNumberOfStates());
+    EXPECT_EQ(1ull, getCacheFiles().size());
+}
+
+TEST_F(ModelCacheTest, CorruptCacheFile) {
+    std::string const programFile = STORM_TEST_RESOURCES_DIR "/dtmc/die.pm";
+    buildModel(programFile);
+    auto cacheFiles = getCacheFiles();
+    ASSERT_EQ(1ull, cacheFiles.size());
+
+    // A corrupt cache file leads to rebuilding the model, which then replaces the corrupt file.
+    std::string content;
+    {
+        std::ifstream stream(cacheFiles.front(), std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream stream(cacheFiles.front(), std::ios::binary);
+        stream << content.substr(0, content.size() / 2);
+    }
+    EXPECT_EQ(13ull, buildModel(programFile)->getNumberOfStates());
+    std::ifstream stream(cacheFiles.front(), std::ios::binary);
+    EXPECT_EQ(13ull, storm::exporter::binaryImportSparseModel<double>(stream)->getNumberOfStates());
+}
+
+TEST_F(ModelCacheTest, DifferentInputs) {
+    EXPECT_EQ(13ull, buildModel(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm")->getNumberOfStates());
+    buildModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    EXPECT_EQ(2ull, getCacheFiles().size());
+    EXPECT_EQ(13ull, buildModel(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm")->getNumberOfStates());
+    EXPECT_EQ(2ull, getCacheFiles().size());
+}
+
+}  // namespace
@@ -0,0 +1,61 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_Z3
+#include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace {
+
+std::vector<storm::storage::FlatSet<uint_fast64_t>> computeLabelSets(std::string const& programFile, std::string const& formulaString,
+                                                                     uint64_t numberOfThreads) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(programFile);
+    storm::parser::FormulaParser formulaParser(program);
+    auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+
+    storm::generator::NextStateGeneratorOptions options(*formula);
+    options.setBuildChoiceOrigins(true);
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    storm::Environment env;
+    env.modelchecker().setNumberOfThreads(numberOfThreads);
+    storm::storage::SymbolicModelDescription symbolicModel(program);
+    using Generator = storm::counterexamples::SMTMinimalLabelSetGenerator<double>;
+    Generator::GeneratorStats stats;
+    Generator::Options generatorOptions(true);
+    generatorOptions.silent = true;
+    auto input = Generator::precompute(env, symbolicModel, *model, formula);
+    return Generator::computeCounterexampleLabelSet(env, stats, symbolicModel, *model, input, {}, generatorOptions);
+}
+
+TEST(SMTMinimalLabelSetGeneratorTest, Die) {
+    std::string const programFile = STORM_TEST_RESOURCES_DIR "/dtmc/die.pm";
+    std::string const formulaString = "P<=0.1 [F \"one\"]";
+
+    auto sequentialLabelSets = computeLabelSets(programFile, formulaString, 1);
+    ASSERT_EQ(1ull, sequentialLabelSets.size());
+    // The minimal label set is unique for this property.
+    EXPECT_EQ(sequentialLabelSets, computeLabelSets(programFile, formulaString, 4));
+}
+
+TEST(SMTMinimalLabelSetGeneratorTest, TwoDice) {
+    std::string const programFile = STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm";
+    std::string const formulaString = "P<=0.02 [F \"two\"]";
+
+    auto sequentialLabelSets = computeLabelSets(programFile, formulaString, 1);
+    ASSERT_EQ(1ull, sequentialLabelSets.size());
+    for (uint64_t numberOfThreads : {2ull, 3ull, 8ull}) {
+        auto parallelLabelSets = computeLabelSets(programFile, formulaString, numberOfThreads);
+        ASSERT_EQ(1ull, parallelLabelSets.size());
+        EXPECT_EQ(sequentialLabelSets.front().size(), parallelLabelSets.front().size()) << "Number of threads: " << numberOfThreads;
+    }
+}
+
+}  // namespace
+#endif
@@ -668,3 +668,29 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+TEST(DdJaniModelBuilderTest_Sylvan, VariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    for (auto heuristic : {storm::builder::DdVariableOrderHeuristic::Force, storm::builder::DdVariableOrderHeuristic::Clustered}) {
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+        options.variableOrderHeuristic = heuristic;
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = builder.build(janiModel, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    }
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    for (auto heuristic : {storm::builder::DdVariableOrderHeuristic::Force, storm::builder::DdVariableOrderHeuristic::Clustered}) {
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+        options.variableOrderHeuristic = heuristic;
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = builder.build(janiModel, options);
+        std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+        EXPECT_EQ(169ul, mdp->getNumberOfStates());
+        EXPECT_EQ(436ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(254ul, mdp->getNumberOfChoices());
+    }
+}
@@ -1,6 +1,7 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrder.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
@@ -12,6 +13,8 @@
 #include "storm/storage/SymbolicModelDescription.h"
 #include "test/storm_gtest.h"
 
+#include <algorithm>
+
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
@@ -337,3 +340,63 @@ TEST(UnboundedTest_Cudd, Mdp) {
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
     EXPECT_FALSE(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().canHandle(program));
 }
+
+TEST(DdPrismModelBuilderTest_Sylvan, VariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    for (auto heuristic : {storm::builder::DdVariableOrderHeuristic::Force, storm::builder::DdVariableOrderHeuristic::Clustered}) {
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+        options.variableOrderHeuristic = heuristic;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+            storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    }
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    for (auto heuristic : {storm::builder::DdVariableOrderHeuristic::Force, storm::builder::DdVariableOrderHeuristic::Clustered}) {
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+        options.variableOrderHeuristic = heuristic;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+            storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+        std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+        EXPECT_EQ(169ul, mdp->getNumberOfStates());
+        EXPECT_EQ(436ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(254ul, mdp->getNumberOfChoices());
+    }
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, VariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    for (auto heuristic : {storm::builder::DdVariableOrderHeuristic::Force, storm::builder::DdVariableOrderHeuristic::Clustered}) {
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+        options.variableOrderHeuristic = heuristic;
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model =
+            storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    }
+}
+
+TEST(DdVariableOrderTest, Force) {
+    // A chain whose nodes are initially scrambled. FORCE should (nearly) recover the chain.
+    uint64_t const numberOfNodes = 20;
+    std::vector<std::vector<uint64_t>> hyperedges;
+    for (uint64_t node = 0; node + 1 < numberOfNodes; ++node) {
+        hyperedges.push_back({node, node + 1});
+    }
+    std::vector<uint64_t> initialOrder;
+    for (uint64_t node = 0; node < numberOfNodes; ++node) {
+        initialOrder.push_back((node * 7) % numberOfNodes);
+    }
+    std::vector<uint64_t> order = storm::builder::computeForceOrder(initialOrder, hyperedges);
+    ASSERT_EQ(numberOfNodes, order.size());
+    std::vector<uint64_t> sortedOrder = order;
+    std::sort(sortedOrder.begin(), sortedOrder.end());
+    for (uint64_t node = 0; node < numberOfNodes; ++node) {
+        EXPECT_EQ(node, sortedOrder[node]);
+    }
+    EXPECT_LT(storm::builder::computeTotalSpan(order, hyperedges), storm::builder::computeTotalSpan(initialOrder, hyperedges));
+}
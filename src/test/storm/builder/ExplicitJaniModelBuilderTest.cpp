@@ -148,6 +148,29 @@ TEST(ExplicitJaniModelBuilderTest, Mdp) {
     EXPECT_EQ(59ul, model->getNumberOfTransitions());
 }
 
+TEST(ExplicitJaniModelBuilderTest, CachedSynchronizations) {
+    storm::builder::BuilderOptions options;
+    options.setCacheSynchronizations();
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(janiModel, options).build();
+    EXPECT_EQ(364ul, model->getNumberOfStates());
+    EXPECT_EQ(654ul, model->getNumberOfTransitions());
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm");
+    janiModel = program.toJani().substituteConstantsFunctions();
+    model = storm::builder::ExplicitModelBuilder<double>(janiModel, options).build();
+    EXPECT_EQ(4093ul, model->getNumberOfStates());
+    EXPECT_EQ(5585ul, model->getNumberOfTransitions());
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
+    janiModel = program.toJani().substituteConstantsFunctions();
+    model = storm::builder::ExplicitModelBuilder<double>(janiModel, options).build();
+    EXPECT_EQ(5ul, model->getNumberOfStates());
+    EXPECT_EQ(8ul, model->getNumberOfTransitions());
+}
+
 TEST(ExplicitJaniModelBuilderTest, Ma) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
     storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
@@ -2,7 +2,10 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/BaseException.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncoding.h"
+#include "storm/io/DirectEncodingExporter.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -176,6 +179,90 @@ TEST(ExplicitPrismModelBuilderTest, ExportExplicitLookup) {
     EXPECT_EQ(1ul, model->getLabelsOfState(lookup.lookup({{svar, manager.integer(7)}, {dvar, manager.integer(2)}})).count("two"));
 }
 
+TEST(ExplicitPrismModelBuilderTest, SpillingExplorationQueue) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    for (auto order : {storm::builder::ExplorationOrder::Bfs, storm::builder::ExplorationOrder::Dfs}) {
+        storm::builder::ExplicitModelBuilder<double>::Options options;
+        options.explorationOrder = order;
+        options.explorationQueueSpillThreshold = 10;
+        std::shared_ptr<storm::models::sparse::Model<double>> model =
+            storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), options).build();
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, ExportDuringExploration) {
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    for (std::string const& file : {"/dtmc/die.pm", "/mdp/two_dice.nm", "/ctmc/cluster2.sm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        for (auto order : {storm::builder::ExplorationOrder::Bfs, storm::builder::ExplorationOrder::Dfs}) {
+            storm::builder::ExplicitModelBuilder<double>::Options options;
+            options.explorationOrder = order;
+
+            // The result has to coincide with the export of the built model.
+            std::stringstream expected;
+            auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).build();
+            storm::exporter::explicitExportSparseModel(expected, model, {});
+            std::stringstream actual;
+            storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).exportModelAsDrn(actual);
+            EXPECT_EQ(expected.str(), actual.str()) << "for " << file;
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, BinaryExportRoundtrip) {
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setBuildChoiceLabels();
+    for (std::string const& file : {"/dtmc/die.pm", "/mdp/two_dice.nm", "/ctmc/cluster2.sm", "/ma/simple.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        std::stringstream binary;
+        storm::exporter::binaryExportSparseModel(binary, model);
+        auto importedModel = storm::exporter::binaryImportSparseModel<double>(binary);
+
+        // The imported model has to coincide with the original one.
+        std::stringstream expected, actual;
+        storm::exporter::explicitExportSparseModel(expected, model, {});
+        storm::exporter::explicitExportSparseModel(actual, importedModel, {});
+        EXPECT_EQ(expected.str(), actual.str()) << "for " << file;
+    }
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto model = storm::builder::ExplicitModelBuilder<storm::RationalNumber>(program, generatorOptions).build();
+    std::stringstream binary;
+    storm::exporter::binaryExportSparseModel(binary, model);
+    auto importedModel = storm::exporter::binaryImportSparseModel<storm::RationalNumber>(binary);
+    EXPECT_TRUE(model->getTransitionMatrix() == importedModel->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == importedModel->getStateLabeling());
+
+    std::stringstream invalid("no binary model");
+    STORM_SILENT_EXPECT_THROW(storm::exporter::binaryImportSparseModel<double>(invalid), storm::exceptions::WrongFormatException);
+}
+
+TEST(ExplicitPrismModelBuilderTest, BinaryImportCorrupt) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    std::stringstream binary;
+    storm::exporter::binaryExportSparseModel(binary, model);
+    std::string const content = binary.str();
+
+    // A truncated model (which is detected either at a length field or at the end of the input)
+    std::stringstream truncated(content.substr(0, content.size() / 2));
+    STORM_SILENT_EXPECT_THROW(storm::exporter::binaryImportSparseModel<double>(truncated), storm::exceptions::BaseException);
+
+    // A model whose number of rows exceeds the size of the input. The row count follows the format identifier and the model type.
+    std::string corruptContent = content;
+    uint64_t const rowCountOffset = std::string("storm-binary-model-v1").size() + sizeof(uint64_t);
+    std::fill_n(corruptContent.begin() + rowCountOffset, sizeof(uint64_t), '\xff');
+    std::stringstream corrupt(corruptContent);
+    STORM_SILENT_EXPECT_THROW(storm::exporter::binaryImportSparseModel<double>(corrupt), storm::exceptions::WrongFormatException);
+}
+
 bool trivial_true_mask(storm::expressions::SimpleValuation const&, uint64_t) {
     return true;
 }
@@ -0,0 +1,102 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <deque>
+#include <random>
+
+#include "storm/builder/ExplorationQueue.h"
+
+namespace {
+
+typedef storm::builder::ExplorationQueue<uint32_t>::EntryType EntryType;
+
+EntryType createEntry(uint64_t stateSize, uint32_t index) {
+    storm::generator::CompressedState state(stateSize);
+    for (uint64_t bitIndex = 0; bitIndex < stateSize; bitIndex += 7) {
+        state.set(bitIndex, (index + bitIndex) % 3 == 0);
+    }
+    return EntryType(state, index);
+}
+
+void testAgainstDeque(uint64_t stateSize, uint64_t memoryThreshold, double probabilityOfPushFront) {
+    storm::builder::ExplorationQueue<uint32_t> queue(stateSize, memoryThreshold);
+    std::deque<EntryType> reference;
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    // The spilled blocks never occupy more space than the largest number of states in the queue.
+    uint64_t const recordBytes = ((stateSize + 63) / 64 + 1) * sizeof(uint64_t);
+    uint64_t maximalSize = 0;
+    uint32_t nextIndex = 0;
+    for (uint64_t step = 0; step < 5000; ++step) {
+        // Push more often than pop such that the queue grows.
+        if (reference.empty() || distribution(generator) < 0.6) {
+            EntryType entry = createEntry(stateSize, nextIndex++);
+            if (distribution(generator) < probabilityOfPushFront) {
+                queue.pushFront(entry.first, entry.second);
+                reference.push_front(entry);
+            } else {
+                queue.pushBack(entry.first, entry.second);
+                reference.push_back(entry);
+            }
+        } else {
+            ASSERT_FALSE(queue.empty());
+            EXPECT_EQ(reference.front(), queue.popFront());
+            reference.pop_front();
+        }
+        ASSERT_EQ(reference.size(), queue.size());
+        maximalSize = std::max<uint64_t>(maximalSize, reference.size());
+        ASSERT_LE(queue.getSpillFileSize(), maximalSize * recordBytes);
+    }
+    while (!reference.empty()) {
+        ASSERT_FALSE(queue.empty());
+        EXPECT_EQ(reference.front(), queue.popFront());
+        reference.pop_front();
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(0ull, queue.getSpillFileSize());
+    if (memoryThreshold > 0) {
+        EXPECT_GT(queue.getNumberOfSpilledStates(), 0ull);
+    }
+}
+
+TEST(ExplorationQueueTest, BreadthFirst) {
+    testAgainstDeque(64, 0, 0.0);
+    testAgainstDeque(64, 100, 0.0);
+    testAgainstDeque(200, 13, 0.0);
+}
+
+TEST(ExplorationQueueTest, DepthFirst) {
+    testAgainstDeque(64, 0, 1.0);
+    testAgainstDeque(64, 100, 1.0);
+    testAgainstDeque(200, 13, 1.0);
+}
+
+TEST(ExplorationQueueTest, ReuseSpillFile) {
+    uint64_t const stateSize = 64;
+    storm::builder::ExplorationQueue<uint32_t> queue(stateSize, 10);
+    uint64_t const recordBytes = 2 * sizeof(uint64_t);
+    uint32_t nextIndex = 0;
+    for (uint64_t round = 0; round < 50; ++round) {
+        uint32_t const firstIndex = nextIndex;
+        for (uint64_t state = 0; state < 100; ++state) {
+            EntryType entry = createEntry(stateSize, nextIndex++);
+            queue.pushBack(entry.first, entry.second);
+        }
+        EXPECT_LE(queue.getSpillFileSize(), 100 * recordBytes);
+        for (uint32_t index = firstIndex; index < nextIndex; ++index) {
+            ASSERT_EQ(createEntry(stateSize, index), queue.popFront());
+        }
+        EXPECT_EQ(0ull, queue.getSpillFileSize());
+    }
+    // Far more states were spilled than the file ever held at the same time.
+    EXPECT_GT(queue.getNumberOfSpilledStates(), 1000ull);
+}
+
+TEST(ExplorationQueueTest, Mixed) {
+    testAgainstDeque(128, 1, 0.5);
+    testAgainstDeque(128, 50, 0.3);
+}
+
+}  // namespace
@@ -9,6 +9,7 @@
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
@@ -44,6 +45,19 @@ class SparseDoubleValueIterationEnvironment {
         return env;
     }
 };
+class SparseDoubleValueIterationMultiThreadedEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // Unused for sparse models
+    static const MaEngine engine = MaEngine::PrismSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::MarkovAutomaton<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env = SparseDoubleValueIterationEnvironment::createEnvironment();
+        env.modelchecker().setNumberOfThreads(2);
+        return env;
+    }
+};
 class JaniSparseDoubleValueIterationEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // Unused for sparse models
@@ -226,8 +240,9 @@ class MarkovAutomatonCslModelCheckerTest : public ::testing::Test {
     }
 };
 
-typedef ::testing::Types<SparseDoubleValueIterationEnvironment, JaniSparseDoubleValueIterationEnvironment, JaniHybridDoubleValueIterationEnvironment,
-                         SparseDoubleIntervalIterationEnvironment, SparseRationalPolicyIterationEnvironment, SparseRationalRationalSearchEnvironment>
+typedef ::testing::Types<SparseDoubleValueIterationEnvironment, SparseDoubleValueIterationMultiThreadedEnvironment, JaniSparseDoubleValueIterationEnvironment,
+                         JaniHybridDoubleValueIterationEnvironment, SparseDoubleIntervalIterationEnvironment, SparseRationalPolicyIterationEnvironment,
+                         SparseRationalRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MarkovAutomatonCslModelCheckerTest, TestingTypes, );
@@ -3,6 +3,8 @@
 
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm-parsers/parser/PrismParser.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -11,6 +13,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/ExplorationSettings.h"
+#include "storm/storage/jani/Model.h"
 
 TEST(SparseExplorationModelCheckerTest, Dice) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
@@ -101,3 +104,83 @@ TEST(SparseExplorationModelCheckerTest, Cicle) {
 
     EXPECT_NEAR(0.875, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
 }
+
+TEST(SparseExplorationModelCheckerTest, JaniDice) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::jani::Model model = program.toJani();
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(model);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.0277777612209320068, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"four\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.083333283662796020508, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+}
+
+TEST(SparseExplorationModelCheckerTest, ConcurrentAsynchronousLeader) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    storm::Environment env;
+    env.modelchecker().setNumberOfThreads(4);
+
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"elected\"]");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(1, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"elected\"]");
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(1, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+}
+
+TEST(SparseExplorationModelCheckerTest, ConcurrentDice) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    storm::Environment sequentialEnv;
+    storm::Environment concurrentEnv;
+    concurrentEnv.modelchecker().setNumberOfThreads(4);
+
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+    double const precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+
+    std::vector<std::pair<std::string, double>> formulasAndResults = {{"Pmin=? [F \"two\"]", 0.0277777612209320068},
+                                                                      {"Pmax=? [F \"three\"]", 0.0555555224418640136},
+                                                                      {"Pmin=? [F \"four\"]", 0.083333283662796020508}};
+    for (auto const& [formulaString, expectedResult] : formulasAndResults) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = checker.check(sequentialEnv, storm::modelchecker::CheckTask<>(*formula, true));
+        std::unique_ptr<storm::modelchecker::CheckResult> concurrentResult = checker.check(concurrentEnv, storm::modelchecker::CheckTask<>(*formula, true));
+        double sequentialValue = sequentialResult->asExplicitQuantitativeCheckResult<double>()[0];
+        double concurrentValue = concurrentResult->asExplicitQuantitativeCheckResult<double>()[0];
+
+        EXPECT_NEAR(expectedResult, concurrentValue, precision) << " for " << formulaString;
+        // Both results are within the precision of the actual value, so they differ by at most twice the precision.
+        EXPECT_NEAR(sequentialValue, concurrentValue, 2 * precision) << " for " << formulaString;
+    }
+}
@@ -5,6 +5,8 @@
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
@@ -476,6 +478,48 @@ TYPED_TEST(MultiObjectiveSchedRestModelCheckerTest, infrew) {
     EXPECT_TRUE(this->testParetoFormula(env, mdp, *formulas[formulaIndex], expected, errorString)) << errorString;
 }
 
+TEST(MultiObjectiveSchedRestModelCheckerTest, stepsPowerIteration) {
+    // Value iteration on a floating point model, which lets the deterministic scheduler helpers check all objectives in one interleaved run
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_stairs.nm";
+    std::string constantsString = "N=3";
+    std::string formulasAsString = "multi(Pmax=? [ F y=1], Pmax=? [ F y=2 ]);";
+    formulasAsString += "multi(Pmax=? [ F y=1], Pmax>=0.4 [ F y=2 ]);";
+
+    // programm, model, formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsString);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint64_t const initState = *mdp->getInitialStates().begin();
+
+    storm::Environment env = IndicatorEnvironment::getEnv();
+    env.modelchecker().multi().setSchedulerRestriction(storm::storage::SchedulerClass().setPositional().setIsDeterministic());
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    double const eps = 1e-4;
+    {
+        auto result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[0]->asMultiObjectiveFormula());
+        ASSERT_TRUE(result->isExplicitParetoCurveCheckResult());
+        std::vector<std::vector<double>> expected = {{0.875, 0},    {0, 0.875},    {0.125, 0.75}, {0.25, 0.625},
+                                                     {0.375, 0.5}, {0.5, 0.375}, {0.625, 0.25}, {0.75, 0.125}};
+        auto const& actual = result->asExplicitParetoCurveCheckResult<double>().getPoints();
+        EXPECT_EQ(expected.size(), actual.size());
+        for (auto const& expectedPoint : expected) {
+            EXPECT_TRUE(std::any_of(actual.begin(), actual.end(),
+                                    [&expectedPoint, &eps](auto const& actualPoint) {
+                                        return std::abs(expectedPoint[0] - actualPoint[0]) <= eps && std::abs(expectedPoint[1] - actualPoint[1]) <= eps;
+                                    }))
+                << "Missing point (" << expectedPoint[0] << ", " << expectedPoint[1] << ").";
+        }
+    }
+    {
+        auto result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[1]->asMultiObjectiveFormula());
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        EXPECT_NEAR(0.375, result->asExplicitQuantitativeCheckResult<double>()[initState], eps);
+    }
+}
+
 }  // namespace
 
 #endif /* defined STORM_HAVE_Z3_OPTIMIZE */
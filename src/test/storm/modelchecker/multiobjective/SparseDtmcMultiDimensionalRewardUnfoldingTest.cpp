@@ -4,6 +4,7 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/settings/SettingsManager.h"
@@ -45,6 +46,33 @@ TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_die) {
               result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_die_parallel) {
+    // Epochs are only analyzed concurrently for floating point numbers
+    storm::Environment env;
+    env.modelchecker().setNumberOfThreads(4);
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/die.pm";
+    std::string formulasAsString = "P=? [ F{\"coin_flips\"}<=2 \"two\" ] ";
+    formulasAsString += "; P=? [ F{\"coin_flips\"}<=3 \"two\" ] ";
+    formulasAsString += "; P=? [ F{\"coin_flips\"}<=8 \"two\" ] ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc =
+        storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+    double const precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    std::vector<double> expectedResults = {0.0, 1.0 / 8.0, 21.0 / 128.0};
+
+    for (uint64_t i = 0; i < formulas.size(); ++i) {
+        auto result = storm::api::verifyWithSparseEngine(env, dtmc, storm::api::createTask<double>(formulas[i], true));
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        EXPECT_NEAR(expectedResults[i], result->asExplicitQuantitativeCheckResult<double>()[initState], precision);
+    }
+}
+
 TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_leader) {
     storm::Environment env;
     std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm";
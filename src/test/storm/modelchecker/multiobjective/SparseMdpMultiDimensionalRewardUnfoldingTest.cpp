@@ -4,6 +4,7 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
@@ -163,6 +164,44 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_tiny_ec) {
     EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_tiny_ec_parallel) {
+    // Epochs are only analyzed concurrently for floating point numbers
+    storm::Environment env;
+    env.modelchecker().setNumberOfThreads(4);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/tiny_reward_bounded.nm";
+    std::string constantsDef = "";
+    std::string formulasAsString = "Pmax=? [multi( F{\"a\"}<=4 x=4, F{\"b\"}<=12 x=5 )] ";                   // 0.02
+    formulasAsString += "; \n Pmax=? [multi( F{\"a\"}<=4 x=4, F{\"b\"}<13 x=5, F{\"c\"}<2/5 x=3 )] ";   // 0.02
+    formulasAsString += "; \n Pmax=? [multi( F{\"a\"}<=0 x=3, F{\"b\"}<=17 x=4, F{\"c\"}<4/5 x=5 )] ";  // 0.02
+    // The Pareto curve of the following objectives is spanned by (0.1, 0) and (0, 0.19)
+    formulasAsString += "; \n multi(P>=0.05 [multi( F{\"a\"}<=0 x=3, F{\"c\"}<1/2 x=5 )], P>=0.09 [multi( F{\"b\"}<=0 x=3, F{\"c\"}<=4/5 x=5 )]) ";
+    formulasAsString += "; \n multi(P>=0.06 [multi( F{\"a\"}<=0 x=3, F{\"c\"}<1/2 x=5 )], P>=0.1 [multi( F{\"b\"}<=0 x=3, F{\"c\"}<=4/5 x=5 )]) ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    for (uint64_t i = 0; i < 3; ++i) {
+        result = storm::api::verifyWithSparseEngine(env, mdp, storm::api::createTask<double>(formulas[i], true));
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        EXPECT_NEAR(0.02, result->asExplicitQuantitativeCheckResult<double>()[initState],
+                    storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+
+    result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[3]->asMultiObjectiveFormula());
+    ASSERT_TRUE(result->isExplicitQualitativeCheckResult());
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initState]);
+    result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[4]->asMultiObjectiveFormula());
+    ASSERT_TRUE(result->isExplicitQualitativeCheckResult());
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[initState]);
+}
+
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_zeroconf_dl) {
     storm::Environment env;
 
@@ -3,6 +3,7 @@
 
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/hints/WarmStartHintCache.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -202,3 +203,64 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
 
     EXPECT_NEAR(30.0 / 7.0, quantitativeResult6[0], precision);
 }
+
+TEST(ExplicitMdpPrctlModelCheckerTest, WarmStartHints) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    storm::modelchecker::WarmStartHintCache<double> hints;
+
+    // Check each formula with and without the hint obtained from the previous (related) formulas.
+    for (std::string const& formulaString : {"Pmax=? [F<=3 \"two\"]", "Pmax=? [F<=10 \"two\"]", "Pmin=? [F<=10 \"two\"]", "Pmax=? [F \"three\"]",
+                                             "Pmax=? [F \"two\"]", "Rmin=? [F \"done\"]", "Rmin=? [F \"done\"]"}) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        EXPECT_TRUE(hints.isSupported(*formula)) << "for " << formulaString;
+        std::unique_ptr<storm::modelchecker::CheckResult> expectedResult = checker.check(env, *formula);
+
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+        task.setProduceSchedulers(!hints.isStepBounded(*formula));
+        if (auto hint = hints.getHint(*formula, true)) {
+            task.setHint(hint);
+        }
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, task);
+        hints.storeResult(*formula, *result);
+
+        auto const& expectedValues = expectedResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expectedValues.size(), values.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(expectedValues[state], values[state], precision) << "for " << formulaString << " at state " << state;
+        }
+    }
+
+    // Results for larger step bounds can not be continued.
+    EXPECT_EQ(nullptr, hints.getHint(*formulaParser.parseSingleFormulaFromString("Pmax=? [F<=5 \"two\"]"), true));
+    EXPECT_NE(nullptr, hints.getHint(*formulaParser.parseSingleFormulaFromString("Pmax=? [F<=15 \"two\"]"), true));
+    EXPECT_FALSE(hints.isSupported(*formulaParser.parseSingleFormulaFromString("P>0.5 [F \"two\"]")));
+
+    // Unbounded formulas are only related if their subformulas coincide.
+    EXPECT_NE(nullptr, hints.getHint(*formulaParser.parseSingleFormulaFromString("Pmax=? [F \"two\"]"), true));
+    EXPECT_EQ(nullptr, hints.getHint(*formulaParser.parseSingleFormulaFromString("Pmax=? [F \"four\"]"), true));
+    EXPECT_EQ(nullptr, hints.getHint(*formulaParser.parseSingleFormulaFromString("Rmin=? [F \"two\"]"), true));
+
+    // Announced formulas determine whether a result is needed later on.
+    storm::modelchecker::WarmStartHintCache<double> announcedHints;
+    auto first = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"two\"]");
+    auto second = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"three\"]");
+    for (auto const& formula : {first, second, first}) {
+        announcedHints.announceFormula(*formula);
+    }
+    announcedHints.withdrawFormula(*first);
+    EXPECT_TRUE(announcedHints.isRelatedToAnnouncedFormula(*first));
+    announcedHints.withdrawFormula(*second);
+    EXPECT_FALSE(announcedHints.isRelatedToAnnouncedFormula(*second));
+    announcedHints.withdrawFormula(*first);
+    EXPECT_FALSE(announcedHints.isRelatedToAnnouncedFormula(*first));
+}
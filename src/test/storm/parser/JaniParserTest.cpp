@@ -2,11 +2,25 @@
 #include "storm-config.h"
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm-parsers/parser/JaniParser.h"
+#include "storm/exceptions/InvalidJaniException.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/ModelType.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/storage/jani/visitor/JSONExporter.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/Stopwatch.h"
 #include "test/storm_gtest.h"
 
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+
 TEST(JaniParser, DieExampleTest) {
     std::string testInput = R"({
 	"jani-version": 1,
@@ -414,3 +428,118 @@ TEST(JaniParser, UnassignedVariablesTest) {
     EXPECT_TRUE(result.first.hasConstant("c"));
     EXPECT_EQ(2ul, result.first.getNumberOfAutomata());
 }
+
+TEST(JaniParser, SkipPropertiesTest) {
+    std::pair<storm::jani::Model, std::vector<storm::jani::Property>> result;
+    ASSERT_NO_THROW(result = storm::parser::JaniParser<storm::RationalNumber>::parse(STORM_TEST_RESOURCES_DIR "/ma/ftwc.jani", true));
+    std::pair<storm::jani::Model, std::vector<storm::jani::Property>> resultWithoutProperties;
+    ASSERT_NO_THROW(resultWithoutProperties = storm::parser::JaniParser<storm::RationalNumber>::parse(STORM_TEST_RESOURCES_DIR "/ma/ftwc.jani", false));
+    EXPECT_FALSE(result.second.empty());
+    EXPECT_TRUE(resultWithoutProperties.second.empty());
+
+    // Skipping the properties does not affect the model.
+    std::stringstream modelStream, modelWithoutPropertiesStream;
+    storm::jani::JsonExporter::toStream(result.first, {}, modelStream);
+    storm::jani::JsonExporter::toStream(resultWithoutProperties.first, {}, modelWithoutPropertiesStream);
+    EXPECT_EQ(modelStream.str(), modelWithoutPropertiesStream.str());
+
+    // Expressions are only shared if requested.
+    EXPECT_FALSE(result.first.getManager().isExpressionSharingEnabled());
+    std::unique_ptr<storm::settings::SettingMemento> shareExpressions = storm::settings::mutableBuildSettings().overrideShareExpressionsSet(true);
+    ASSERT_NO_THROW(result = storm::parser::JaniParser<storm::RationalNumber>::parse(STORM_TEST_RESOURCES_DIR "/ma/ftwc.jani", false));
+    EXPECT_TRUE(result.first.getManager().isExpressionSharingEnabled());
+    std::stringstream sharedModelStream;
+    storm::jani::JsonExporter::toStream(result.first, {}, sharedModelStream);
+    EXPECT_EQ(modelStream.str(), sharedModelStream.str());
+}
+
+namespace {
+/*!
+ * Generates a JANI model in which each of the given number of automata modifies its own global variable.
+ * The members of the model are given in the given order, where "header" stands for the version, name, type, and features of the model.
+ */
+std::string generateJaniModel(uint64_t numberOfAutomata, std::vector<std::string> const& memberOrder) {
+    std::map<std::string, std::stringstream> members;
+    members["header"] << R"("jani-version": 1, "name": "generated", "type": "dtmc", "features": [])";
+    members["actions"] << R"("actions": [])";
+    members["constants"] << R"("constants": [{"name": "bound", "type": "int", "value": 1}])";
+    members["variables"] << R"("variables": [)";
+    members["automata"] << R"("automata": [)";
+    members["system"] << R"("system": {"elements": [)";
+    for (uint64_t i = 0; i < numberOfAutomata; ++i) {
+        std::string separator = i == 0 ? "" : ", ";
+        std::string variable = "\"x" + std::to_string(i) + "\"";
+        members["variables"] << separator << R"({"name": )" << variable
+                             << R"(, "type": {"kind": "bounded", "base": "int", "lower-bound": 0, "upper-bound": "bound"}, "initial-value": 0})";
+        members["automata"] << separator << R"({"name": "a)" << i << R"(", "locations": [{"name": "l"}], "initial-locations": ["l"], "edges": [)"
+                            << R"({"location": "l", "guard": {"exp": {"op": "<", "left": )" << variable << R"(, "right": "bound"}}, "destinations": [)"
+                            << R"({"location": "l", "probability": {"exp": 0.5}, "assignments": [{"ref": )" << variable << R"(, "value": "bound"}]}, )"
+                            << R"({"location": "l", "probability": {"exp": 0.5}}]}]})";
+        members["system"] << separator << R"({"automaton": "a)" << i << R"("})";
+    }
+    members["variables"] << "]";
+    members["automata"] << "]";
+    members["system"] << "]}";
+
+    std::string result = "{";
+    for (auto const& member : memberOrder) {
+        result += (result.size() > 1 ? ", " : "") + members.at(member).str();
+    }
+    return result + "}";
+}
+}  // namespace
+
+TEST(JaniParser, MemberOrderTest) {
+    // Depending on the order of the members, the automata are translated while reading, buffered, or the input is read again.
+    std::vector<std::vector<std::string>> memberOrders = {{"header", "actions", "constants", "variables", "automata", "system"},
+                                                          {"actions", "automata", "constants", "header", "system", "variables"},
+                                                          {"header", "automata", "system", "variables", "constants", "actions"},
+                                                          {"header", "constants", "variables", "automata", "system", "actions"}};
+    std::string expectedModel;
+    for (auto const& memberOrder : memberOrders) {
+        std::pair<storm::jani::Model, std::vector<storm::jani::Property>> result;
+        ASSERT_NO_THROW(result = storm::parser::JaniParser<double>::parseFromString(generateJaniModel(5, memberOrder)));
+        EXPECT_EQ(5ull, result.first.getNumberOfAutomata());
+        EXPECT_EQ(5ull, result.first.getGlobalVariables().getNumberOfVariables());
+        std::stringstream modelStream;
+        storm::jani::JsonExporter::toStream(result.first, {}, modelStream);
+        if (expectedModel.empty()) {
+            expectedModel = modelStream.str();
+        } else {
+            EXPECT_EQ(expectedModel, modelStream.str());
+        }
+    }
+
+    std::string duplicateMember = generateJaniModel(1, {"header", "actions", "constants", "variables", "automata", "system"});
+    duplicateMember.insert(duplicateMember.size() - 1, R"(, "constants": [])");
+    STORM_SILENT_EXPECT_THROW(storm::parser::JaniParser<double>::parseFromString(duplicateMember), storm::exceptions::InvalidJaniException);
+}
+
+TEST(JaniParser, DISABLED_LargeModelBenchmark) {
+    // Reports the time and the peak memory consumption of parsing a large model.
+    uint64_t const numberOfAutomata = 20000;
+    std::filesystem::path file = std::filesystem::temp_directory_path() / ("storm-jani-benchmark-" + std::to_string(std::random_device()()) + ".jani");
+    {
+        std::ofstream stream(file);
+        stream << generateJaniModel(numberOfAutomata, {"header", "actions", "constants", "variables", "automata", "system"});
+    }
+    std::cout << "Generated model with " << numberOfAutomata << " automata and variables (" << std::filesystem::file_size(file) / 1024 << "KB).\n";
+
+    storm::utility::Stopwatch stopwatch(true);
+    auto result = storm::parser::JaniParser<double>::parse(file.string());
+    stopwatch.stop();
+    std::filesystem::remove(file);
+    EXPECT_EQ(numberOfAutomata, result.first.getNumberOfAutomata());
+    std::cout << "Parsing took " << stopwatch << ".\n";
+#if defined LINUX || defined MACOS
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    std::cout << "Peak memory usage: " << ru.ru_maxrss / 1024 / 1024 << "MB.\n";
+#else
+    // For Linux, this is returned in kilobytes.
+    std::cout << "Peak memory usage: " << ru.ru_maxrss / 1024 << "MB.\n";
+#endif
+#endif
+}
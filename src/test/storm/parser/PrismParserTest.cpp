@@ -5,6 +5,9 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 TEST(PrismParser, StandardModelTest) {
     storm::prism::Program result;
@@ -202,6 +205,34 @@ TEST(PrismParser, NAryPredicates) {
     EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
 }
 
+TEST(PrismParser, SharedExpressionsTest) {
+    std::string testInput =
+        R"(mdp
+
+    module example
+    s : [0..4] init 0;
+    i : bool init true;
+    [a] s<3 & i -> 1: (s'=s+1);
+    [b] s<3 & i -> 1: (s'=s+1) & (i'=false);
+    endmodule
+    )";
+
+    std::unique_ptr<storm::settings::SettingMemento> shareExpressions = storm::settings::mutableBuildSettings().overrideShareExpressionsSet(true);
+    storm::prism::Program result;
+    ASSERT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
+    EXPECT_TRUE(result.getManager().isExpressionSharingEnabled());
+
+    // Equal expressions are shared including their operands, because sharing is enabled before parsing.
+    storm::prism::Module const& module = result.getModule(0);
+    EXPECT_TRUE(module.getCommand(0).getGuardExpression().areSame(module.getCommand(1).getGuardExpression()));
+    EXPECT_TRUE(module.getCommand(0).getUpdate(0).getAssignment("s").getExpression().areSame(
+        module.getCommand(1).getUpdate(0).getAssignment("s").getExpression()));
+
+    shareExpressions.reset();
+    ASSERT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
+    EXPECT_FALSE(result.getManager().isExpressionSharingEnabled());
+}
+
 TEST(PrismParser, IllegalInputTest) {
     std::string testInput =
         R"(ctmc
@@ -1,10 +1,13 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <random>
+
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/solver/StandardGameSolver.h"
@@ -38,6 +41,17 @@ class DoublePiEnvironment {
     }
 };
 
+class DoubleParallelPiEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env = DoublePiEnvironment::createEnvironment();
+        env.modelchecker().setNumberOfThreads(4);
+        return env;
+    }
+};
+
 class RationalPiEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -68,7 +82,7 @@ class GameSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoublePiEnvironment, RationalPiEnvironment> TestingTypes;
+typedef ::testing::Types<DoubleViEnvironment, DoublePiEnvironment, DoubleParallelPiEnvironment, RationalPiEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(GameSolverTest, TestingTypes, );
 
@@ -132,4 +146,57 @@ TYPED_TEST(GameSolverTest, SolveEquations) {
     EXPECT_NEAR(this->parseNumber("1"), result[0], this->precision());
 }
 
+TEST(GameSolverTest, ParallelPolicyIteration) {
+    // Create a random game that is large enough for the improvement steps to be split into several chunks. Each player 1
+    // state has two player 2 successors with two choices each. All choices are substochastic, so the solution is unique.
+    uint64_t const numberOfPlayer1States = 10000;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint64_t> stateDistribution(0, numberOfPlayer1States - 1);
+    std::uniform_real_distribution<double> rewardDistribution(0.0, 0.1);
+    storm::storage::SparseMatrixBuilder<double> player2MatrixBuilder(0, numberOfPlayer1States, 0, false, true);
+    std::vector<uint64_t> player1Grouping;
+    std::vector<double> b;
+    uint64_t row = 0;
+    for (uint64_t player1State = 0; player1State < numberOfPlayer1States; ++player1State) {
+        player1Grouping.push_back(2 * player1State);
+        for (uint64_t player2State = 0; player2State < 2; ++player2State) {
+            player2MatrixBuilder.newRowGroup(row);
+            for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+                uint64_t firstSuccessor = stateDistribution(generator);
+                uint64_t secondSuccessor = stateDistribution(generator);
+                if (firstSuccessor == secondSuccessor) {
+                    player2MatrixBuilder.addNextValue(row, firstSuccessor, 0.9);
+                } else {
+                    player2MatrixBuilder.addNextValue(row, std::min(firstSuccessor, secondSuccessor), 0.45);
+                    player2MatrixBuilder.addNextValue(row, std::max(firstSuccessor, secondSuccessor), 0.45);
+                }
+                b.push_back(rewardDistribution(generator));
+            }
+        }
+    }
+    player1Grouping.push_back(2 * numberOfPlayer1States);
+    storm::storage::SparseMatrix<double> player2Matrix = player2MatrixBuilder.build();
+
+    storm::Environment sequentialEnv = DoublePiEnvironment::createEnvironment();
+    storm::Environment parallelEnv = DoubleParallelPiEnvironment::createEnvironment();
+    storm::solver::GameSolverFactory<double> factory;
+    auto sequentialSolver = factory.create(sequentialEnv, player1Grouping, player2Matrix);
+    auto parallelSolver = factory.create(parallelEnv, player1Grouping, player2Matrix);
+    for (auto solver : {sequentialSolver.get(), parallelSolver.get()}) {
+        solver->setHasUniqueSolution(true);
+        solver->setTrackSchedulers(true);
+    }
+
+    std::vector<double> sequentialResult(numberOfPlayer1States, 0.0);
+    std::vector<double> parallelResult(numberOfPlayer1States, 0.0);
+    sequentialSolver->solveGame(sequentialEnv, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, sequentialResult, b);
+    parallelSolver->solveGame(parallelEnv, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, parallelResult, b);
+    for (uint64_t player1State = 0; player1State < numberOfPlayer1States; ++player1State) {
+        EXPECT_NEAR(sequentialResult[player1State], parallelResult[player1State], 1e-6);
+    }
+    ASSERT_TRUE(parallelSolver->hasSchedulers());
+    EXPECT_EQ(sequentialSolver->getPlayer1SchedulerChoices(), parallelSolver->getPlayer1SchedulerChoices());
+    EXPECT_EQ(sequentialSolver->getPlayer2SchedulerChoices(), parallelSolver->getPlayer2SchedulerChoices());
+}
+
 }  // namespace
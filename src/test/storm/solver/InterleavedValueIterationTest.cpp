@@ -0,0 +1,136 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/vector.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createDtmcMatrix() {
+    // A small chain with a self-loop at state 0 and a sink state 3
+    storm::storage::SparseMatrixBuilder<double> builder(4, 4, 7);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 0, 0.2);
+    builder.addNextValue(1, 2, 0.6);
+    builder.addNextValue(1, 3, 0.2);
+    builder.addNextValue(2, 1, 0.3);
+    builder.addNextValue(2, 3, 0.7);
+    return builder.build();
+}
+
+storm::storage::SparseMatrix<double> createMdpMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(5, 3, 7, true, true, 3);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 2, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.4);
+    builder.addNextValue(2, 2, 0.6);
+    builder.addNextValue(3, 2, 1.0);
+    builder.newRowGroup(4);
+    builder.addNextValue(4, 2, 1.0);
+    return builder.build();
+}
+
+}  // namespace
+
+TEST(InterleavedValueIterationTest, Dtmc) {
+    auto matrix = createDtmcMatrix();
+    std::vector<std::vector<double>> offsets = {{1.0, 0.0, 2.0, 0.0}, {0.0, 3.0, 0.0, 0.0}, {0.5, 0.5, 0.5, 0.0}};
+    double const precision = 1e-10;
+
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, true>>();
+    viOperator->setMatrixBackwards(matrix);
+    storm::solver::helper::ValueIterationHelper<double, true> viHelper(viOperator);
+
+    // Solve each equation system individually
+    std::vector<std::vector<double>> expected;
+    for (auto const& b : offsets) {
+        auto& x = expected.emplace_back(matrix.getRowCount(), 0.0);
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, viHelper.VI(x, b, false, precision));
+    }
+
+    // Solve them at once
+    uint64_t const numOperands = offsets.size();
+    std::vector<double> interleavedX(matrix.getRowCount() * numOperands, 0.0);
+    std::vector<double> interleavedB(matrix.getRowCount() * numOperands);
+    for (uint64_t lane = 0; lane < numOperands; ++lane) {
+        storm::utility::vector::setVectorValuesInterleaved(interleavedB, offsets[lane], lane, numOperands);
+    }
+    uint64_t numIterations = 0;
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, viHelper.interleavedVI(interleavedX, interleavedB, numOperands, numIterations, false, precision));
+    EXPECT_GT(numIterations, 0ull);
+    std::vector<double> x(matrix.getRowCount());
+    for (uint64_t lane = 0; lane < numOperands; ++lane) {
+        storm::utility::vector::getVectorValuesInterleaved(x, interleavedX, lane, numOperands);
+        for (uint64_t state = 0; state < x.size(); ++state) {
+            EXPECT_NEAR(expected[lane][state], x[state], 1e-8) << "lane " << lane << ", state " << state;
+        }
+    }
+}
+
+TEST(InterleavedValueIterationTest, DtmcFixedEntries) {
+    auto matrix = createDtmcMatrix();
+    uint64_t const numOperands = 2;
+    // The second operand only considers states 0 and 1, i.e., states 2 and 3 are fixed to zero.
+    std::vector<double> interleavedB = {1.0, 1.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0};
+    std::vector<double> interleavedX(interleavedB.size(), 0.0);
+    storm::storage::BitVector fixedEntries(interleavedB.size(), {5, 7});
+
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, true>>();
+    viOperator->setMatrixBackwards(matrix);
+    storm::solver::helper::ValueIterationHelper<double, true> viHelper(viOperator);
+    uint64_t numIterations = 0;
+    EXPECT_EQ(storm::solver::SolverStatus::Converged,
+              viHelper.interleavedVI(interleavedX, interleavedB, numOperands, numIterations, false, 1e-10, {}, {}, &fixedEntries));
+
+    // Second operand: x0 = 1 + 0.5 x0 + 0.5 x1, x1 = 1 + 0.2 x0 (x2 = x3 = 0)
+    EXPECT_NEAR(3.75, interleavedX[0 * numOperands + 1], 1e-7);
+    EXPECT_NEAR(1.75, interleavedX[1 * numOperands + 1], 1e-7);
+    EXPECT_EQ(0.0, interleavedX[2 * numOperands + 1]);
+    EXPECT_EQ(0.0, interleavedX[3 * numOperands + 1]);
+    // First operand is not affected
+    std::vector<double> x(matrix.getRowCount(), 0.0);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, viHelper.VI(x, {1.0, 1.0, 1.0, 0.0}, false, 1e-10));
+    for (uint64_t state = 0; state < x.size(); ++state) {
+        EXPECT_NEAR(x[state], interleavedX[state * numOperands], 1e-8);
+    }
+}
+
+TEST(InterleavedValueIterationTest, Mdp) {
+    auto matrix = createMdpMatrix();
+    std::vector<std::vector<double>> offsets = {{1.0, 0.0, 2.0, 0.5, 0.0}, {0.0, 4.0, 1.0, 3.0, 0.0}};
+    uint64_t const numOperands = offsets.size();
+    double const precision = 1e-10;
+
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+    viOperator->setMatrixBackwards(matrix);
+    storm::solver::helper::ValueIterationHelper<double, false> viHelper(viOperator);
+
+    std::vector<double> interleavedX(matrix.getRowGroupCount() * numOperands, 0.0);
+    std::vector<double> interleavedB(matrix.getRowCount() * numOperands);
+    for (uint64_t lane = 0; lane < numOperands; ++lane) {
+        storm::utility::vector::setVectorValuesInterleaved(interleavedB, offsets[lane], lane, numOperands);
+    }
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::fill(interleavedX.begin(), interleavedX.end(), 0.0);
+        uint64_t numIterations = 0;
+        EXPECT_EQ(storm::solver::SolverStatus::Converged,
+                  viHelper.interleavedVI(interleavedX, interleavedB, numOperands, numIterations, false, precision, dir));
+        std::vector<double> x(matrix.getRowGroupCount());
+        for (uint64_t lane = 0; lane < numOperands; ++lane) {
+            std::vector<double> expected(matrix.getRowGroupCount(), 0.0);
+            EXPECT_EQ(storm::solver::SolverStatus::Converged, viHelper.VI(expected, offsets[lane], false, precision, dir));
+            storm::utility::vector::getVectorValuesInterleaved(x, interleavedX, lane, numOperands);
+            for (uint64_t state = 0; state < x.size(); ++state) {
+                EXPECT_NEAR(expected[state], x[state], 1e-8) << "lane " << lane << ", state " << state;
+            }
+        }
+    }
+}
@@ -0,0 +1,222 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+/*!
+ * A backend that performs a single (Jacobi-style) iteration, maximizing over the rows of each group.
+ */
+class MaxBackend {
+   public:
+    void startNewIteration() {}
+    void firstRow(double&& value, uint64_t, uint64_t) {
+        best = value;
+    }
+    void nextRow(double&& value, uint64_t, uint64_t) {
+        best = std::max(best, value);
+    }
+    void applyUpdate(double& currValue, uint64_t) {
+        currValue = best;
+    }
+    void endOfIteration() const {}
+    bool converged() const {
+        return false;
+    }
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    double best;
+};
+
+/*!
+ * Creates a random interval MDP whose intervals contain the (randomly chosen) distribution of a point-estimate MDP.
+ */
+storm::storage::SparseMatrix<storm::Interval> createRandomIntervalMatrix(uint64_t numStates, uint64_t numChoices, uint64_t numSuccessors, double width,
+                                                                         uint64_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<uint64_t> stateDistribution(0, numStates - 1);
+    std::uniform_real_distribution<double> weightDistribution(0.1, 1.0);
+    storm::storage::SparseMatrixBuilder<storm::Interval> builder(numStates * numChoices, numStates, 0, true, true, numStates);
+    std::vector<uint64_t> successors;
+    std::vector<double> weights;
+    for (uint64_t state = 0; state < numStates; ++state) {
+        builder.newRowGroup(state * numChoices);
+        for (uint64_t choice = 0; choice < numChoices; ++choice) {
+            successors.clear();
+            while (successors.size() < numSuccessors) {
+                uint64_t successor = stateDistribution(generator);
+                if (std::find(successors.begin(), successors.end(), successor) == successors.end()) {
+                    successors.push_back(successor);
+                }
+            }
+            std::sort(successors.begin(), successors.end());
+            weights.clear();
+            double sum = 0.0;
+            for (uint64_t i = 0; i < numSuccessors; ++i) {
+                weights.push_back(weightDistribution(generator));
+                sum += weights.back();
+            }
+            for (uint64_t i = 0; i < numSuccessors; ++i) {
+                double probability = weights[i] / sum;
+                builder.addNextValue(state * numChoices + choice, successors[i],
+                                     storm::Interval(std::max(0.0, probability - width), std::min(1.0, probability + width)));
+            }
+        }
+    }
+    return builder.build();
+}
+
+/*!
+ * The straightforward robust Bellman backup that sorts all successors of each row in each iteration. Serves as reference.
+ */
+template<storm::OptimizationDirection RobustDirection>
+void referenceBackup(storm::storage::SparseMatrix<storm::Interval> const& matrix, std::vector<storm::Interval> const& offsets,
+                     std::vector<double> const& operandIn, std::vector<double>& operandOut) {
+    for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+        double best = -storm::utility::infinity<double>();
+        for (uint64_t row = matrix.getRowGroupIndices()[group]; row < matrix.getRowGroupIndices()[group + 1]; ++row) {
+            double result = offsets[row].upper();
+            double remainingValue = 1.0;
+            std::vector<std::pair<double, double>> valueWidthPairs;
+            for (auto const& entry : matrix.getRow(row)) {
+                result += operandIn[entry.getColumn()] * entry.getValue().lower();
+                remainingValue -= entry.getValue().lower();
+                if (!storm::utility::isZero(entry.getValue().diameter())) {
+                    valueWidthPairs.emplace_back(operandIn[entry.getColumn()], entry.getValue().diameter());
+                }
+            }
+            if (!storm::utility::isZero(remainingValue) && !storm::utility::isOne(remainingValue)) {
+                std::sort(valueWidthPairs.begin(), valueWidthPairs.end(), [](auto const& a, auto const& b) {
+                    return RobustDirection == storm::OptimizationDirection::Maximize ? a.first > b.first : a.first < b.first;
+                });
+                for (auto const& valueWidthPair : valueWidthPairs) {
+                    double availableMass = std::min(valueWidthPair.second, remainingValue);
+                    result += availableMass * valueWidthPair.first;
+                    remainingValue -= availableMass;
+                    if (storm::utility::isZero(remainingValue)) {
+                        break;
+                    }
+                }
+            }
+            best = std::max(best, result);
+        }
+        operandOut[group] = best;
+    }
+}
+
+template<storm::OptimizationDirection RobustDirection>
+void checkAgainstReference(uint64_t numStates, uint64_t numIterations) {
+    auto matrix = createRandomIntervalMatrix(numStates, 3, 8, 0.05, 42);
+    std::vector<storm::Interval> offsets(matrix.getRowCount(), storm::Interval(0.0, 0.0));
+    for (uint64_t row = 0; row < matrix.getRowCount(); row += 7) {
+        offsets[row] = storm::Interval(1.0, 1.0);
+    }
+
+    storm::solver::helper::ValueIterationOperator<storm::Interval, false, double> viOperator;
+    viOperator.setMatrixBackwards(matrix);
+    MaxBackend backend;
+
+    // Keep the order of the successors across the iterations, as the value iteration helper does.
+    auto robustOrder = viOperator.createRobustOrder();
+    std::vector<double> operand(numStates, 0.0), operandAux(numStates, 0.0);
+    // A second sequence of applications with the opposite direction shares the operator but uses its own order.
+    auto oppositeRobustOrder = viOperator.createRobustOrder();
+    std::vector<double> oppositeOperand(numStates, 0.0), oppositeOperandAux(numStates, 0.0);
+    for (uint64_t iteration = 0; iteration < numIterations; ++iteration) {
+        viOperator.applyRobust<RobustDirection>(operand, operandAux, offsets, backend, &robustOrder);
+        std::swap(operand, operandAux);
+        viOperator.applyRobust<storm::solver::invert(RobustDirection)>(oppositeOperand, oppositeOperandAux, offsets, backend, &oppositeRobustOrder);
+        std::swap(oppositeOperand, oppositeOperandAux);
+    }
+
+    std::vector<double> referenceOperand(numStates, 0.0), referenceOperandAux(numStates, 0.0);
+    std::vector<double> oppositeReferenceOperand(numStates, 0.0), oppositeReferenceOperandAux(numStates, 0.0);
+    for (uint64_t iteration = 0; iteration < numIterations; ++iteration) {
+        referenceBackup<RobustDirection>(matrix, offsets, referenceOperand, referenceOperandAux);
+        std::swap(referenceOperand, referenceOperandAux);
+        referenceBackup<storm::solver::invert(RobustDirection)>(matrix, offsets, oppositeReferenceOperand, oppositeReferenceOperandAux);
+        std::swap(oppositeReferenceOperand, oppositeReferenceOperandAux);
+    }
+
+    for (uint64_t state = 0; state < numStates; ++state) {
+        EXPECT_NEAR(referenceOperand[state], operand[state], 1e-9 * std::max(1.0, referenceOperand[state])) << " at state " << state;
+        EXPECT_NEAR(oppositeReferenceOperand[state], oppositeOperand[state], 1e-9 * std::max(1.0, oppositeReferenceOperand[state]))
+            << " at state " << state;
+    }
+
+    // Without a given order, each application sorts the successors from scratch.
+    std::vector<double> freshOperand(numStates, 0.0), freshOperandAux(numStates, 0.0);
+    for (uint64_t iteration = 0; iteration < numIterations; ++iteration) {
+        viOperator.applyRobust<RobustDirection>(freshOperand, freshOperandAux, offsets, backend);
+        std::swap(freshOperand, freshOperandAux);
+    }
+    for (uint64_t state = 0; state < numStates; ++state) {
+        EXPECT_NEAR(referenceOperand[state], freshOperand[state], 1e-9 * std::max(1.0, referenceOperand[state])) << " at state " << state;
+    }
+}
+
+template<storm::OptimizationDirection RobustDirection>
+void benchmarkAgainstReference(uint64_t numStates, uint64_t numIterations) {
+    auto matrix = createRandomIntervalMatrix(numStates, 3, 8, 0.05, 42);
+    std::vector<storm::Interval> offsets(matrix.getRowCount(), storm::Interval(1.0, 1.0));
+    storm::solver::helper::ValueIterationOperator<storm::Interval, false, double> viOperator;
+    viOperator.setMatrixBackwards(matrix);
+    MaxBackend backend;
+
+    storm::utility::Stopwatch keptOrderWatch(true);
+    auto robustOrder = viOperator.createRobustOrder();
+    std::vector<double> operand(numStates, 0.0), operandAux(numStates, 0.0);
+    for (uint64_t iteration = 0; iteration < numIterations; ++iteration) {
+        viOperator.applyRobust<RobustDirection>(operand, operandAux, offsets, backend, &robustOrder);
+        std::swap(operand, operandAux);
+    }
+    keptOrderWatch.stop();
+
+    storm::utility::Stopwatch sortedWatch(true);
+    std::vector<double> sortedOperand(numStates, 0.0), sortedOperandAux(numStates, 0.0);
+    for (uint64_t iteration = 0; iteration < numIterations; ++iteration) {
+        viOperator.applyRobust<RobustDirection>(sortedOperand, sortedOperandAux, offsets, backend);
+        std::swap(sortedOperand, sortedOperandAux);
+    }
+    sortedWatch.stop();
+
+    storm::utility::Stopwatch referenceWatch(true);
+    std::vector<double> referenceOperand(numStates, 0.0), referenceOperandAux(numStates, 0.0);
+    for (uint64_t iteration = 0; iteration < numIterations; ++iteration) {
+        referenceBackup<RobustDirection>(matrix, offsets, referenceOperand, referenceOperandAux);
+        std::swap(referenceOperand, referenceOperandAux);
+    }
+    referenceWatch.stop();
+
+    for (uint64_t state = 0; state < numStates; ++state) {
+        ASSERT_NEAR(referenceOperand[state], operand[state], 1e-9 * std::max(1.0, referenceOperand[state])) << " at state " << state;
+    }
+    std::cout << numIterations << " robust (" << (RobustDirection == storm::OptimizationDirection::Maximize ? "max" : "min") << ") iterations on "
+              << numStates << " states took " << keptOrderWatch << " with a kept successor order, " << sortedWatch << " with sorting in the operator and "
+              << referenceWatch << " with the sort-based reference.\n";
+}
+
+TEST(RobustValueIterationOperatorTest, MatchesReference) {
+    checkAgainstReference<storm::OptimizationDirection::Minimize>(200, 50);
+    checkAgainstReference<storm::OptimizationDirection::Maximize>(200, 50);
+}
+
+TEST(RobustValueIterationOperatorTest, DISABLED_Benchmark) {
+    benchmarkAgainstReference<storm::OptimizationDirection::Minimize>(100000, 100);
+    benchmarkAgainstReference<storm::OptimizationDirection::Maximize>(100000, 100);
+}
+
+}  // namespace
@@ -0,0 +1,153 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/sparse/AnalysisCache.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createChain(uint64_t numberOfStates) {
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state + 1 < numberOfStates; ++state) {
+        builder.addNextValue(state, state, 0.5);
+        builder.addNextValue(state, state + 1, 0.5);
+    }
+    builder.addNextValue(numberOfStates - 1, numberOfStates - 1, 1.0);
+    return builder.build();
+}
+
+std::shared_ptr<storm::models::sparse::Dtmc<double>> createDtmc(uint64_t numberOfStates) {
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    return std::make_shared<storm::models::sparse::Dtmc<double>>(createChain(numberOfStates), std::move(labeling));
+}
+
+class AnalysisCacheTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        storm::storage::sparse::AnalysisCache::instance().clear();
+        storm::storage::sparse::AnalysisCache::instance().setMemoryLimit(1024 * 1024);
+    }
+
+    void TearDown() override {
+        storm::storage::sparse::AnalysisCache::instance().clear();
+        storm::storage::sparse::AnalysisCache::instance().setMemoryLimit(512ull * 1024 * 1024);
+    }
+};
+
+TEST_F(AnalysisCacheTest, ReuseBackwardTransitions) {
+    auto& cache = storm::storage::sparse::AnalysisCache::instance();
+    auto dtmc = createDtmc(10);
+
+    auto backwardTransitions = dtmc->getCachedBackwardTransitions();
+    EXPECT_EQ(dtmc->getBackwardTransitions(), *backwardTransitions);
+    EXPECT_EQ(0ull, cache.getNumberOfHits());
+    EXPECT_EQ(1ull, cache.getNumberOfMisses());
+
+    EXPECT_EQ(backwardTransitions.get(), dtmc->getCachedBackwardTransitions().get());
+    EXPECT_EQ(1ull, cache.getNumberOfHits());
+
+    // Modifying the model invalidates the entry.
+    dtmc->getTransitionMatrix();
+    EXPECT_NE(backwardTransitions.get(), dtmc->getCachedBackwardTransitions().get());
+    EXPECT_EQ(1ull, cache.getNumberOfHits());
+    EXPECT_EQ(2ull, cache.getNumberOfMisses());
+
+    // Destroying the model removes its entries.
+    EXPECT_LT(0ull, cache.getSizeInBytes());
+    dtmc.reset();
+    EXPECT_EQ(0ull, cache.getSizeInBytes());
+}
+
+TEST_F(AnalysisCacheTest, UnregisteredMatrix) {
+    auto& cache = storm::storage::sparse::AnalysisCache::instance();
+    auto matrix = createChain(10);
+    auto first = cache.getBackwardTransitions(matrix);
+    auto second = cache.getBackwardTransitions(matrix);
+    EXPECT_EQ(*first, *second);
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_EQ(0ull, cache.getNumberOfHits() + cache.getNumberOfMisses());
+    EXPECT_EQ(0ull, cache.getSizeInBytes());
+}
+
+TEST_F(AnalysisCacheTest, StateSets) {
+    auto& cache = storm::storage::sparse::AnalysisCache::instance();
+    auto dtmc = createDtmc(10);
+    // Only retrieving the matrix of a const model preserves the cached entries.
+    auto const& matrix = static_cast<storm::models::sparse::Dtmc<double> const&>(*dtmc).getTransitionMatrix();
+    storm::storage::BitVector phi(10, true), psi(10, false), otherPsi(10, false);
+    psi.set(9);
+    otherPsi.set(5);
+
+    uint64_t numberOfComputations = 0;
+    auto compute = [&]() {
+        ++numberOfComputations;
+        return std::make_pair(storm::storage::BitVector(10), psi);
+    };
+    using Key = storm::storage::sparse::AnalysisCache::Key;
+    cache.getOrComputeStateSets(Key(&matrix, "test", {phi, psi}), compute);
+    cache.getOrComputeStateSets(Key(&matrix, "test", {phi, psi}), compute);
+    EXPECT_EQ(1ull, numberOfComputations);
+    cache.getOrComputeStateSets(Key(&matrix, "test", {phi, otherPsi}), compute);
+    cache.getOrComputeStateSets(Key(&matrix, "other test", {phi, psi}), compute);
+    EXPECT_EQ(3ull, numberOfComputations);
+
+    // The state sets of the keys are accounted for, too.
+    uint64_t valueSize = storm::storage::BitVector(10).getSizeInBytes() + psi.getSizeInBytes();
+    EXPECT_EQ(3 * valueSize + 2 * (Key(&matrix, "test", {phi, psi}).getSizeInBytes() + Key(&matrix, "test", {phi, otherPsi}).getSizeInBytes() +
+                                   Key(&matrix, "other test", {phi, psi}).getSizeInBytes()),
+              cache.getSizeInBytes());
+}
+
+TEST_F(AnalysisCacheTest, Decompositions) {
+    auto& cache = storm::storage::sparse::AnalysisCache::instance();
+    auto dtmc = createDtmc(10);
+    auto const& matrix = static_cast<storm::models::sparse::Dtmc<double> const&>(*dtmc).getTransitionMatrix();
+
+    using DecompositionType = storm::storage::StronglyConnectedComponentDecomposition<double>;
+    uint64_t numberOfComputations = 0;
+    auto compute = [&]() {
+        ++numberOfComputations;
+        return DecompositionType(matrix, storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+    };
+    using Key = storm::storage::sparse::AnalysisCache::Key;
+    auto first = cache.getOrComputeDecomposition<DecompositionType>(Key(&matrix, "bottom sccs"), compute);
+    auto second = cache.getOrComputeDecomposition<DecompositionType>(Key(&matrix, "bottom sccs"), compute);
+    EXPECT_EQ(1ull, numberOfComputations);
+    EXPECT_EQ(first.get(), second.get());
+    ASSERT_EQ(1ull, first->size());
+    EXPECT_EQ(1ull, (*first)[0].size());
+    EXPECT_EQ(storm::storage::sparse::AnalysisCache::estimateSizeInBytes(*first) + 2 * Key(&matrix, "bottom sccs").getSizeInBytes(), cache.getSizeInBytes());
+}
+
+TEST_F(AnalysisCacheTest, Eviction) {
+    auto& cache = storm::storage::sparse::AnalysisCache::instance();
+    auto first = createDtmc(100);
+    auto second = createDtmc(100);
+
+    // Only one of the backward transitions fits into the cache.
+    uint64_t entrySize = storm::storage::sparse::AnalysisCache::estimateSizeInBytes(first->getBackwardTransitions());
+    cache.setMemoryLimit(entrySize * 3 / 2);
+
+    first->getCachedBackwardTransitions();
+    second->getCachedBackwardTransitions();
+    EXPECT_EQ(1ull, cache.getNumberOfEvictions());
+    second->getCachedBackwardTransitions();
+    EXPECT_EQ(1ull, cache.getNumberOfHits());
+    first->getCachedBackwardTransitions();
+    EXPECT_EQ(1ull, cache.getNumberOfHits());
+    EXPECT_EQ(2ull, cache.getNumberOfEvictions());
+
+    // Disabling the cache.
+    cache.setMemoryLimit(0);
+    EXPECT_EQ(0ull, cache.getSizeInBytes());
+    first->getCachedBackwardTransitions();
+    EXPECT_EQ(1ull, cache.getNumberOfHits());
+    EXPECT_EQ(3ull, cache.getNumberOfMisses());
+}
+
+}  // namespace
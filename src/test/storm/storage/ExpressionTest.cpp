@@ -343,6 +343,38 @@ TEST(Expression, SimplificationTest) {
     EXPECT_TRUE(simplifiedExpression.isFalse());
 }
 
+TEST(Expression, SharingTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    manager->setExpressionSharing(true);
+
+    storm::expressions::Expression threeExpression = manager->integer(3);
+    storm::expressions::Expression intVarExpression = manager->declareIntegerVariable("y");
+    storm::expressions::Expression otherIntVarExpression = manager->declareIntegerVariable("z");
+
+    // Structurally equal expressions are represented by the same object.
+    storm::expressions::Expression first = intVarExpression + threeExpression > otherIntVarExpression;
+    storm::expressions::Expression second = manager->getVariableExpression("y") + manager->integer(3) > manager->getVariableExpression("z");
+    EXPECT_TRUE(first.areSame(second));
+    EXPECT_FALSE(first.areSame(intVarExpression + threeExpression >= otherIntVarExpression));
+    EXPECT_TRUE(first.isSyntacticallyEqual(second));
+
+    // Simplifications are cached.
+    storm::expressions::Expression tempExpression = (manager->boolean(true) && first) || manager->boolean(false);
+    storm::expressions::Expression simplifiedExpression = tempExpression.simplify();
+    EXPECT_TRUE(simplifiedExpression.areSame(first));
+    EXPECT_TRUE(tempExpression.simplify().areSame(simplifiedExpression));
+
+    // Substitution yields shared expressions as well.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution = {{manager->getVariable("z"), threeExpression}};
+    EXPECT_TRUE(first.substitute(substitution).areSame(intVarExpression + threeExpression > threeExpression));
+
+    // Expressions that are not referenced anymore are eventually removed.
+    uint64_t numberOfSharedExpressions = manager->getNumberOfSharedExpressions();
+    tempExpression = storm::expressions::Expression();
+    simplifiedExpression = storm::expressions::Expression();
+    EXPECT_LT(manager->getNumberOfSharedExpressions(), numberOfSharedExpressions);
+}
+
 TEST(Expression, SimpleEvaluationTest) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
@@ -1,6 +1,8 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "test/storm_gtest.h"
@@ -95,6 +97,50 @@ TEST(SparseMatrixBuilder, AddNextValue) {
     ASSERT_NO_THROW(matrixBuilder4.addNextValue(3, 1, 0.2));
 }
 
+TEST(TwoPassSparseMatrixBuilder, Build) {
+    storm::storage::SparseMatrixBuilder<double> referenceBuilder(4, 4, 5, true, true, 2);
+    ASSERT_NO_THROW(referenceBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(referenceBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(referenceBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(referenceBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(referenceBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(referenceBuilder.addNextValue(2, 1, 0.7));
+    ASSERT_NO_THROW(referenceBuilder.addNextValue(3, 3, 0.2));
+    storm::storage::SparseMatrix<double> referenceMatrix;
+    ASSERT_NO_THROW(referenceMatrix = referenceBuilder.build());
+
+    // Row 1 is left empty and the rows are filled out of order.
+    storm::storage::TwoPassSparseMatrixBuilder<double> matrixBuilder(4, 4, std::vector<uint_fast64_t>({0, 2, 4}));
+    ASSERT_NO_THROW(matrixBuilder.setRowEntryCount(3, 1));
+    ASSERT_NO_THROW(matrixBuilder.setRowEntryCount(0, 2));
+    ASSERT_NO_THROW(matrixBuilder.setRowEntryCount(2, 2));
+    ASSERT_NO_THROW(matrixBuilder.allocate());
+    EXPECT_EQ(0, std::distance(matrixBuilder.begin(1), matrixBuilder.end(1)));
+    EXPECT_EQ(2, std::distance(matrixBuilder.begin(2), matrixBuilder.end(2)));
+    *matrixBuilder.begin(3) = storm::storage::MatrixEntry<uint_fast64_t, double>(3, 0.2);
+    *matrixBuilder.begin(2) = storm::storage::MatrixEntry<uint_fast64_t, double>(0, 0.5);
+    *(matrixBuilder.begin(2) + 1) = storm::storage::MatrixEntry<uint_fast64_t, double>(1, 0.7);
+    *matrixBuilder.begin(0) = storm::storage::MatrixEntry<uint_fast64_t, double>(1, 1.0);
+    *(matrixBuilder.begin(0) + 1) = storm::storage::MatrixEntry<uint_fast64_t, double>(2, 1.2);
+
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    ASSERT_EQ(4ul, matrix.getRowCount());
+    ASSERT_EQ(4ul, matrix.getColumnCount());
+    ASSERT_EQ(5ul, matrix.getEntryCount());
+    ASSERT_EQ(2ul, matrix.getRowGroupCount());
+    EXPECT_TRUE(matrix == referenceMatrix);
+
+    // Without allocating the storage, all rows are empty.
+    storm::storage::TwoPassSparseMatrixBuilder<double> emptyMatrixBuilder(3, 2);
+    ASSERT_NO_THROW(emptyMatrixBuilder.setRowEntryCount(1, 3));
+    ASSERT_NO_THROW(matrix = emptyMatrixBuilder.build());
+    ASSERT_EQ(3ul, matrix.getRowCount());
+    ASSERT_EQ(2ul, matrix.getColumnCount());
+    ASSERT_EQ(0ul, matrix.getEntryCount());
+    EXPECT_TRUE(matrix.hasTrivialRowGrouping());
+}
+
 TEST(SparseMatrix, Build) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder1(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder1.addNextValue(0, 1, 1.0));
@@ -933,4 +979,56 @@ TEST(SparseMatrix, DropZeroEntries) {
 
     ASSERT_TRUE(matrixX == matrix4);
     ASSERT_FALSE(matrixX.getEntryCount() == matrix4.getEntryCount());
-}
\ No newline at end of file
+}
+
+TEST(SparseMatrix, ParallelSubmatrix) {
+    // Create a matrix that is large enough to have its submatrices built with multiple threads.
+    uint64_t const numberOfRowGroups = 300;
+    uint64_t const numberOfColumns = 2 * numberOfRowGroups;
+    uint64_t const entriesPerRow = 200;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(2 * numberOfRowGroups, numberOfColumns, 2 * numberOfRowGroups * entriesPerRow, true, true,
+                                                              numberOfRowGroups);
+    for (uint64_t row = 0; row < 2 * numberOfRowGroups; ++row) {
+        if (row % 2 == 0) {
+            matrixBuilder.newRowGroup(row);
+        }
+        for (uint64_t entry = 0; entry < entriesPerRow; ++entry) {
+            matrixBuilder.addNextValue(row, row % 3 + 3 * entry, 1.0 / (1 + row + entry));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    ASSERT_GT(matrix.getEntryCount(), 1ull << 16);
+
+    storm::storage::BitVector rowGroupConstraint(numberOfRowGroups);
+    storm::storage::BitVector rowConstraint(matrix.getRowCount());
+    for (uint64_t group = 0; group < numberOfRowGroups; group += 3) {
+        rowGroupConstraint.set(group);
+        rowConstraint.set(2 * group + 1);
+    }
+    storm::storage::BitVector columnConstraint(numberOfColumns);
+    for (uint64_t column = 0; column < numberOfColumns; column += 2) {
+        columnConstraint.set(column);
+    }
+    std::vector<uint64_t> rowGroupChoices(numberOfRowGroups);
+    std::vector<uint64_t> inversePermutation(matrix.getRowCount());
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        inversePermutation[row] = matrix.getRowCount() - 1 - row;
+    }
+    for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+        rowGroupChoices[group] = group % 2;
+    }
+
+    auto& settings = storm::settings::mutableModelCheckerSettings();
+    settings.setNumberOfThreads(1);
+    auto sequentialSubmatrix = matrix.getSubmatrix(true, rowGroupConstraint, columnConstraint, true);
+    auto sequentialRestrictedMatrix = matrix.restrictRows(rowConstraint, true);
+    auto sequentialSelectedMatrix = matrix.selectRowsFromRowGroups(rowGroupChoices, true);
+    auto sequentialPermutedMatrix = matrix.permuteRows(inversePermutation);
+
+    settings.setNumberOfThreads(4);
+    EXPECT_EQ(sequentialSubmatrix, matrix.getSubmatrix(true, rowGroupConstraint, columnConstraint, true));
+    EXPECT_EQ(sequentialRestrictedMatrix, matrix.restrictRows(rowConstraint, true));
+    EXPECT_EQ(sequentialSelectedMatrix, matrix.selectRowsFromRowGroups(rowGroupChoices, true));
+    EXPECT_EQ(sequentialPermutedMatrix, matrix.permuteRows(inversePermutation));
+    settings.restoreDefaults();
+}
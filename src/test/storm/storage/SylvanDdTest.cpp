@@ -13,6 +13,7 @@
 
 #include "carl/util/stringparser.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -830,6 +831,54 @@ TEST(SylvanDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, AddToMatrixParallelTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 99);
+
+    // Every row x has the value x in all columns x' with x' >= x.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd =
+        manager->template getIdentity<double>(x.first) * manager->getRange(x.first).template toAdd<double>() *
+        manager->getRange(x.second).template toAdd<double>() *
+        manager->template getIdentity<double>(x.second).greaterOrEqual(manager->template getIdentity<double>(x.first)).template toAdd<double>();
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    EXPECT_EQ(100ul, matrix.getRowCount());
+    EXPECT_EQ(4950ul, matrix.getEntryCount());
+
+    // Translate the DD again, this time with several threads, and compare the result with the sequential translation.
+    std::vector<uint_fast64_t> ddRowVariableIndices;
+    for (auto const& ddVariable : manager->getMetaVariable(x.first).getDdVariables()) {
+        ddRowVariableIndices.push_back(ddVariable.getIndex());
+    }
+    std::sort(ddRowVariableIndices.begin(), ddRowVariableIndices.end());
+    std::vector<uint_fast64_t> ddColumnVariableIndices;
+    for (auto const& ddVariable : manager->getMetaVariable(x.second).getDdVariables()) {
+        ddColumnVariableIndices.push_back(ddVariable.getIndex());
+    }
+    std::sort(ddColumnVariableIndices.begin(), ddColumnVariableIndices.end());
+    std::vector<uint_fast64_t> rowGroupIndices(matrix.getRowCount() + 1);
+    std::vector<uint_fast64_t> rowIndications(matrix.getRowCount() + 1, 0);
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        rowGroupIndices[row + 1] = row + 1;
+        rowIndications[row + 1] = rowIndications[row] + matrix.getRow(row).getNumberOfEntries();
+    }
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> columnsAndValues(matrix.getEntryCount());
+    dd.getInternalAdd().toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
+                                           true, 4);
+
+    uint_fast64_t entryIndex = 0;
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), columnsAndValues[entryIndex].getColumn());
+            EXPECT_EQ(entry.getValue(), columnsAndValues[entryIndex].getValue());
+            ++entryIndex;
+        }
+        // The translation moves the row indications to the start of the next row.
+        EXPECT_EQ(entryIndex, rowIndications[row]);
+    }
+}
+
 TEST(SylvanDd, AddSharpenTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
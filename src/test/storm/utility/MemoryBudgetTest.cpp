@@ -0,0 +1,104 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <limits>
+
+#include "storm/exceptions/OutOfMemoryException.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/MemoryBudget.h"
+
+namespace {
+
+using storm::utility::resources::MemoryBudget;
+using storm::utility::resources::MemoryCategory;
+using storm::utility::resources::MemoryReservation;
+
+uint64_t const megabyte = 1024 * 1024;
+
+class MemoryBudgetTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Leave some room above the memory that is currently in use.
+        auto& budget = MemoryBudget::instance();
+        budget.setLimit(std::numeric_limits<uint64_t>::max() / 2);
+        budget.getAvailableBytes();
+        budget.setLimit(2 * budget.getUsedBytes() + 256 * megabyte);
+    }
+
+    void TearDown() override {
+        MemoryBudget::instance().setLimit(0);
+    }
+};
+
+TEST_F(MemoryBudgetTest, Reservations) {
+    auto& budget = MemoryBudget::instance();
+    uint64_t reservedBefore = budget.getReservedBytes(MemoryCategory::Caches);
+    {
+        MemoryReservation reservation(MemoryCategory::Caches);
+        reservation.resize(10 * megabyte);
+        EXPECT_EQ(reservedBefore + 10 * megabyte, budget.getReservedBytes(MemoryCategory::Caches));
+
+        MemoryReservation copy(reservation);
+        EXPECT_EQ(reservedBefore + 20 * megabyte, budget.getReservedBytes(MemoryCategory::Caches));
+        MemoryReservation moved(std::move(copy));
+        EXPECT_EQ(reservedBefore + 20 * megabyte, budget.getReservedBytes(MemoryCategory::Caches));
+
+        // Exceeding the limit fails and leaves the reservation unchanged.
+        STORM_SILENT_EXPECT_THROW(reservation.resize(budget.getLimit()), storm::exceptions::OutOfMemoryException);
+        EXPECT_EQ(10 * megabyte, reservation.getBytes());
+        EXPECT_FALSE(reservation.tryResize(budget.getLimit()));
+        EXPECT_TRUE(reservation.tryResize(5 * megabyte));
+    }
+    EXPECT_EQ(reservedBefore, budget.getReservedBytes(MemoryCategory::Caches));
+}
+
+TEST_F(MemoryBudgetTest, PressureHandler) {
+    auto& budget = MemoryBudget::instance();
+    uint64_t usedBytes = budget.getUsedBytes();
+
+    // Reserve enough for the reservations to dominate the resident memory of the process.
+    MemoryReservation cached(MemoryCategory::Caches);
+    cached.resize(usedBytes - budget.getReservedBytes() + 100 * megabyte);
+    uint64_t handlerId = budget.addPressureHandler([&cached]() { cached.resize(0); });
+
+    // The following reservation only fits after the handler freed the cached memory.
+    MemoryReservation needed(MemoryCategory::SolverVectors);
+    needed.resize(budget.getLimit() - usedBytes - 50 * megabyte);
+    EXPECT_EQ(0ull, cached.getBytes());
+    EXPECT_EQ(budget.getLimit() - usedBytes - 50 * megabyte, needed.getBytes());
+    budget.removePressureHandler(handlerId);
+}
+
+TEST_F(MemoryBudgetTest, DataStructures) {
+    auto& budget = MemoryBudget::instance();
+    uint64_t reservedBefore = budget.getReservedBytes(MemoryCategory::MatrixBuilder);
+    {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        for (uint64_t row = 0; row < 1000; ++row) {
+            builder.addNextValue(row, row, 1.0);
+        }
+        EXPECT_LT(reservedBefore, budget.getReservedBytes(MemoryCategory::MatrixBuilder));
+        auto matrix = builder.build();
+        EXPECT_EQ(reservedBefore, budget.getReservedBytes(MemoryCategory::MatrixBuilder));
+    }
+
+    reservedBefore = budget.getReservedBytes(MemoryCategory::StateStorage);
+    {
+        storm::storage::BitVectorHashMap<uint64_t> map(64, 10);
+        EXPECT_LT(reservedBefore, budget.getReservedBytes(MemoryCategory::StateStorage));
+        uint64_t reservedForSmallMap = budget.getReservedBytes(MemoryCategory::StateStorage);
+        for (uint64_t value = 0; value < 1000; ++value) {
+            storm::storage::BitVector key(64);
+            key.setFromInt(0, 64, value);
+            map.findOrAdd(key, value);
+        }
+        EXPECT_LT(reservedForSmallMap, budget.getReservedBytes(MemoryCategory::StateStorage));
+    }
+    EXPECT_EQ(reservedBefore, budget.getReservedBytes(MemoryCategory::StateStorage));
+
+    // A builder whose storage exceeds the budget raises an exception.
+    STORM_SILENT_EXPECT_THROW(storm::storage::SparseMatrixBuilder<double>(0, 0, budget.getLimit()), storm::exceptions::OutOfMemoryException);
+}
+
+}  // namespace
@@ -0,0 +1,156 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+#include <thread>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/Metrics.h"
+
+namespace {
+
+using storm::utility::metrics::MetricsFormat;
+using storm::utility::metrics::MetricsRecorder;
+using storm::utility::metrics::ScopedTimer;
+
+class MetricsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MetricsRecorder::instance().clear();
+    }
+
+    void TearDown() override {
+        MetricsRecorder::instance().setEnabled(false);
+        MetricsRecorder::instance().clear();
+    }
+};
+
+TEST_F(MetricsTest, Disabled) {
+    auto& recorder = MetricsRecorder::instance();
+    recorder.setEnabled(false);
+    {
+        ScopedTimer timer("phase");
+        storm::utility::metrics::addToCounter("counter", 3);
+    }
+    EXPECT_EQ(0ull, recorder.getNumberOfPhases());
+    EXPECT_EQ(0ull, recorder.getCounter("counter"));
+}
+
+TEST_F(MetricsTest, Counters) {
+    auto& recorder = MetricsRecorder::instance();
+    recorder.setEnabled(true);
+    storm::utility::metrics::addToCounter("counter");
+    storm::utility::metrics::addToCounter("counter", 4);
+    EXPECT_EQ(5ull, recorder.getCounter("counter"));
+    storm::utility::metrics::updateCounterMaximum("maximum", 7);
+    storm::utility::metrics::updateCounterMaximum("maximum", 2);
+    EXPECT_EQ(7ull, recorder.getCounter("maximum"));
+    EXPECT_EQ(0ull, recorder.getCounter("unknown"));
+}
+
+TEST_F(MetricsTest, JsonExport) {
+    auto& recorder = MetricsRecorder::instance();
+    recorder.setEnabled(true);
+    {
+        ScopedTimer outer("outer");
+        { ScopedTimer inner1("inner1"); }
+        { ScopedTimer inner2("inner2"); }
+        storm::utility::metrics::setValue("value", 0.5);
+    }
+    { ScopedTimer second("second"); }
+    EXPECT_EQ(4ull, recorder.getNumberOfPhases());
+
+    std::stringstream stream;
+    recorder.exportMetrics(stream, MetricsFormat::Json);
+    auto json = storm::json<double>::parse(stream.str());
+    ASSERT_EQ(2ull, json["phases"].size());
+    EXPECT_EQ("outer", json["phases"][0]["name"].get<std::string>());
+    EXPECT_EQ("second", json["phases"][1]["name"].get<std::string>());
+    ASSERT_EQ(2ull, json["phases"][0]["phases"].size());
+    EXPECT_EQ("inner1", json["phases"][0]["phases"][0]["name"].get<std::string>());
+    EXPECT_EQ("inner2", json["phases"][0]["phases"][1]["name"].get<std::string>());
+    EXPECT_LE(json["phases"][0]["phases"][1]["duration-ms"].get<double>(), json["phases"][0]["duration-ms"].get<double>());
+    EXPECT_EQ(0.5, json["values"]["value"].get<double>());
+}
+
+TEST_F(MetricsTest, PhasesOnOtherThreads) {
+    auto& recorder = MetricsRecorder::instance();
+    recorder.setEnabled(true);
+    {
+        ScopedTimer outer("outer");
+        auto parent = recorder.getRunningPhase();
+        std::thread worker([&parent]() {
+            ScopedTimer attached("attached", parent);
+            ScopedTimer nested("nested");
+        });
+        worker.join();
+        std::thread independentWorker([]() { ScopedTimer independent("independent"); });
+        independentWorker.join();
+    }
+    EXPECT_EQ(4ull, recorder.getNumberOfPhases());
+
+    std::stringstream stream;
+    recorder.exportMetrics(stream, MetricsFormat::Json);
+    auto json = storm::json<double>::parse(stream.str());
+    ASSERT_EQ(2ull, json["phases"].size());
+    EXPECT_EQ("outer", json["phases"][0]["name"].get<std::string>());
+    EXPECT_EQ("independent", json["phases"][1]["name"].get<std::string>());
+    ASSERT_EQ(1ull, json["phases"][0]["phases"].size());
+    auto const& attached = json["phases"][0]["phases"][0];
+    EXPECT_EQ("attached", attached["name"].get<std::string>());
+    EXPECT_NE(json["phases"][0]["thread"].get<uint64_t>(), attached["thread"].get<uint64_t>());
+    ASSERT_EQ(1ull, attached["phases"].size());
+    EXPECT_EQ("nested", attached["phases"][0]["name"].get<std::string>());
+}
+
+TEST_F(MetricsTest, ClearWhileRunning) {
+    auto& recorder = MetricsRecorder::instance();
+    recorder.setEnabled(true);
+    {
+        ScopedTimer stale("stale");
+        recorder.clear();
+        { ScopedTimer fresh("fresh"); }
+        // Ending the stale phase must not affect the phase that now has the same index
+        ScopedTimer running("running");
+    }
+    EXPECT_EQ(2ull, recorder.getNumberOfPhases());
+
+    std::stringstream stream;
+    recorder.exportMetrics(stream, MetricsFormat::Json);
+    auto json = storm::json<double>::parse(stream.str());
+    ASSERT_EQ(2ull, json["phases"].size());
+    EXPECT_EQ("fresh", json["phases"][0]["name"].get<std::string>());
+    EXPECT_EQ(0ull, json["phases"][0].count("phases"));
+    EXPECT_EQ("running", json["phases"][1]["name"].get<std::string>());
+    EXPECT_EQ(0ull, json["phases"][1].count("running"));
+}
+
+TEST_F(MetricsTest, ChromeTraceExport) {
+    auto& recorder = MetricsRecorder::instance();
+    recorder.setEnabled(true);
+    {
+        ScopedTimer outer("outer");
+        storm::utility::metrics::addToCounter("counter", 2);
+    }
+
+    std::stringstream stream;
+    recorder.exportMetrics(stream, MetricsFormat::ChromeTrace);
+    auto json = storm::json<double>::parse(stream.str());
+    uint64_t numberOfPhaseEvents = 0;
+    uint64_t numberOfCounterEvents = 0;
+    for (auto const& event : json["traceEvents"]) {
+        auto type = event["ph"].get<std::string>();
+        if (type == "X") {
+            ++numberOfPhaseEvents;
+            EXPECT_EQ("outer", event["name"].get<std::string>());
+        } else if (type == "C") {
+            ++numberOfCounterEvents;
+            EXPECT_EQ("counter", event["name"].get<std::string>());
+            EXPECT_EQ(2ull, event["args"]["value"].get<uint64_t>());
+        }
+    }
+    EXPECT_EQ(1ull, numberOfPhaseEvents);
+    EXPECT_EQ(1ull, numberOfCounterEvents);
+}
+
+}  // namespace
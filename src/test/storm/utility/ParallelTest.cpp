@@ -0,0 +1,79 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+
+#include "storm/utility/parallel.h"
+
+TEST(ParallelTest, ExecuteTasks) {
+    std::vector<std::atomic<uint64_t>> executions(1000);
+    for (auto& e : executions) {
+        e = 0;
+    }
+    storm::utility::parallel::executeTasks(4, executions.size(), [&executions](uint64_t task, uint64_t thread) {
+        EXPECT_LT(thread, 4ull);
+        ++executions[task];
+    });
+    for (auto const& e : executions) {
+        EXPECT_EQ(1ull, e.load());
+    }
+
+    EXPECT_THROW(storm::utility::parallel::executeTasks(4, 100,
+                                                        [](uint64_t task, uint64_t) {
+                                                            if (task == 42) {
+                                                                throw std::runtime_error("Task failed.");
+                                                            }
+                                                        }),
+                 std::runtime_error);
+}
+
+TEST(ParallelTest, ExecuteTaskGraph) {
+    uint64_t const numberOfTasks = 500;
+    std::vector<std::vector<uint64_t>> dependencies(numberOfTasks);
+    for (uint64_t task = 1; task < numberOfTasks; ++task) {
+        dependencies[task].push_back(task / 2);
+        if (task > 3) {
+            dependencies[task].push_back(task - 3);
+        }
+    }
+    std::vector<std::atomic<bool>> finished(numberOfTasks);
+    for (auto& f : finished) {
+        f = false;
+    }
+    std::atomic<uint64_t> numberOfViolations(0);
+    bool allExecuted = storm::utility::parallel::executeTaskGraph(4, dependencies, [&](uint64_t task, uint64_t) {
+        for (auto const& dependency : dependencies[task]) {
+            if (!finished[dependency]) {
+                ++numberOfViolations;
+            }
+        }
+        finished[task] = true;
+    });
+    EXPECT_TRUE(allExecuted);
+    EXPECT_EQ(0ull, numberOfViolations.load());
+    for (auto const& f : finished) {
+        EXPECT_TRUE(f.load());
+    }
+}
+
+TEST(ParallelTest, Chunks) {
+    uint64_t const size = 100000;
+    std::vector<std::atomic<uint64_t>> visits(size);
+    for (auto& v : visits) {
+        v = 0;
+    }
+    storm::utility::parallel::forEachChunk(4, size, [&visits](uint64_t first, uint64_t last) {
+        EXPECT_LT(first, last);
+        for (uint64_t i = first; i < last; ++i) {
+            ++visits[i];
+        }
+    });
+    for (auto const& v : visits) {
+        EXPECT_EQ(1ull, v.load());
+    }
+
+    EXPECT_TRUE(storm::utility::parallel::anyOfChunks(4, size, [](uint64_t first, uint64_t last) { return first <= 4242 && 4242 < last; }));
+    EXPECT_FALSE(storm::utility::parallel::anyOfChunks(4, size, [](uint64_t first, uint64_t last) { return last > size; }));
+    EXPECT_TRUE(storm::utility::parallel::anyOfChunks(1, size, [](uint64_t first, uint64_t last) { return first == 0 && last == size; }));
+}